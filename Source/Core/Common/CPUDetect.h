@@ -30,6 +30,9 @@ struct CPUInfo
   bool bSSE4_2 = false;
   bool bLZCNT = false;
   bool bAVX = false;
+  bool bAVX2 = false;
+  // AVX-512 with the F, BW, DQ and VL subsets, and an OS that saves the ZMM and opmask registers
+  bool bAVX512 = false;
   bool bBMI1 = false;
   bool bBMI2 = false;
   // PDEP and PEXT are ridiculously slow on AMD Zen1, Zen1+ and Zen2 (Family 17h)
@@ -40,6 +40,7 @@ enum
   D_COVERCACHE_IDX,
   D_REDUMPCACHE_IDX,
   D_SHADERCACHE_IDX,
+  D_JITCACHE_IDX,
   D_SHADERS_IDX,
   D_STATESAVES_IDX,
   D_SCREENSHOTS_IDX,
@@ -22,6 +22,19 @@
 #endif
 #endif
 
+// XXH3 only picks its SIMD instructions at compile time. Like the x86 dispatcher that comes with
+// xxHash, build both its SSE2 and its AVX2 loop for long inputs here, so that GetXXH3Hash64 can
+// pick one at runtime.
+#if defined(_M_X86_64)
+#define XXH_X86DISPATCH
+#define XXH_DISPATCH_AVX2 1
+#ifndef _MSC_VER
+#define XXH_TARGET_AVX2 __attribute__((__target__("avx2")))
+#endif
+#endif
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
 namespace Common
 {
 u32 HashAdler32(const u8* data, size_t len)
@@ -451,6 +464,35 @@ u64 GetHash64(const u8* src, u32 len, u32 samples)
   return s_texture_hash_func(src, len, samples);
 }
 
+#if defined(_M_X86_64)
+
+XXH_NO_INLINE XXH64_hash_t XXH3HashLong_SSE2(const void* XXH_RESTRICT input, size_t len,
+                                             XXH64_hash_t, const xxh_u8* XXH_RESTRICT, size_t)
+{
+  return XXH3_hashLong_64b_internal(input, len, XXH3_kSecret, sizeof(XXH3_kSecret),
+                                    XXH3_accumulate_sse2, XXH3_scrambleAcc_sse2);
+}
+
+XXH_NO_INLINE XXH_TARGET_AVX2 XXH64_hash_t
+XXH3HashLong_AVX2(const void* XXH_RESTRICT input, size_t len, XXH64_hash_t,
+                  const xxh_u8* XXH_RESTRICT, size_t)
+{
+  return XXH3_hashLong_64b_internal(input, len, XXH3_kSecret, sizeof(XXH3_kSecret),
+                                    XXH3_accumulate_avx2, XXH3_scrambleAcc_avx2);
+}
+
+#endif
+
+u64 GetXXH3Hash64(const u8* src, size_t len)
+{
+#if defined(_M_X86_64)
+  const XXH3_hashLong64_f hash_long = cpu_info.bAVX2 ? XXH3HashLong_AVX2 : XXH3HashLong_SSE2;
+  return XXH3_64bits_internal(src, len, 0, XXH3_kSecret, sizeof(XXH3_kSecret), hash_long);
+#else
+  return XXH3_64bits(src, len);
+#endif
+}
+
 u32 StartCRC32()
 {
   return crc32_z(0L, Z_NULL, 0);
@@ -16,6 +16,8 @@ u32 HashEctor(const u8* data, size_t len);
 
 // Specialized hash function used for the texture cache
 u64 GetHash64(const u8* src, u32 len, u32 samples);
+// XXH3 of all of the input, using AVX2 if the host supports it
+u64 GetXXH3Hash64(const u8* src, size_t len);
 
 u32 StartCRC32();
 u32 UpdateCRC32(u32 crc, const u8* data, size_t len);
@@ -109,6 +109,9 @@ public:
   u64 GetSize() const;
   bool Resize(u64 size);
   bool Flush();
+  // Tells the OS that the given range will be read soon, so it can start reading it in the
+  // background. This is only a hint and does nothing on some systems.
+  void Prefetch(u64 offset, u64 size);
 
   // clear error state
   void ClearError()
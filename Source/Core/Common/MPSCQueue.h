@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a lockless thread-safe, bounded,
+// multiple producer, single consumer queue
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+namespace Common
+{
+// A ring of Capacity preallocated slots, so pushing never allocates. Each slot carries a sequence
+// number that tells whether it is free for the producer that claimed its position or holds a value
+// for the consumer. Producers only compete for the write position, never on a lock, and elements
+// pushed by the same thread are popped in the order they were pushed.
+//
+// TryPush fails if the ring is full. An element whose TryPush is still in progress may not be
+// visible to Pop yet, even if elements that were pushed after it by other threads already are. Pop
+// stops at such an element and returns false, so the consumer has to be prepared to retry later.
+template <typename T, std::size_t Capacity>
+class MPSCQueue
+{
+  static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+public:
+  MPSCQueue()
+  {
+    for (std::size_t i = 0; i < Capacity; ++i)
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // can be called from any thread
+  template <typename Arg>
+  bool TryPush(Arg&& t)
+  {
+    std::size_t position = m_write_position.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+      slot = &m_slots[position & MASK];
+      const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      if (sequence == position)
+      {
+        // the slot is free, claim it before another producer does
+        if (m_write_position.compare_exchange_weak(position, position + 1,
+                                                   std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (sequence < position)
+      {
+        // the consumer hasn't popped the element from the last round yet
+        return false;
+      }
+      else
+      {
+        // another producer claimed this position first
+        position = m_write_position.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->value = std::forward<Arg>(t);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer only
+  // Also false while a TryPush is still in progress, even though Pop can't return its element yet.
+  bool Empty() const
+  {
+    return m_write_position.load(std::memory_order_acquire) == m_read_position;
+  }
+
+  // consumer only
+  bool Pop(T& t)
+  {
+    Slot& slot = m_slots[m_read_position & MASK];
+    if (slot.sequence.load(std::memory_order_acquire) != m_read_position + 1)
+      return false;
+
+    t = std::move(slot.value);
+    // hand the slot to the producer of the next round
+    slot.sequence.store(m_read_position + Capacity, std::memory_order_release);
+    ++m_read_position;
+    return true;
+  }
+
+  // consumer only
+  void Clear()
+  {
+    for (T t; Pop(t);)
+    {
+    }
+  }
+
+private:
+  static constexpr std::size_t MASK = Capacity - 1;
+
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence;
+    T value{};
+  };
+
+  std::array<Slot, Capacity> m_slots;
+  // producers and the consumer are kept on separate cache lines
+  alignas(64) std::atomic<std::size_t> m_write_position{0};
+  alignas(64) std::size_t m_read_position = 0;
+};
+}  // namespace Common
@@ -102,6 +102,18 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Change whether a part of a view created with CreateView() or MapInMemoryRegion() can be
+  /// written to. Doesn't log or show messages, so it may be called from a fault handler.
+  ///
+  /// @param address Start of the range. Must be aligned to the host page size.
+  /// @param size Size of the range.
+  /// @param writable Whether the range should be writable, or only readable.
+  ///
+  /// @return Whether the protection could be changed.
+  ///
+  bool SetViewWritable(void* address, size_t size, bool writable);
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
@@ -110,6 +110,11 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+bool MemArena::SetViewWritable(void* address, size_t size, bool writable)
+{
+  return mprotect(address, size, writable ? PROT_READ | PROT_WRITE : PROT_READ) == 0;
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -434,6 +434,13 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   UnmapViewOfFile(view);
 }
 
+bool MemArena::SetViewWritable(void* address, size_t size, bool writable)
+{
+  DWORD old_protect;
+  return VirtualProtect(address, size, writable ? PAGE_READWRITE : PAGE_READONLY, &old_protect) !=
+         FALSE;
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+ThreadPool::ThreadPool(u32 thread_count, std::string thread_name)
+    : m_thread_name(std::move(thread_name))
+{
+  for (u32 i = 1; i < thread_count; i++)
+    m_threads.emplace_back(&ThreadPool::WorkerThread, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lock(m_mutex);
+    m_exit_threads = true;
+  }
+  m_work_cv.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+}
+
+void ThreadPool::RunOnAllThreads(const std::function<void(u32)>& task)
+{
+  if (m_threads.empty())
+  {
+    task(0);
+    return;
+  }
+
+  {
+    std::lock_guard lock(m_mutex);
+    m_task = &task;
+    m_work_generation++;
+    m_busy_threads = static_cast<u32>(m_threads.size());
+  }
+  m_work_cv.notify_all();
+
+  task(0);
+
+  std::unique_lock lock(m_mutex);
+  m_done_cv.wait(lock, [this] { return m_busy_threads == 0; });
+  m_task = nullptr;
+}
+
+void ThreadPool::ParallelFor(u32 job_count, const std::function<void(u32)>& job)
+{
+  if (m_threads.empty() || job_count <= 1)
+  {
+    for (u32 i = 0; i < job_count; i++)
+      job(i);
+    return;
+  }
+
+  m_next_job.store(0, std::memory_order_relaxed);
+  RunOnAllThreads([&](u32) {
+    for (u32 i = m_next_job.fetch_add(1, std::memory_order_relaxed); i < job_count;
+         i = m_next_job.fetch_add(1, std::memory_order_relaxed))
+    {
+      job(i);
+    }
+  });
+}
+
+void ThreadPool::WorkerThread(u32 thread_index)
+{
+  SetCurrentThreadName(m_thread_name.c_str());
+
+  u64 generation = 0;
+  while (true)
+  {
+    const std::function<void(u32)>* task;
+    {
+      std::unique_lock lock(m_mutex);
+      m_work_cv.wait(lock, [&] { return m_exit_threads || m_work_generation != generation; });
+      if (m_exit_threads)
+        return;
+      generation = m_work_generation;
+      task = m_task;
+    }
+
+    (*task)(thread_index);
+
+    std::lock_guard lock(m_mutex);
+    if (--m_busy_threads == 0)
+      m_done_cv.notify_one();
+  }
+}
+}  // namespace Common
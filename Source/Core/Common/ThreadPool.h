@@ -0,0 +1,57 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A fixed set of threads that work on one task together with the calling thread, for splitting
+// up work that the calling thread has to wait for anyway, like decoding a texture or drawing a
+// batch of triangles. The threads sleep while there is no task.
+class ThreadPool
+{
+public:
+  // The thread count includes the calling thread, so 1 means no worker threads.
+  ThreadPool(u32 thread_count, std::string thread_name);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()) + 1; }
+
+  // Runs task(thread_index) once on every thread and returns once all of them are done. The
+  // calling thread has index 0.
+  void RunOnAllThreads(const std::function<void(u32)>& task);
+
+  // Runs job(0) to job(job_count - 1), spread over the threads, and returns once all of them are
+  // done.
+  void ParallelFor(u32 job_count, const std::function<void(u32)>& job);
+
+private:
+  void WorkerThread(u32 thread_index);
+
+  std::string m_thread_name;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+  const std::function<void(u32)>* m_task = nullptr;
+  u64 m_work_generation = 0;
+  u32 m_busy_threads = 0;
+  bool m_exit_threads = false;
+
+  std::atomic<u32> m_next_job{0};
+};
+}  // namespace Common
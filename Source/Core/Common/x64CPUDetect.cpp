@@ -200,6 +200,15 @@ void CPUInfo::Detect()
       info = cpuid(7);
       if ((info.ebx >> 3) & 1)
         bBMI1 = true;
+      if (bAVX && ((info.ebx >> 5) & 1))
+        bAVX2 = true;
+      // AVX-512 additionally needs XSAVE to be enabled for the opmask and ZMM registers
+      constexpr u32 avx512_mask = (1 << 16) | (1 << 17) | (1 << 30) | (1 << 31);  // F, DQ, BW, VL
+      if (bAVX2 && (info.ebx & avx512_mask) == avx512_mask &&
+          (xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b11100110) == 0b11100110)
+      {
+        bAVX512 = true;
+      }
       if ((info.ebx >> 8) & 1)
         bBMI2 = true;
       if ((info.ebx >> 29) & 1)
@@ -258,6 +267,10 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX2)
+    sum.push_back("AVX2");
+  if (bAVX512)
+    sum.push_back("AVX512");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
@@ -3,10 +3,15 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -15,6 +20,8 @@
 #include "Common/Assert.h"
 #include "Common/BitUtils.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "Common/Thread.h"
 
 #include "Core/Core.h"
 #include "Core/HW/Memmap.h"
@@ -99,6 +106,105 @@ std::vector<u8> Cheats::GetValueAsByteVector(const Cheats::SearchValue& value)
   }
 }
 
+Cheats::SlotBitmap::SlotBitmap(u64 slot_count) : m_words((slot_count + 63) / 64)
+{
+}
+
+bool Cheats::SlotBitmap::Test(u64 slot) const
+{
+  const u64 word = slot / 64;
+  return word < m_words.size() && ((m_words[word] >> (slot % 64)) & 1) != 0;
+}
+
+void Cheats::SlotBitmap::Set(u64 slot)
+{
+  m_words[slot / 64] |= u64{1} << (slot % 64);
+}
+
+void Cheats::SlotBitmap::UpdateIndex()
+{
+  const size_t block_count = (m_words.size() + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+  m_block_ranks.resize(block_count + 1);
+
+  u64 rank = 0;
+  for (size_t block = 0; block < block_count; ++block)
+  {
+    m_block_ranks[block] = rank;
+    const size_t end = std::min(m_words.size(), (block + 1) * WORDS_PER_BLOCK);
+    for (size_t word = block * WORDS_PER_BLOCK; word < end; ++word)
+      rank += std::popcount(m_words[word]);
+  }
+  m_block_ranks[block_count] = rank;
+}
+
+size_t Cheats::SlotBitmap::Count() const
+{
+  return m_block_ranks.empty() ? 0 : m_block_ranks.back();
+}
+
+size_t Cheats::SlotBitmap::Rank(u64 slot) const
+{
+  const u64 word = slot / 64;
+  if (word >= m_words.size())
+    return Count();
+
+  const size_t block = word / WORDS_PER_BLOCK;
+  size_t rank = m_block_ranks[block];
+  for (size_t i = block * WORDS_PER_BLOCK; i < word; ++i)
+    rank += std::popcount(m_words[i]);
+  return rank + std::popcount(m_words[word] & ((u64{1} << (slot % 64)) - 1));
+}
+
+u64 Cheats::SlotBitmap::Select(size_t index) const
+{
+  DEBUG_ASSERT(index < Count());
+
+  // The last block that has at most index set slots before it is the one that contains the slot.
+  const auto block_it = std::upper_bound(m_block_ranks.begin(), m_block_ranks.end(), index) - 1;
+  const size_t block = block_it - m_block_ranks.begin();
+  size_t remaining = index - *block_it;
+
+  for (size_t word = block * WORDS_PER_BLOCK; word < m_words.size(); ++word)
+  {
+    u64 bits = m_words[word];
+    const size_t count = std::popcount(bits);
+    if (remaining >= count)
+    {
+      remaining -= count;
+      continue;
+    }
+
+    for (; remaining > 0; --remaining)
+      bits &= bits - 1;
+    return word * 64 + std::countr_zero(bits);
+  }
+
+  ASSERT(false);
+  return 0;
+}
+
+template <typename T>
+u32 Cheats::SearchResults<T>::GetAddress(size_t index) const
+{
+  const u64 slot = m_candidates.Select(index);
+  const auto range_it =
+      std::upper_bound(m_slot_ranges.begin(), m_slot_ranges.end(), slot,
+                       [](u64 s, const SlotRange& range) { return s < range.m_first_slot; }) -
+      1;
+  return range_it->m_start_address +
+         static_cast<u32>((slot - range_it->m_first_slot) * range_it->m_step);
+}
+
+template <typename T>
+Cheats::SearchResultValueState Cheats::SearchResults<T>::GetValueState(size_t index) const
+{
+  if (m_inaccessible.Test(m_candidates.Select(index)))
+    return Cheats::SearchResultValueState::AddressNotAccessible;
+
+  return m_values_translated ? Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                               Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+}
+
 namespace
 {
 template <typename T>
@@ -197,65 +303,519 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 {
   return PowerPC::MMU::HostTryReadF64(guard, addr, space);
 }
-}  // namespace
 
 template <typename T>
-Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
-Cheats::NewSearch(const Core::CPUThreadGuard& guard,
-                  const std::vector<Cheats::MemoryRange>& memory_ranges,
-                  PowerPC::RequestedAddressSpace address_space, bool aligned,
-                  const std::function<bool(const T& value)>& validator)
+static T ReadBigEndian(const u8* ptr)
 {
-  const u32 data_size = sizeof(T);
-  std::vector<Cheats::SearchResult<T>> results;
-  Cheats::SearchErrorCode error_code = Cheats::SearchErrorCode::Success;
-  Core::RunAsCPUThread([&] {
-    const Core::State core_state = Core::GetState();
-    if (core_state != Core::State::Running && core_state != Core::State::Paused)
+  T value;
+  std::memcpy(&value, ptr, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+// Mirrors the checks in PowerPC::MMU::IsRAMAddress.
+static u8* GetHostPointerForPhysicalAddress(Memory::MemoryManager& memory, u32 address)
+{
+  const u32 segment = address >> 28;
+  const u32 offset = address & 0x0FFFFFFF;
+  if (memory.GetRAM() && segment == 0x0 && offset < memory.GetRamSizeReal())
+    return memory.GetRAM() + offset;
+  if (memory.GetEXRAM() && segment == 0x1 && offset < memory.GetExRamSizeReal())
+    return memory.GetEXRAM() + offset;
+  if (memory.GetFakeVMEM() && (address & 0xFE000000) == 0x7E000000)
+    return memory.GetFakeVMEM() + (address & memory.GetFakeVMemMask());
+  if (memory.GetL1Cache() && segment == 0xE && address < 0xE0000000 + memory.GetL1CacheSize())
+    return memory.GetL1Cache() + offset;
+  return nullptr;
+}
+
+// Reads directly from the host memory that backs the emulated memory of one slot range. The
+// pages are looked up once when the reader is created (on the CPU thread, for emulated memory),
+// after which the reader can be used from any thread for as long as the CPU stays paused.
+class HostMemoryReader
+{
+public:
+  HostMemoryReader(const Cheats::HostPageLookup& lookup_page, const Cheats::SlotRange& range,
+                   u32 data_size)
+      : m_first_page(range.m_start_address & ~PowerPC::HW_PAGE_MASK)
+  {
+    const u64 end =
+        std::min<u64>(u64{range.m_start_address} + (range.m_slot_count - 1) * range.m_step +
+                          data_size,
+                      0x1'0000'0000);
+    for (u64 page = m_first_page; page < end; page += PowerPC::HW_PAGE_SIZE)
+      m_pages.push_back(lookup_page(static_cast<u32>(page)));
+  }
+
+  // Returns nullptr unless all of the given bytes are accessible and contiguous in host memory.
+  const u8* GetPointer(u32 address, u32 size) const
+  {
+    const size_t first_page = (address - m_first_page) / PowerPC::HW_PAGE_SIZE;
+    const size_t last_page = (u64{address} + size - 1 - m_first_page) / PowerPC::HW_PAGE_SIZE;
+    if (last_page >= m_pages.size() || !m_pages[first_page])
+      return nullptr;
+
+    for (size_t page = first_page + 1; page <= last_page; ++page)
     {
-      error_code = Cheats::SearchErrorCode::NoEmulationActive;
-      return;
+      if (m_pages[page] != m_pages[first_page] + (page - first_page) * PowerPC::HW_PAGE_SIZE)
+        return nullptr;
     }
 
-    auto& system = Core::System::GetInstance();
-    auto& ppc_state = system.GetPPCState();
-    if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
+    return m_pages[first_page] + (address & PowerPC::HW_PAGE_MASK);
+  }
+
+  template <typename T>
+  std::optional<T> Read(u32 address) const
+  {
+    if (const u8* ptr = GetPointer(address, sizeof(T)))
+      return ReadBigEndian<T>(ptr);
+
+    // The value crosses into a page that isn't contiguous with this one in host memory, or that
+    // isn't accessible at all. A value that can only be read partially is skipped.
+    u8 bytes[sizeof(T)];
+    for (u32 i = 0; i < sizeof(T); ++i)
     {
-      error_code = Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
-      return;
+      const u8* ptr = GetPointer(address + i, 1);
+      if (!ptr)
+        return std::nullopt;
+      bytes[i] = *ptr;
     }
+    return ReadBigEndian<T>(bytes);
+  }
+
+private:
+  u32 m_first_page;
+  std::vector<const u8*> m_pages;
+};
 
-    for (const Cheats::MemoryRange& range : memory_ranges)
+// Reads through the MMU. Only usable on the CPU thread.
+class MMUReader
+{
+public:
+  MMUReader(const Core::CPUThreadGuard& guard, PowerPC::RequestedAddressSpace space)
+      : m_guard(guard), m_space(space)
+  {
+  }
+
+  const u8* GetPointer(u32 address, u32 size) const { return nullptr; }
+
+  template <typename T>
+  std::optional<T> Read(u32 address) const
+  {
+    const auto result = TryReadValueFromEmulatedMemory<T>(m_guard, address, m_space);
+    if (!result)
+      return std::nullopt;
+    return result->value;
+  }
+
+private:
+  const Core::CPUThreadGuard& m_guard;
+  PowerPC::RequestedAddressSpace m_space;
+};
+
+struct SearchChunk
+{
+  size_t m_range;
+  size_t m_first_word;
+  size_t m_end_word;
+};
+}  // namespace
+
+static std::vector<Cheats::SlotRange>
+MakeSlotRanges(const std::vector<Cheats::MemoryRange>& memory_ranges, u32 data_size, bool aligned)
+{
+  std::vector<Cheats::SlotRange> slot_ranges;
+  u64 next_slot = 0;
+  for (const Cheats::MemoryRange& range : memory_ranges)
+  {
+    if (range.m_length < data_size)
+      continue;
+
+    const u32 increment_per_loop = aligned ? data_size : 1;
+    const u32 start_address = aligned ? Common::AlignUp(range.m_start, data_size) : range.m_start;
+    const u64 aligned_length = range.m_length - (start_address - range.m_start);
+
+    if (aligned_length < data_size)
+      continue;
+
+    const u64 length = aligned_length - (data_size - 1);
+    const u64 slot_count = (length + increment_per_loop - 1) / increment_per_loop;
+    slot_ranges.push_back({start_address, increment_per_loop, slot_count, next_slot});
+    next_slot = Common::AlignUp(next_slot + slot_count, 64);
+  }
+  return slot_ranges;
+}
+
+static u64 GetSlotCount(const std::vector<Cheats::SlotRange>& slot_ranges)
+{
+  return slot_ranges.empty() ? 0 :
+                               slot_ranges.back().m_first_slot + slot_ranges.back().m_slot_count;
+}
+
+static std::vector<SearchChunk> MakeChunks(const std::vector<Cheats::SlotRange>& slot_ranges)
+{
+  // 64K slots per chunk
+  constexpr size_t WORDS_PER_CHUNK = 1024;
+
+  std::vector<SearchChunk> chunks;
+  for (size_t i = 0; i < slot_ranges.size(); ++i)
+  {
+    const Cheats::SlotRange& range = slot_ranges[i];
+    const size_t first_word = range.m_first_slot / 64;
+    const size_t end_word = (range.m_first_slot + range.m_slot_count + 63) / 64;
+    for (size_t word = first_word; word < end_word; word += WORDS_PER_CHUNK)
+      chunks.push_back({i, word, std::min(end_word, word + WORDS_PER_CHUNK)});
+  }
+  return chunks;
+}
+
+// Calls func(reader, chunk_index) for every chunk, spread across multiple threads.
+template <typename Func>
+static void ForEachChunkInHostMemory(const Cheats::HostPageLookup& lookup_page,
+                                     const std::vector<Cheats::SlotRange>& slot_ranges,
+                                     const std::vector<SearchChunk>& chunks, u32 data_size,
+                                     Func func)
+{
+  std::vector<HostMemoryReader> readers;
+  readers.reserve(slot_ranges.size());
+  for (const Cheats::SlotRange& range : slot_ranges)
+    readers.emplace_back(lookup_page, range, data_size);
+
+  const size_t thread_count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1,
+                                                  std::max<size_t>(chunks.size(), 1));
+  std::atomic<size_t> next_chunk = 0;
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    threads.emplace_back([&] {
+      Common::SetCurrentThreadName("Cheat Search");
+      for (size_t chunk = next_chunk++; chunk < chunks.size(); chunk = next_chunk++)
+        func(readers[chunks[chunk].m_range], chunk);
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+// Calls func(reader, chunk_index) for every chunk. Unless the emulated data cache prevents it, the
+// memory is read directly and the chunks are spread across multiple threads.
+template <typename Func>
+static void ForEachChunk(const Core::CPUThreadGuard& guard,
+                         const std::vector<Cheats::SlotRange>& slot_ranges,
+                         const std::vector<SearchChunk>& chunks,
+                         PowerPC::RequestedAddressSpace address_space, u32 data_size, Func func)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache)
+  {
+    // The data cache may hold values that haven't been written back to RAM yet
+    const MMUReader reader(guard, address_space);
+    for (size_t i = 0; i < chunks.size(); ++i)
+      func(reader, i);
+    return;
+  }
+
+  auto& memory = system.GetMemory();
+  auto& mmu = system.GetMMU();
+  const bool translate =
+      address_space != PowerPC::RequestedAddressSpace::Physical && ppc_state.msr.DR;
+  const auto lookup_page = [&](u32 page) -> const u8* {
+    const std::optional<u32> physical_address =
+        translate ? mmu.GetTranslatedAddress(page) : std::optional<u32>(page);
+    return physical_address ? GetHostPointerForPhysicalAddress(memory, *physical_address) :
+                              nullptr;
+  };
+  ForEachChunkInHostMemory(lookup_page, slot_ranges, chunks, data_size, std::move(func));
+}
+
+// Calls func with the given comparison as a function object, so that it can be inlined into the
+// search loops.
+template <typename T, typename Func>
+static void WithComparison(Cheats::CompareType op, Func func)
+{
+  switch (op)
+  {
+  case Cheats::CompareType::Equal:
+    return func(std::equal_to<T>());
+  case Cheats::CompareType::NotEqual:
+    return func(std::not_equal_to<T>());
+  case Cheats::CompareType::Less:
+    return func(std::less<T>());
+  case Cheats::CompareType::LessOrEqual:
+    return func(std::less_equal<T>());
+  case Cheats::CompareType::Greater:
+    return func(std::greater<T>());
+  case Cheats::CompareType::GreaterOrEqual:
+    return func(std::greater_equal<T>());
+  default:
+    DEBUG_ASSERT(false);
+    return;
+  }
+}
+
+template <typename T, u32 step, typename Reader, typename Validator>
+static void NewSearchWords(const Reader& reader, const Cheats::SlotRange& range,
+                           const SearchChunk& chunk, const Validator& validator,
+                           Cheats::SlotBitmap& candidates, std::vector<T>& values)
+{
+  for (size_t word = chunk.m_first_word; word < chunk.m_end_word; ++word)
+  {
+    const u64 first_slot = word * 64 - range.m_first_slot;
+    const u32 slot_count = static_cast<u32>(std::min<u64>(64, range.m_slot_count - first_slot));
+    const u32 address = range.m_start_address + static_cast<u32>(first_slot * step);
+
+    u64 bits = 0;
+    if (const u8* ptr = reader.GetPointer(address, (slot_count - 1) * step + sizeof(T)))
     {
-      if (range.m_length < data_size)
-        continue;
+      // Kept free of branches and lookups so that the compiler can vectorize it
+      for (u32 i = 0; i < slot_count; ++i)
+        bits |= u64{validator(ReadBigEndian<T>(ptr + i * step))} << i;
+
+      for (u64 remaining = bits; remaining != 0; remaining &= remaining - 1)
+        values.push_back(ReadBigEndian<T>(ptr + std::countr_zero(remaining) * step));
+    }
+    else
+    {
+      for (u32 i = 0; i < slot_count; ++i)
+      {
+        const std::optional<T> value = reader.template Read<T>(address + i * step);
+        if (value && validator(*value))
+        {
+          bits |= u64{1} << i;
+          values.push_back(*value);
+        }
+      }
+    }
 
-      const u32 increment_per_loop = aligned ? data_size : 1;
-      const u32 start_address = aligned ? Common::AlignUp(range.m_start, data_size) : range.m_start;
-      const u64 aligned_length = range.m_length - (start_address - range.m_start);
+    candidates.SetWord(word, bits);
+  }
+}
 
-      if (aligned_length < data_size)
+template <typename T, u32 step, typename Reader, typename Validator>
+static void NextSearchWords(const Reader& reader, const Cheats::SlotRange& range,
+                            const SearchChunk& chunk,
+                            const Cheats::SearchResults<T>& previous_results,
+                            const Validator& validator, Cheats::SlotBitmap& candidates,
+                            Cheats::SlotBitmap& inaccessible, std::vector<T>& values)
+{
+  size_t index = previous_results.m_candidates.Rank(chunk.m_first_word * 64);
+  for (size_t word = chunk.m_first_word; word < chunk.m_end_word; ++word)
+  {
+    u64 previous_bits = previous_results.m_candidates.GetWord(word);
+    if (previous_bits == 0)
+      continue;
+
+    const u64 first_slot = word * 64 - range.m_first_slot;
+    const u32 slot_count = static_cast<u32>(std::min<u64>(64, range.m_slot_count - first_slot));
+    const u32 address = range.m_start_address + static_cast<u32>(first_slot * step);
+    const u8* ptr = reader.GetPointer(address, (slot_count - 1) * step + sizeof(T));
+
+    u64 bits = 0;
+    u64 inaccessible_bits = 0;
+    for (; previous_bits != 0; previous_bits &= previous_bits - 1, ++index)
+    {
+      const u32 i = std::countr_zero(previous_bits);
+      const u64 bit = u64{1} << i;
+      const std::optional<T> value = ptr ? std::optional<T>(ReadBigEndian<T>(ptr + i * step)) :
+                                           reader.template Read<T>(address + i * step);
+      if (!value)
+      {
+        bits |= bit;
+        inaccessible_bits |= bit;
+        values.push_back(T(0));
         continue;
+      }
 
-      const u64 length = aligned_length - (data_size - 1);
-      for (u64 i = 0; i < length; i += increment_per_loop)
+      // if the previous state was invalid we always update the value to avoid getting stuck in an
+      // invalid state
+      if (previous_results.m_inaccessible.Test(word * 64 + i) ||
+          validator(*value, previous_results.m_values[index]))
       {
-        const u32 addr = start_address + i;
-        const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
-        if (!current_value)
-          continue;
+        bits |= bit;
+        values.push_back(*value);
+      }
+    }
 
-        if (validator(current_value->value))
-        {
-          auto& r = results.emplace_back();
-          r.m_value = current_value->value;
-          r.m_value_state = current_value->translated ?
-                                Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                                Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-          r.m_address = addr;
-        }
+    candidates.SetWord(word, bits);
+    inaccessible.SetWord(word, inaccessible_bits);
+  }
+}
+
+static std::optional<Cheats::SearchErrorCode>
+CheckSearchPreconditions(const Core::CPUThreadGuard& guard,
+                         PowerPC::RequestedAddressSpace address_space)
+{
+  const Core::State core_state = Core::GetState();
+  if (core_state != Core::State::Running && core_state != Core::State::Paused)
+    return Cheats::SearchErrorCode::NoEmulationActive;
+
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
+    return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
+
+  return std::nullopt;
+}
+
+static bool IsTranslated(const Core::CPUThreadGuard& guard,
+                         PowerPC::RequestedAddressSpace address_space)
+{
+  switch (address_space)
+  {
+  case PowerPC::RequestedAddressSpace::Effective:
+    return guard.GetSystem().GetPPCState().msr.DR;
+  case PowerPC::RequestedAddressSpace::Virtual:
+    return true;
+  default:
+    return false;
+  }
+}
+
+template <typename T>
+static std::vector<T> ConcatenateChunkValues(std::vector<std::vector<T>>& chunk_values)
+{
+  size_t count = 0;
+  for (const std::vector<T>& values : chunk_values)
+    count += values.size();
+
+  std::vector<T> result;
+  result.reserve(count);
+  for (std::vector<T>& values : chunk_values)
+  {
+    result.insert(result.end(), values.begin(), values.end());
+    values = {};
+  }
+  return result;
+}
+
+// Runs a new search, with for_each_chunk(slot_ranges, chunks, func) calling func(reader, chunk)
+// for every chunk.
+template <typename T, typename ForEachChunkFunc>
+static void RunNewSearch(const ForEachChunkFunc& for_each_chunk,
+                         const std::vector<Cheats::MemoryRange>& memory_ranges, bool aligned,
+                         const Cheats::SearchFilter<T>& filter, Cheats::SearchResults<T>& results)
+{
+  results.m_slot_ranges = MakeSlotRanges(memory_ranges, sizeof(T), aligned);
+  results.m_candidates = Cheats::SlotBitmap(GetSlotCount(results.m_slot_ranges));
+
+  const std::vector<SearchChunk> chunks = MakeChunks(results.m_slot_ranges);
+  std::vector<std::vector<T>> chunk_values(chunks.size());
+  const auto search = [&](const auto& validator) {
+    for_each_chunk(results.m_slot_ranges, chunks, [&](const auto& reader, size_t i) {
+      const Cheats::SlotRange& range = results.m_slot_ranges[chunks[i].m_range];
+      if (range.m_step == 1)
+      {
+        NewSearchWords<T, 1>(reader, range, chunks[i], validator, results.m_candidates,
+                             chunk_values[i]);
+      }
+      else
+      {
+        NewSearchWords<T, sizeof(T)>(reader, range, chunks[i], validator, results.m_candidates,
+                                     chunk_values[i]);
       }
+    });
+  };
+
+  if (filter.m_filter_type == Cheats::FilterType::CompareAgainstSpecificValue)
+  {
+    WithComparison<T>(filter.m_compare_type, [&](auto compare) {
+      search([compare, value = filter.m_value](const T& v) { return compare(v, value); });
+    });
+  }
+  else
+  {
+    search([](const T& v) { return true; });
+  }
+
+  results.m_values = ConcatenateChunkValues(chunk_values);
+  results.m_candidates.UpdateIndex();
+  ASSERT(results.m_candidates.Count() == results.m_values.size());
+}
+
+// Runs a next search, with for_each_chunk(slot_ranges, chunks, func) calling func(reader, chunk)
+// for every chunk.
+template <typename T, typename ForEachChunkFunc>
+static void RunNextSearch(const ForEachChunkFunc& for_each_chunk,
+                          const Cheats::SearchResults<T>& previous_results,
+                          const Cheats::SearchFilter<T>& filter, Cheats::SearchResults<T>& results)
+{
+  const u64 slot_count = GetSlotCount(previous_results.m_slot_ranges);
+  results.m_slot_ranges = previous_results.m_slot_ranges;
+  results.m_candidates = Cheats::SlotBitmap(slot_count);
+  results.m_inaccessible = Cheats::SlotBitmap(slot_count);
+
+  const std::vector<SearchChunk> chunks = MakeChunks(results.m_slot_ranges);
+  std::vector<std::vector<T>> chunk_values(chunks.size());
+  const auto search = [&](const auto& validator) {
+    for_each_chunk(results.m_slot_ranges, chunks, [&](const auto& reader, size_t i) {
+      const Cheats::SlotRange& range = results.m_slot_ranges[chunks[i].m_range];
+      if (range.m_step == 1)
+      {
+        NextSearchWords<T, 1>(reader, range, chunks[i], previous_results, validator,
+                              results.m_candidates, results.m_inaccessible, chunk_values[i]);
+      }
+      else
+      {
+        NextSearchWords<T, sizeof(T)>(reader, range, chunks[i], previous_results, validator,
+                                      results.m_candidates, results.m_inaccessible,
+                                      chunk_values[i]);
+      }
+    });
+  };
+
+  if (filter.m_filter_type == Cheats::FilterType::CompareAgainstSpecificValue)
+  {
+    WithComparison<T>(filter.m_compare_type, [&](auto compare) {
+      search([compare, value = filter.m_value](const T& new_value, const T& old_value) {
+        return compare(new_value, value);
+      });
+    });
+  }
+  else if (filter.m_filter_type == Cheats::FilterType::CompareAgainstLastValue)
+  {
+    WithComparison<T>(filter.m_compare_type, [&](auto compare) {
+      search([compare](const T& new_value, const T& old_value) {
+        return compare(new_value, old_value);
+      });
+    });
+  }
+  else
+  {
+    search([](const T& new_value, const T& old_value) { return true; });
+  }
+
+  results.m_values = ConcatenateChunkValues(chunk_values);
+  results.m_candidates.UpdateIndex();
+  results.m_inaccessible.UpdateIndex();
+  if (results.m_inaccessible.Count() == 0)
+    results.m_inaccessible = {};
+  ASSERT(results.m_candidates.Count() == results.m_values.size());
+}
+
+template <typename T>
+Common::Result<Cheats::SearchErrorCode, Cheats::SearchResults<T>>
+Cheats::NewSearch(const Core::CPUThreadGuard& guard,
+                  const std::vector<Cheats::MemoryRange>& memory_ranges,
+                  PowerPC::RequestedAddressSpace address_space, bool aligned,
+                  const Cheats::SearchFilter<T>& filter)
+{
+  if (filter.m_filter_type == Cheats::FilterType::CompareAgainstLastValue)
+    return Cheats::SearchErrorCode::InvalidParameters;
+
+  Cheats::SearchResults<T> results;
+  Cheats::SearchErrorCode error_code = Cheats::SearchErrorCode::Success;
+  Core::RunAsCPUThread([&] {
+    if (const auto error = CheckSearchPreconditions(guard, address_space))
+    {
+      error_code = *error;
+      return;
     }
+
+    const auto for_each_chunk = [&](const auto& slot_ranges, const auto& chunks, auto func) {
+      ForEachChunk(guard, slot_ranges, chunks, address_space, sizeof(T), std::move(func));
+    };
+    RunNewSearch(for_each_chunk, memory_ranges, aligned, filter, results);
+    results.m_values_translated = IsTranslated(guard, address_space);
   });
   if (error_code == Cheats::SearchErrorCode::Success)
     return results;
@@ -263,61 +823,61 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
 }
 
 template <typename T>
-Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+Common::Result<Cheats::SearchErrorCode, Cheats::SearchResults<T>>
 Cheats::NextSearch(const Core::CPUThreadGuard& guard,
-                   const std::vector<Cheats::SearchResult<T>>& previous_results,
+                   const Cheats::SearchResults<T>& previous_results,
                    PowerPC::RequestedAddressSpace address_space,
-                   const std::function<bool(const T& new_value, const T& old_value)>& validator)
+                   const Cheats::SearchFilter<T>& filter)
 {
-  std::vector<Cheats::SearchResult<T>> results;
+  Cheats::SearchResults<T> results;
   Cheats::SearchErrorCode error_code = Cheats::SearchErrorCode::Success;
   Core::RunAsCPUThread([&] {
-    const Core::State core_state = Core::GetState();
-    if (core_state != Core::State::Running && core_state != Core::State::Paused)
+    if (const auto error = CheckSearchPreconditions(guard, address_space))
     {
-      error_code = Cheats::SearchErrorCode::NoEmulationActive;
+      error_code = *error;
       return;
     }
 
-    auto& system = Core::System::GetInstance();
-    auto& ppc_state = system.GetPPCState();
-    if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
-    {
-      error_code = Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
-      return;
-    }
-
-    for (const auto& previous_result : previous_results)
-    {
-      const u32 addr = previous_result.m_address;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
-      if (!current_value)
-      {
-        auto& r = results.emplace_back();
-        r.m_address = addr;
-        r.m_value_state = Cheats::SearchResultValueState::AddressNotAccessible;
-        continue;
-      }
-
-      // if the previous state was invalid we always update the value to avoid getting stuck in an
-      // invalid state
-      if (!previous_result.IsValueValid() ||
-          validator(current_value->value, previous_result.m_value))
-      {
-        auto& r = results.emplace_back();
-        r.m_value = current_value->value;
-        r.m_value_state = current_value->translated ?
-                              Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                              Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-        r.m_address = addr;
-      }
-    }
+    const auto for_each_chunk = [&](const auto& slot_ranges, const auto& chunks, auto func) {
+      ForEachChunk(guard, slot_ranges, chunks, address_space, sizeof(T), std::move(func));
+    };
+    RunNextSearch(for_each_chunk, previous_results, filter, results);
+    results.m_values_translated = IsTranslated(guard, address_space);
   });
   if (error_code == Cheats::SearchErrorCode::Success)
     return results;
   return error_code;
 }
 
+template <typename T>
+Cheats::SearchResults<T>
+Cheats::NewSearchInHostMemory(const HostPageLookup& lookup_page,
+                              const std::vector<MemoryRange>& memory_ranges, bool aligned,
+                              const SearchFilter<T>& filter)
+{
+  DEBUG_ASSERT(filter.m_filter_type != FilterType::CompareAgainstLastValue);
+
+  Cheats::SearchResults<T> results;
+  const auto for_each_chunk = [&](const auto& slot_ranges, const auto& chunks, auto func) {
+    ForEachChunkInHostMemory(lookup_page, slot_ranges, chunks, sizeof(T), std::move(func));
+  };
+  RunNewSearch(for_each_chunk, memory_ranges, aligned, filter, results);
+  return results;
+}
+
+template <typename T>
+Cheats::SearchResults<T> Cheats::NextSearchInHostMemory(const HostPageLookup& lookup_page,
+                                                        const SearchResults<T>& previous_results,
+                                                        const SearchFilter<T>& filter)
+{
+  Cheats::SearchResults<T> results;
+  const auto for_each_chunk = [&](const auto& slot_ranges, const auto& chunks, auto func) {
+    ForEachChunkInHostMemory(lookup_page, slot_ranges, chunks, sizeof(T), std::move(func));
+  };
+  RunNextSearch(for_each_chunk, previous_results, filter, results);
+  return results;
+}
+
 Cheats::CheatSearchSessionBase::~CheatSearchSessionBase() = default;
 
 template <typename T>
@@ -390,100 +950,22 @@ template <typename T>
 void Cheats::CheatSearchSession<T>::ResetResults()
 {
   m_first_search_done = false;
-  m_search_results.clear();
-}
-
-template <typename T>
-static std::function<bool(const T& new_value)>
-MakeCompareFunctionForSpecificValue(Cheats::CompareType op, const T& old_value)
-{
-  switch (op)
-  {
-  case Cheats::CompareType::Equal:
-    return [&](const T& new_value) { return new_value == old_value; };
-  case Cheats::CompareType::NotEqual:
-    return [&](const T& new_value) { return new_value != old_value; };
-  case Cheats::CompareType::Less:
-    return [&](const T& new_value) { return new_value < old_value; };
-  case Cheats::CompareType::LessOrEqual:
-    return [&](const T& new_value) { return new_value <= old_value; };
-  case Cheats::CompareType::Greater:
-    return [&](const T& new_value) { return new_value > old_value; };
-  case Cheats::CompareType::GreaterOrEqual:
-    return [&](const T& new_value) { return new_value >= old_value; };
-  default:
-    DEBUG_ASSERT(false);
-    return nullptr;
-  }
-}
-
-template <typename T>
-static std::function<bool(const T& old_value, const T& new_value)>
-MakeCompareFunctionForLastValue(Cheats::CompareType op)
-{
-  switch (op)
-  {
-  case Cheats::CompareType::Equal:
-    return [](const T& new_value, const T& old_value) { return new_value == old_value; };
-  case Cheats::CompareType::NotEqual:
-    return [](const T& new_value, const T& old_value) { return new_value != old_value; };
-  case Cheats::CompareType::Less:
-    return [](const T& new_value, const T& old_value) { return new_value < old_value; };
-  case Cheats::CompareType::LessOrEqual:
-    return [](const T& new_value, const T& old_value) { return new_value <= old_value; };
-  case Cheats::CompareType::Greater:
-    return [](const T& new_value, const T& old_value) { return new_value > old_value; };
-  case Cheats::CompareType::GreaterOrEqual:
-    return [](const T& new_value, const T& old_value) { return new_value >= old_value; };
-  default:
-    DEBUG_ASSERT(false);
-    return nullptr;
-  }
+  m_search_results = {};
 }
 
 template <typename T>
 Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPUThreadGuard& guard)
 {
-  Common::Result<SearchErrorCode, std::vector<SearchResult<T>>> result =
-      Cheats::SearchErrorCode::InvalidParameters;
-  if (m_filter_type == FilterType::CompareAgainstSpecificValue)
-  {
-    if (!m_value)
-      return Cheats::SearchErrorCode::InvalidParameters;
-
-    auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
-    if (m_first_search_done)
-    {
-      result = Cheats::NextSearch<T>(
-          guard, m_search_results, m_address_space,
-          [&func](const T& new_value, const T& old_value) { return func(new_value); });
-    }
-    else
-    {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, func);
-    }
-  }
-  else if (m_filter_type == FilterType::CompareAgainstLastValue)
-  {
-    if (!m_first_search_done)
-      return Cheats::SearchErrorCode::InvalidParameters;
+  if (m_filter_type == FilterType::CompareAgainstSpecificValue && !m_value)
+    return Cheats::SearchErrorCode::InvalidParameters;
+  if (m_filter_type == FilterType::CompareAgainstLastValue && !m_first_search_done)
+    return Cheats::SearchErrorCode::InvalidParameters;
 
-    result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                   MakeCompareFunctionForLastValue<T>(m_compare_type));
-  }
-  else if (m_filter_type == FilterType::DoNotFilter)
-  {
-    if (m_first_search_done)
-    {
-      result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                     [](const T& v1, const T& v2) { return true; });
-    }
-    else
-    {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
-                                    [](const T& v) { return true; });
-    }
-  }
+  const SearchFilter<T> filter{m_filter_type, m_compare_type, m_value.value_or(T(0))};
+  Common::Result<SearchErrorCode, SearchResults<T>> result =
+      m_first_search_done ?
+          Cheats::NextSearch<T>(guard, m_search_results, m_address_space, filter) :
+          Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, filter);
 
   if (result.Succeeded())
   {
@@ -540,38 +1022,31 @@ bool Cheats::CheatSearchSession<T>::IsFloatingType() const
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetResultCount() const
 {
-  return m_search_results.size();
+  return m_search_results.GetCount();
 }
 
 template <typename T>
 size_t Cheats::CheatSearchSession<T>::GetValidValueCount() const
 {
-  const auto& results = m_search_results;
-  size_t count = 0;
-  for (const auto& r : results)
-  {
-    if (r.IsValueValid())
-      ++count;
-  }
-  return count;
+  return m_search_results.GetCount() - m_search_results.m_inaccessible.Count();
 }
 
 template <typename T>
 u32 Cheats::CheatSearchSession<T>::GetResultAddress(size_t index) const
 {
-  return m_search_results[index].m_address;
+  return m_search_results.GetAddress(index);
 }
 
 template <typename T>
 T Cheats::CheatSearchSession<T>::GetResultValue(size_t index) const
 {
-  return m_search_results[index].m_value;
+  return m_search_results.m_values[index];
 }
 
 template <typename T>
 Cheats::SearchValue Cheats::CheatSearchSession<T>::GetResultValueAsSearchValue(size_t index) const
 {
-  return Cheats::SearchValue{m_search_results[index].m_value};
+  return Cheats::SearchValue{m_search_results.m_values[index]};
 }
 
 template <typename T>
@@ -583,21 +1058,21 @@ std::string Cheats::CheatSearchSession<T>::GetResultValueAsString(size_t index,
   if (hex)
   {
     if constexpr (std::is_same_v<T, float>)
-      return fmt::format("0x{0:08x}", Common::BitCast<u32>(m_search_results[index].m_value));
+      return fmt::format("0x{0:08x}", Common::BitCast<u32>(m_search_results.m_values[index]));
     else if constexpr (std::is_same_v<T, double>)
-      return fmt::format("0x{0:016x}", Common::BitCast<u64>(m_search_results[index].m_value));
+      return fmt::format("0x{0:016x}", Common::BitCast<u64>(m_search_results.m_values[index]));
     else
-      return fmt::format("0x{0:0{1}x}", m_search_results[index].m_value, sizeof(T) * 2);
+      return fmt::format("0x{0:0{1}x}", m_search_results.m_values[index], sizeof(T) * 2);
   }
 
-  return fmt::format("{}", m_search_results[index].m_value);
+  return fmt::format("{}", m_search_results.m_values[index]);
 }
 
 template <typename T>
 Cheats::SearchResultValueState
 Cheats::CheatSearchSession<T>::GetResultValueState(size_t index) const
 {
-  return m_search_results[index].m_value_state;
+  return m_search_results.GetValueState(index);
 }
 
 template <typename T>
@@ -617,10 +1092,31 @@ std::unique_ptr<Cheats::CheatSearchSessionBase>
 Cheats::CheatSearchSession<T>::ClonePartial(const std::vector<size_t>& result_indices) const
 {
   const auto& results = m_search_results;
-  std::vector<SearchResult<T>> partial_results;
-  partial_results.reserve(result_indices.size());
-  for (size_t idx : result_indices)
-    partial_results.push_back(results[idx]);
+  std::vector<size_t> sorted_indices = result_indices;
+  std::sort(sorted_indices.begin(), sorted_indices.end());
+  sorted_indices.erase(std::unique(sorted_indices.begin(), sorted_indices.end()),
+                       sorted_indices.end());
+
+  const u64 slot_count = GetSlotCount(results.m_slot_ranges);
+  SearchResults<T> partial_results;
+  partial_results.m_slot_ranges = results.m_slot_ranges;
+  partial_results.m_candidates = SlotBitmap(slot_count);
+  partial_results.m_values_translated = results.m_values_translated;
+  partial_results.m_values.reserve(sorted_indices.size());
+  for (size_t idx : sorted_indices)
+  {
+    const u64 slot = results.m_candidates.Select(idx);
+    partial_results.m_candidates.Set(slot);
+    if (results.m_inaccessible.Test(slot))
+    {
+      if (partial_results.m_inaccessible.GetWordCount() == 0)
+        partial_results.m_inaccessible = SlotBitmap(slot_count);
+      partial_results.m_inaccessible.Set(slot);
+    }
+    partial_results.m_values.push_back(results.m_values[idx]);
+  }
+  partial_results.m_candidates.UpdateIndex();
+  partial_results.m_inaccessible.UpdateIndex();
 
   auto c =
       std::make_unique<Cheats::CheatSearchSession<T>>(m_memory_ranges, m_address_space, m_aligned);
@@ -632,6 +1128,17 @@ Cheats::CheatSearchSession<T>::ClonePartial(const std::vector<size_t>& result_in
   return c;
 }
 
+template struct Cheats::SearchResults<u8>;
+template struct Cheats::SearchResults<u16>;
+template struct Cheats::SearchResults<u32>;
+template struct Cheats::SearchResults<u64>;
+template struct Cheats::SearchResults<s8>;
+template struct Cheats::SearchResults<s16>;
+template struct Cheats::SearchResults<s32>;
+template struct Cheats::SearchResults<s64>;
+template struct Cheats::SearchResults<float>;
+template struct Cheats::SearchResults<double>;
+
 template class Cheats::CheatSearchSession<u8>;
 template class Cheats::CheatSearchSession<u16>;
 template class Cheats::CheatSearchSession<u32>;
@@ -643,6 +1150,67 @@ template class Cheats::CheatSearchSession<s64>;
 template class Cheats::CheatSearchSession<float>;
 template class Cheats::CheatSearchSession<double>;
 
+template Cheats::SearchResults<u8>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<u8>&);
+template Cheats::SearchResults<u8>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<u8>&,
+                               const SearchFilter<u8>&);
+template Cheats::SearchResults<u16>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<u16>&);
+template Cheats::SearchResults<u16>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<u16>&,
+                               const SearchFilter<u16>&);
+template Cheats::SearchResults<u32>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<u32>&);
+template Cheats::SearchResults<u32>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<u32>&,
+                               const SearchFilter<u32>&);
+template Cheats::SearchResults<u64>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<u64>&);
+template Cheats::SearchResults<u64>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<u64>&,
+                               const SearchFilter<u64>&);
+template Cheats::SearchResults<s8>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<s8>&);
+template Cheats::SearchResults<s8>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<s8>&,
+                               const SearchFilter<s8>&);
+template Cheats::SearchResults<s16>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<s16>&);
+template Cheats::SearchResults<s16>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<s16>&,
+                               const SearchFilter<s16>&);
+template Cheats::SearchResults<s32>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<s32>&);
+template Cheats::SearchResults<s32>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<s32>&,
+                               const SearchFilter<s32>&);
+template Cheats::SearchResults<s64>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<s64>&);
+template Cheats::SearchResults<s64>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<s64>&,
+                               const SearchFilter<s64>&);
+template Cheats::SearchResults<float>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<float>&);
+template Cheats::SearchResults<float>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<float>&,
+                               const SearchFilter<float>&);
+template Cheats::SearchResults<double>
+Cheats::NewSearchInHostMemory(const HostPageLookup&, const std::vector<MemoryRange>&, bool,
+                              const SearchFilter<double>&);
+template Cheats::SearchResults<double>
+Cheats::NextSearchInHostMemory(const HostPageLookup&, const SearchResults<double>&,
+                               const SearchFilter<double>&);
+
 std::unique_ptr<Cheats::CheatSearchSessionBase>
 Cheats::MakeSession(std::vector<MemoryRange> memory_ranges,
                     PowerPC::RequestedAddressSpace address_space, bool aligned, DataType data_type)
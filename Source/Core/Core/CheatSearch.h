@@ -64,20 +64,6 @@ enum class SearchResultValueState : u8
   AddressNotAccessible,
 };
 
-template <typename T>
-struct SearchResult
-{
-  T m_value;
-  SearchResultValueState m_value_state;
-  u32 m_address;
-
-  bool IsValueValid() const
-  {
-    return m_value_state == SearchResultValueState::ValueFromPhysicalMemory ||
-           m_value_state == SearchResultValueState::ValueFromVirtualMemory;
-  }
-};
-
 struct MemoryRange
 {
   u32 m_start;
@@ -86,6 +72,77 @@ struct MemoryRange
   MemoryRange(u32 start, u64 length) : m_start(start), m_length(length) {}
 };
 
+// A set of search slots, stored as one bit per slot. After the bits have been modified,
+// UpdateIndex() has to be called before Count(), Rank() or Select() can be used.
+class SlotBitmap
+{
+public:
+  SlotBitmap() = default;
+  explicit SlotBitmap(u64 slot_count);
+
+  size_t GetWordCount() const { return m_words.size(); }
+  u64 GetWord(size_t index) const { return m_words[index]; }
+  // Different words may be set from different threads at the same time.
+  void SetWord(size_t index, u64 bits) { m_words[index] = bits; }
+
+  bool Test(u64 slot) const;
+  void Set(u64 slot);
+
+  void UpdateIndex();
+
+  // Returns the number of set slots.
+  size_t Count() const;
+  // Returns the number of set slots before the given slot.
+  size_t Rank(u64 slot) const;
+  // Returns the index-th set slot.
+  u64 Select(size_t index) const;
+
+private:
+  static constexpr size_t WORDS_PER_BLOCK = 8;
+
+  std::vector<u64> m_words;
+  // For every block of WORDS_PER_BLOCK words, the number of set slots before it.
+  std::vector<u64> m_block_ranks;
+};
+
+// A memory range that was searched, split into slots that can each hold one value. Each range
+// starts at a multiple of 64 slots, so that no bitmap word is shared between ranges.
+struct SlotRange
+{
+  u32 m_start_address;
+  u32 m_step;
+  u64 m_slot_count;
+  u64 m_first_slot;
+};
+
+// The addresses found by a search. Since a new search over all of RAM can easily match tens of
+// millions of addresses, they are stored as a bitmap of slots rather than one record each.
+template <typename T>
+struct SearchResults
+{
+  std::vector<SlotRange> m_slot_ranges;
+  // The slots that passed all searches so far.
+  SlotBitmap m_candidates;
+  // The candidates that couldn't be read during the last search. Empty if there are none.
+  SlotBitmap m_inaccessible;
+  // The last value read for each candidate, in slot order. Zero for inaccessible candidates.
+  std::vector<T> m_values;
+  bool m_values_translated = false;
+
+  size_t GetCount() const { return m_values.size(); }
+  u32 GetAddress(size_t index) const;
+  SearchResultValueState GetValueState(size_t index) const;
+};
+
+template <typename T>
+struct SearchFilter
+{
+  FilterType m_filter_type;
+  CompareType m_compare_type;
+  // Only used for FilterType::CompareAgainstSpecificValue.
+  T m_value;
+};
+
 enum class SearchErrorCode
 {
   Success,
@@ -110,20 +167,34 @@ DataType GetDataType(const SearchValue& value);
 std::vector<u8> GetValueAsByteVector(const SearchValue& value);
 
 // Do a new search across the given memory region in the given address space, only keeping values
-// for which the given validator returns true.
+// that pass the given filter.
 template <typename T>
-Common::Result<SearchErrorCode, std::vector<SearchResult<T>>>
+Common::Result<SearchErrorCode, SearchResults<T>>
 NewSearch(const Core::CPUThreadGuard& guard, const std::vector<MemoryRange>& memory_ranges,
-          PowerPC::RequestedAddressSpace address_space, bool aligned,
-          const std::function<bool(const T& value)>& validator);
+          PowerPC::RequestedAddressSpace address_space, bool aligned, const SearchFilter<T>& filter);
 
-// Refresh the values for the given results in the given address space, only keeping values for
-// which the given validator returns true.
+// Refresh the values for the given results in the given address space, only keeping values that
+// pass the given filter.
+template <typename T>
+Common::Result<SearchErrorCode, SearchResults<T>>
+NextSearch(const Core::CPUThreadGuard& guard, const SearchResults<T>& previous_results,
+           PowerPC::RequestedAddressSpace address_space, const SearchFilter<T>& filter);
+
+// Returns the host memory that backs the page (of PowerPC::HW_PAGE_SIZE bytes) at the given
+// address, or nullptr if the page isn't accessible.
+using HostPageLookup = std::function<const u8*(u32 page_address)>;
+
+// The direct memory scans that NewSearch and NextSearch use when the data cache isn't emulated,
+// for memory that is looked up through lookup_page. Values that aren't fully accessible are
+// skipped by NewSearchInHostMemory and marked as inaccessible by NextSearchInHostMemory.
+template <typename T>
+SearchResults<T> NewSearchInHostMemory(const HostPageLookup& lookup_page,
+                                       const std::vector<MemoryRange>& memory_ranges, bool aligned,
+                                       const SearchFilter<T>& filter);
 template <typename T>
-Common::Result<SearchErrorCode, std::vector<SearchResult<T>>>
-NextSearch(const Core::CPUThreadGuard& guard, const std::vector<SearchResult<T>>& previous_results,
-           PowerPC::RequestedAddressSpace address_space,
-           const std::function<bool(const T& new_value, const T& old_value)>& validator);
+SearchResults<T> NextSearchInHostMemory(const HostPageLookup& lookup_page,
+                                        const SearchResults<T>& previous_results,
+                                        const SearchFilter<T>& filter);
 
 class CheatSearchSessionBase
 {
@@ -214,7 +285,7 @@ public:
   ClonePartial(const std::vector<size_t>& result_indices) const override;
 
 private:
-  std::vector<SearchResult<T>> m_search_results;
+  SearchResults<T> m_search_results;
   std::vector<MemoryRange> m_memory_ranges;
   PowerPC::RequestedAddressSpace m_address_space;
   CompareType m_compare_type = CompareType::Equal;
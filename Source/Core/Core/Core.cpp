@@ -62,6 +62,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -174,6 +175,8 @@ void FrameUpdateOnCPUThread()
 
 void OnFrameEnd()
 {
+  ::State::OnFrameEnd();
+
 #ifdef USE_MEMORYWATCHER
   if (s_memory_watcher)
   {
@@ -447,6 +450,9 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
 
   s_is_started = false;
 
+  // Writes to guest RAM can't be caught anymore once the handler is gone.
+  system.GetMemory().DisableDirtyTracking();
+
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
@@ -683,6 +689,9 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   if (Config::Get(Config::MAIN_CPU_CORE) != PowerPC::CPUCore::Interpreter)
   {
     system.GetPowerPC().SetMode(PowerPC::CoreMode::JIT);
+
+    CPUThreadGuard guard(system);
+    system.GetJitInterface().PrecompileCachedBlocks(guard);
   }
   else
   {
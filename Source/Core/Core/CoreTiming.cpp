@@ -14,11 +14,11 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
 
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -115,7 +115,6 @@ void CoreTimingManager::Init()
 
 void CoreTimingManager::Shutdown()
 {
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -140,7 +139,10 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
+  // Events that other threads schedule from here on get moved relative to the loaded timer
+  if (p.IsReadMode())
+    m_state_epoch.fetch_add(1, std::memory_order_relaxed);
+
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -198,6 +200,9 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
     ResetThrottle(m_globals.global_timer);
+
+    // Events scheduled after this are based on the loaded timer
+    m_state_epoch.fetch_add(1, std::memory_order_release);
   }
 }
 
@@ -263,8 +268,16 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
-    m_ts_queue.Push(Event{m_globals.global_timer + cycles_into_future, 0, userdata, event_type});
+    // The epoch has to be read first, see m_state_epoch
+    const u32 state_epoch = m_state_epoch.load(std::memory_order_acquire);
+    const ThreadEvent event{m_globals.global_timer + cycles_into_future, cycles_into_future,
+                            userdata, event_type, state_epoch};
+    if (m_ts_overflowing.load(std::memory_order_acquire) || !m_ts_queue.TryPush(event))
+    {
+      std::lock_guard lk(m_ts_overflow_lock);
+      m_ts_overflowing.store(true, std::memory_order_relaxed);
+      m_ts_overflow.push_back(event);
+    }
   }
 }
 
@@ -302,11 +315,40 @@ void CoreTimingManager::ForceExceptionCheck(s64 cycles)
 
 void CoreTimingManager::MoveEvents()
 {
-  for (Event ev; m_ts_queue.Pop(ev);)
+  const size_t old_size = m_event_queue.size();
+  const u32 state_epoch = m_state_epoch.load(std::memory_order_relaxed);
+  const auto add_event = [&](const ThreadEvent& ev) {
+    s64 time = ev.time;
+    if (ev.state_epoch != state_epoch)
+      time = m_globals.global_timer + ev.cycles_into_future;
+    m_event_queue.emplace_back(Event{time, m_event_fifo_id++, ev.userdata, ev.type});
+  };
+
+  for (ThreadEvent ev; m_ts_queue.Pop(ev);)
+    add_event(ev);
+
+  // The overflowed events of a thread come after the ones it pushed into m_ts_queue, so they have
+  // to wait until no push into m_ts_queue is in progress anymore.
+  if (m_ts_overflowing.load(std::memory_order_acquire) && m_ts_queue.Empty())
   {
-    ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    std::lock_guard lk(m_ts_overflow_lock);
+    for (const ThreadEvent& ev : m_ts_overflow)
+      add_event(ev);
+    m_ts_overflow.clear();
+    m_ts_overflowing.store(false, std::memory_order_relaxed);
+  }
+
+  // When a burst of events comes in at once, rebuilding the heap is cheaper than sifting up every
+  // new event individually.
+  const size_t new_size = m_event_queue.size();
+  if (new_size - old_size > old_size)
+  {
+    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+  }
+  else
+  {
+    for (size_t i = old_size + 1; i <= new_size; ++i)
+      std::push_heap(m_event_queue.begin(), m_event_queue.begin() + i, std::greater<Event>());
   }
 }
 
@@ -396,11 +438,15 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // Only sleep if we are behind the deadline
   if (time < m_throttle_deadline)
   {
+    // Use the time that would be spent sleeping to recompile blocks that got hot
+    m_system.GetJitInterface().CompileHotBlocks(m_throttle_deadline);
+    const TimePoint time_before_sleep = Clock::now();
+
     std::this_thread::sleep_until(m_throttle_deadline);
 
     // Count amount of time sleeping for analytics
     const TimePoint time_after_sleep = Clock::now();
-    g_perf_metrics.CountThrottleSleep(time_after_sleep - time);
+    g_perf_metrics.CountThrottleSleep(time_after_sleep - time_before_sleep);
   }
 }
 
@@ -16,13 +16,14 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Core/CPUThreadConfigCallback.h"
 
 class PointerWrap;
@@ -169,8 +170,26 @@ private:
   // by the standard adaptor class.
   std::vector<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
-  Common::SPSCQueue<Event, false> m_ts_queue;
+  // An event scheduled from another thread. It only gets its fifo_order once the CPU thread moves
+  // it into m_event_queue.
+  struct ThreadEvent
+  {
+    s64 time;
+    s64 cycles_into_future;
+    u64 userdata;
+    EventType* type;
+    u32 state_epoch;
+  };
+  Common::MPSCQueue<ThreadEvent, 1024> m_ts_queue;
+  // Loading a state changes the global timer, so an event that another thread based on the old
+  // timer is moved relative to the new one instead. DoState increments the epoch before and after
+  // loading, so an event whose epoch doesn't match was scheduled before or during the load.
+  std::atomic<u32> m_state_epoch = 0;
+  // Events scheduled while m_ts_queue is full. Once this isn't empty, every thread schedules into
+  // it until the CPU thread has moved the events, which keeps the order of each thread's events.
+  std::mutex m_ts_overflow_lock;
+  std::vector<ThreadEvent> m_ts_overflow;
+  std::atomic<bool> m_ts_overflowing = false;
 
   float m_last_oc_factor = 0.0f;
 
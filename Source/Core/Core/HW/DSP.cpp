@@ -79,7 +79,7 @@ constexpr int DSP_MAIL_SLICE = 72;
 
 void DSPManager::DoState(PointerWrap& p)
 {
-  if (!m_aram.wii_mode)
+  if (!m_aram.wii_mode && !m_exclude_aram_from_state)
     p.DoArray(m_aram.ptr, m_aram.size);
   p.Do(m_dsp_control);
   p.Do(m_audio_dma);
@@ -604,4 +604,11 @@ u8* DSPManager::GetARAMPtr() const
   return m_aram.ptr;
 }
 
+std::span<u8> DSPManager::GetDedicatedARAM() const
+{
+  if (m_aram.wii_mode)
+    return {};
+  return {m_aram.ptr, m_aram.size};
+}
+
 }  // end of namespace DSP
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "Common/CommonTypes.h"
 
@@ -98,6 +99,11 @@ public:
   // Debugger Helper
   u8* GetARAMPtr() const;
 
+  // Rewind stores ARAM outside of the savestate, so it can diff it on its own. On Wii, ARAM is
+  // part of MEM2 and GetDedicatedARAM returns an empty span.
+  std::span<u8> GetDedicatedARAM() const;
+  void SetExcludeARAMFromState(bool exclude) { m_exclude_aram_from_state = exclude; }
+
   void UpdateAudioDMA();
   void UpdateDSPSlice(int cycles);
 
@@ -183,6 +189,7 @@ private:
   std::unique_ptr<DSPEmulator> m_dsp_emulator;
 
   bool m_is_lle = false;
+  bool m_exclude_aram_from_state = false;
 
   CoreTiming::EventType* m_event_type_generate_dsp_interrupt = nullptr;
   CoreTiming::EventType* m_event_type_complete_aram = nullptr;
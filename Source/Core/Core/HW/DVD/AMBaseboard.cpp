@@ -448,6 +448,7 @@ u32 ExecuteCommand(u32* DICMDBUF, u32 Address, u32 Length)
 			if( (Offset == 0x00000000) && (Length == 0x80) )
 			{
         m_netcfg->Seek(0, File::SeekOrigin::Begin);
+				memory.PrepareForHostWrite(memory.GetPointer(Address), Length);
 				m_netcfg->ReadBytes( memory.GetPointer(Address), Length );
 				return 0;
 			}
@@ -456,6 +457,7 @@ u32 ExecuteCommand(u32* DICMDBUF, u32 Address, u32 Length)
       if ((Offset == 0x1FFEFFE0) && (Length == 0x20))
       {
         m_extra->Seek(0, File::SeekOrigin::Begin);
+        memory.PrepareForHostWrite(memory.GetPointer(Address), Length);
         m_extra->ReadBytes(memory.GetPointer(Address), Length);
         return 0;
       }      
@@ -464,6 +466,7 @@ u32 ExecuteCommand(u32* DICMDBUF, u32 Address, u32 Length)
 			{
         u32 dimmoffset = Offset - 0x1F000000;
         m_dimm->Seek(dimmoffset, File::SeekOrigin::Begin);
+				memory.PrepareForHostWrite(memory.GetPointer(Address), Length);
 				m_dimm->ReadBytes( memory.GetPointer(Address), Length );
 				return 0;
 			}
@@ -556,6 +559,7 @@ u32 ExecuteCommand(u32* DICMDBUF, u32 Address, u32 Length)
 			{
 				u32 dimmoffset = Offset - 0xFF000000;
         m_dimm->Seek(dimmoffset, File::SeekOrigin::Begin);
+				memory.PrepareForHostWrite(memory.GetPointer(Address), Length);
 				m_dimm->ReadBytes( memory.GetPointer(Address), Length );
 				return 0;
 			}
@@ -563,6 +567,7 @@ u32 ExecuteCommand(u32* DICMDBUF, u32 Address, u32 Length)
 			if( (Offset == 0xFFFF0000) && (Length == 0x20) )
 			{
         m_netctrl->Seek(0, File::SeekOrigin::Begin);
+				memory.PrepareForHostWrite(memory.GetPointer(Address), Length);
 				m_netctrl->ReadBytes( memory.GetPointer(Address), Length );
 				return 0;
 			}
@@ -3,6 +3,8 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -13,6 +15,7 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
@@ -21,6 +24,7 @@
 #include "Common/Thread.h"
 #include "Common/Timer.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -132,6 +136,12 @@ void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   m_disc = std::move(disc);
+
+  if (m_disc)
+  {
+    const u64 budget = u64{Config::Get(Config::MAIN_DISC_READAHEAD_MEMORY_BUDGET)} << 20;
+    m_disc->SetReadaheadMemoryBudget(budget);
+  }
 }
 
 bool DVDThread::HasDisc() const
@@ -332,30 +342,110 @@ void DVDThread::DVDThreadMain()
 {
   Common::SetCurrentThreadName("DVD thread");
 
+  std::deque<ReadRequest> pending;
+
   while (true)
   {
     m_request_queue_expanded.Wait();
 
+    // Requests that have been popped are always finished before exiting, since WaitUntilIdle
+    // only waits for the request queue to be empty before stopping the thread
+    while (true)
+    {
+      ReadRequest request;
+      while (m_request_queue.Pop(request))
+        pending.push_back(std::move(request));
+
+      if (pending.empty())
+        break;
+
+      ProcessReadRequests(pending);
+    }
+
+    // A request that comes in later gets read on its own, even if it continues the last run
+    m_run_length = 0;
+
     if (m_dvd_thread_exiting.IsSet())
       return;
+  }
+}
 
-    ReadRequest request;
-    while (m_request_queue.Pop(request))
+void DVDThread::ProcessReadRequests(std::deque<ReadRequest>& pending)
+{
+  // DVDInterface splits reads into one request per ECC block, so it's common for several requests
+  // for adjacent data to be waiting. Reading them together saves a round trip per block on slow
+  // storage, but none of the merged requests can be finished until the whole read is done. So
+  // the first request of a run is read on its own, and each following read covers as many
+  // requests as have been read in the run so far. The results of a request are then never held
+  // back by more than the requests that come before it.
+  const ReadRequest& first = pending.front();
+  if (first.partition != m_run_partition || first.dvd_offset != m_run_end)
+    m_run_length = 0;
+
+  u32 count = 1;
+  u64 length = first.length;
+  while (count < std::max(m_run_length, 1u) && count < pending.size())
+  {
+    const ReadRequest& next = pending[count];
+    if (next.partition != first.partition || next.dvd_offset != first.dvd_offset + length ||
+        length + next.length > MAX_MERGED_READ_LENGTH)
     {
-      m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
+      break;
+    }
+    length += next.length;
+    ++count;
+  }
 
-      std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+  m_run_partition = first.partition;
+  m_run_end = first.dvd_offset + length;
 
-      request.realtime_done_us = Common::Timer::NowUs();
+  for (u32 i = 0; i < count; ++i)
+    m_file_logger.Log(*m_disc, pending[i].partition, pending[i].dvd_offset);
 
-      m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
-      m_result_queue_expanded.Set();
+  std::vector<u8> buffer(length);
+  const bool success = m_disc->Read(first.dvd_offset, length, buffer.data(), first.partition);
+  const u64 realtime_done_us = Common::Timer::NowUs();
+
+  if (count == 1)
+  {
+    if (!success)
+      buffer.resize(0);
 
-      if (m_dvd_thread_exiting.IsSet())
-        return;
+    PushResult(std::move(pending.front()), std::move(buffer), realtime_done_us);
+  }
+  else if (!success)
+  {
+    // Part of the data might still be readable, so retry the requests one by one
+    for (u32 i = 0; i < count; ++i)
+    {
+      std::vector<u8> single_buffer(pending[i].length);
+      if (!m_disc->Read(pending[i].dvd_offset, pending[i].length, single_buffer.data(),
+                        pending[i].partition))
+      {
+        single_buffer.resize(0);
+      }
+      PushResult(std::move(pending[i]), std::move(single_buffer), Common::Timer::NowUs());
+    }
+  }
+  else
+  {
+    auto data = buffer.cbegin();
+    for (u32 i = 0; i < count; ++i)
+    {
+      std::vector<u8> request_buffer(data, data + pending[i].length);
+      data += pending[i].length;
+      PushResult(std::move(pending[i]), std::move(request_buffer), realtime_done_us);
     }
   }
+
+  pending.erase(pending.begin(), pending.begin() + count);
+  m_run_length = success ? m_run_length + count : 0;
+}
+
+void DVDThread::PushResult(ReadRequest request, std::vector<u8> buffer, u64 realtime_done_us)
+{
+  request.realtime_done_us = realtime_done_us;
+  m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
+  m_result_queue_expanded.Set();
 }
 }  // namespace DVD
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
@@ -126,6 +127,12 @@ private:
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+  // Reads one or more requests from the front of pending and removes them
+  void ProcessReadRequests(std::deque<ReadRequest>& pending);
+  void PushResult(ReadRequest request, std::vector<u8> buffer, u64 realtime_done_us);
+
+  static constexpr u64 MAX_MERGED_READ_LENGTH = 0x100000;
+
   CoreTiming::EventType* m_finish_read = nullptr;
 
   u64 m_next_id = 0;
@@ -139,6 +146,11 @@ private:
   Common::SPSCQueue<ReadResult, false> m_result_queue;
   std::map<u64, ReadResult> m_result_map;
 
+  // The run of adjacent requests that the DVD thread is reading. Only used by the DVD thread.
+  DiscIO::Partition m_run_partition{};
+  u64 m_run_end = 0;
+  u32 m_run_length = 0;
+
   std::unique_ptr<DiscIO::Volume> m_disc;
 
   FileMonitor::FileLogger m_file_logger;
@@ -151,7 +151,9 @@ void CEXIAMBaseboard::DMARead(u32 addr, u32 size)
 
   m_backup->Flush();
 
-  m_backup->ReadBytes(memory.GetPointer(addr), size);
+  u8* const buffer = memory.GetPointer(addr);
+  memory.PrepareForHostWrite(buffer, size);
+  m_backup->ReadBytes(buffer, size);
 }
   void CEXIAMBaseboard::TransferByte(u8& _byte)
 {
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstring>
 #include <memory>
 #include <tuple>
@@ -33,6 +34,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/MemTools.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -226,6 +228,9 @@ bool MemoryManager::InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+
+    std::lock_guard lk(m_dirty_tracking_mutex);
+    ProtectCleanPages(view, region.shm_position, region.size);
   }
 
   m_is_fastmem_arena_initialized = true;
@@ -235,6 +240,8 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  std::lock_guard lk(m_dirty_tracking_mutex);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -279,7 +286,8 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, position});
+            ProtectCleanPages(static_cast<u8*>(mapped_pointer), position, mapped_size);
           }
 
           m_logical_page_mappings[i] =
@@ -328,19 +336,22 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  if (!m_exclude_ram_from_state)
+    p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
     p.DoArray(m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
-  if (current_have_exram)
+  if (current_have_exram && !m_exclude_ram_from_state)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
 }
 
 void MemoryManager::Shutdown()
 {
+  DisableDirtyTracking();
+  m_dirty_pages = {};
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -371,11 +382,14 @@ void MemoryManager::ShutdownFastmemArena()
     m_arena.UnmapFromMemoryRegion(base, region.size);
   }
 
-  for (auto& entry : m_logical_mapped_entries)
   {
-    m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
+    std::lock_guard lk(m_dirty_tracking_mutex);
+    for (auto& entry : m_logical_mapped_entries)
+    {
+      m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
+    }
+    m_logical_mapped_entries.clear();
   }
-  m_logical_mapped_entries.clear();
 
   m_arena.ReleaseMemoryRegion();
 
@@ -387,6 +401,236 @@ void MemoryManager::ShutdownFastmemArena()
   m_is_fastmem_arena_initialized = false;
 }
 
+bool MemoryManager::EnableDirtyTracking()
+{
+  // Guest RAM is also written by the GPU, DSP and DVD threads, so all of their faults have to be
+  // caught. This also rules out the Mach exception handler, which only covers the CPU thread.
+  if (!m_is_initialized || !EMM::IsExceptionHandlerProcessWide())
+    return false;
+
+  std::lock_guard lk(m_dirty_tracking_mutex);
+  if (m_dirty_tracking_enabled)
+    return true;
+
+  m_dirty_pages[0].region = &m_physical_regions[0];
+  m_dirty_pages[1].region = m_physical_regions[3].active ? &m_physical_regions[3] : nullptr;
+  for (DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    if (!bitmap.region)
+      continue;
+
+    // The bitmaps are only freed on shutdown, since a fault handler on another thread may still be
+    // looking at them right after tracking gets disabled.
+    const u32 word_count = (bitmap.region->size / DIRTY_PAGE_SIZE + 63) / 64;
+    if (!bitmap.words)
+      bitmap.words = std::make_unique<std::atomic<u64>[]>(word_count);
+    for (u32 i = 0; i < word_count; ++i)
+      bitmap.words[i].store(0, std::memory_order_relaxed);
+  }
+
+  m_dirty_tracking_enabled = true;
+  for (const DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    if (bitmap.region)
+      SetWritable(bitmap.region->shm_position, bitmap.region->size, false);
+  }
+
+  return true;
+}
+
+void MemoryManager::DisableDirtyTracking()
+{
+  std::lock_guard lk(m_dirty_tracking_mutex);
+  if (!m_dirty_tracking_enabled)
+    return;
+
+  m_dirty_tracking_enabled = false;
+  for (const DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    if (bitmap.region)
+      SetWritable(bitmap.region->shm_position, bitmap.region->size, true);
+  }
+}
+
+std::vector<u64> MemoryManager::FetchAndClearDirtyPages(DirtyTrackedRegion region)
+{
+  std::lock_guard lk(m_dirty_tracking_mutex);
+  const DirtyPageBitmap& bitmap = m_dirty_pages[static_cast<size_t>(region)];
+  if (!m_dirty_tracking_enabled || !bitmap.region)
+    return {};
+
+  const u32 page_count = bitmap.region->size / DIRTY_PAGE_SIZE;
+  std::vector<u64> dirty_pages((page_count + 63) / 64);
+  for (size_t i = 0; i < dirty_pages.size(); ++i)
+  {
+    // The bits are cleared before the pages are protected again. A write that happens in between
+    // isn't recorded, but it will still be seen by the caller, which reads the page afterwards.
+    const u64 bits = bitmap.words[i].exchange(0);
+    dirty_pages[i] = bits;
+
+    for (u64 remaining = bits; remaining != 0;)
+    {
+      const int first = std::countr_zero(remaining);
+      const int count = std::countr_one(remaining >> first);
+      const u32 page = static_cast<u32>(i * 64 + first);
+      SetWritable(bitmap.region->shm_position + page * DIRTY_PAGE_SIZE, count * DIRTY_PAGE_SIZE,
+                  false);
+      remaining = count == 64 ? 0 : remaining & ~(((u64{1} << count) - 1) << first);
+    }
+  }
+
+  return dirty_pages;
+}
+
+bool MemoryManager::HandleDirtyTrackingFault(uintptr_t fault_address)
+{
+  // This runs inside a signal handler (or a vectored exception handler) on whichever thread wrote
+  // to guest RAM, so it must not lock or allocate. Everything it reads stays the same while
+  // tracking is enabled, except for the logical page mappings. Those are only changed by the CPU
+  // thread, which is also the only thread that writes through the logical view.
+  if (!m_dirty_tracking_enabled.load(std::memory_order_acquire))
+    return false;
+
+  u8* const host_address = reinterpret_cast<u8*>(fault_address);
+
+  // Translate logical fastmem addresses to the plain view.
+  const u8* plain_address = host_address;
+  if (m_is_fastmem_arena_initialized && host_address >= m_logical_base &&
+      host_address < m_logical_base + 0x1'0000'0000)
+  {
+    const u32 logical_address = static_cast<u32>(host_address - m_logical_base);
+    const void* page = m_logical_page_mappings[logical_address >> PowerPC::BAT_INDEX_SHIFT];
+    if (!page)
+      return false;
+    plain_address =
+        static_cast<const u8*>(page) + (logical_address & (PowerPC::BAT_PAGE_SIZE - 1));
+  }
+
+  for (DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    const PhysicalMemoryRegion* region = bitmap.region;
+    if (!region)
+      continue;
+
+    const u8* view = *region->out_pointer;
+    const u8* physical_view =
+        m_is_fastmem_arena_initialized ? m_physical_base + region->physical_address : nullptr;
+    u32 offset;
+    if (plain_address >= view && plain_address < view + region->size)
+      offset = static_cast<u32>(plain_address - view);
+    else if (physical_view && host_address >= physical_view &&
+             host_address < physical_view + region->size)
+      offset = static_cast<u32>(host_address - physical_view);
+    else
+      continue;
+
+    // Only the mapping that faulted is made writable. Writing through another alias of the same
+    // page faults again, which just sets the same bit.
+    const u32 page = offset / DIRTY_PAGE_SIZE;
+    m_arena.SetViewWritable(host_address - offset % DIRTY_PAGE_SIZE, DIRTY_PAGE_SIZE, true);
+
+    // Set the bit only after the page is writable. If FetchAndClearDirtyPages clears it in between,
+    // it either protects the page again afterwards (and the write faults again), or the bit is set
+    // again here.
+    bitmap.words[page / 64].fetch_or(u64{1} << (page % 64));
+    return true;
+  }
+
+  return false;
+}
+
+void MemoryManager::PrepareForHostWrite(const u8* pointer, size_t size)
+{
+  if (!m_dirty_tracking_enabled || !pointer || size == 0)
+    return;
+
+  std::lock_guard lk(m_dirty_tracking_mutex);
+  if (!m_dirty_tracking_enabled)
+    return;
+
+  for (DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    const PhysicalMemoryRegion* region = bitmap.region;
+    if (!region)
+      continue;
+
+    const u8* view = *region->out_pointer;
+    const u8* end = std::min(pointer + size, view + region->size);
+    if (pointer < view || pointer >= end)
+      continue;
+
+    const u32 first_page = static_cast<u32>(pointer - view) / DIRTY_PAGE_SIZE;
+    const u32 last_page = static_cast<u32>(end - view - 1) / DIRTY_PAGE_SIZE;
+    SetWritable(region->shm_position + first_page * DIRTY_PAGE_SIZE,
+                (last_page - first_page + 1) * DIRTY_PAGE_SIZE, true);
+    for (u32 page = first_page; page <= last_page; ++page)
+      bitmap.words[page / 64].fetch_or(u64{1} << (page % 64));
+  }
+}
+
+void MemoryManager::SetWritable(u32 shm_position, u32 size, bool writable)
+{
+  const u32 end = shm_position + size;
+
+  for (const DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    const PhysicalMemoryRegion* region = bitmap.region;
+    if (!region)
+      continue;
+
+    const u32 intersection_start = std::max(shm_position, region->shm_position);
+    const u32 intersection_end = std::min(end, region->shm_position + region->size);
+    if (intersection_start >= intersection_end)
+      continue;
+
+    const u32 offset = intersection_start - region->shm_position;
+    const u32 length = intersection_end - intersection_start;
+    m_arena.SetViewWritable(*region->out_pointer + offset, length, writable);
+    if (m_is_fastmem_arena_initialized)
+    {
+      m_arena.SetViewWritable(m_physical_base + region->physical_address + offset, length,
+                              writable);
+    }
+  }
+
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    const u32 intersection_start = std::max(shm_position, entry.shm_position);
+    const u32 intersection_end = std::min(end, entry.shm_position + entry.mapped_size);
+    if (intersection_start < intersection_end)
+    {
+      m_arena.SetViewWritable(static_cast<u8*>(entry.mapped_pointer) + intersection_start -
+                                  entry.shm_position,
+                              intersection_end - intersection_start, writable);
+    }
+  }
+}
+
+// New mappings are writable, so while tracking is enabled, they have to be brought in line with
+// the existing ones.
+void MemoryManager::ProtectCleanPages(u8* view, u32 shm_position, u32 size)
+{
+  if (!m_dirty_tracking_enabled)
+    return;
+
+  for (const DirtyPageBitmap& bitmap : m_dirty_pages)
+  {
+    const PhysicalMemoryRegion* region = bitmap.region;
+    if (!region)
+      continue;
+
+    const u32 intersection_start = std::max(shm_position, region->shm_position);
+    const u32 intersection_end = std::min(shm_position + size, region->shm_position + region->size);
+    for (u32 position = intersection_start; position < intersection_end;
+         position += DIRTY_PAGE_SIZE)
+    {
+      const u32 page = (position - region->shm_position) / DIRTY_PAGE_SIZE;
+      if (!(bitmap.words[page / 64] & (u64{1} << (page % 64))))
+        m_arena.SetViewWritable(view + position - shm_position, DIRTY_PAGE_SIZE, false);
+    }
+  }
+}
+
 void MemoryManager::Clear()
 {
   if (m_ram)
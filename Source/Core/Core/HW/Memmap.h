@@ -4,7 +4,10 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,6 +56,13 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 shm_position;
+};
+
+enum class DirtyTrackedRegion
+{
+  MEM1,
+  MEM2,
 };
 
 class MemoryManager
@@ -97,6 +107,8 @@ public:
   bool InitFastmemArena();
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
+  // Rewind stores MEM1 and MEM2 outside of the savestate, so it can diff them on their own.
+  void SetExcludeRAMFromState(bool exclude) { m_exclude_ram_from_state = exclude; }
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
@@ -118,6 +130,33 @@ public:
   void Write_U16(u16 var, u32 address);
   void Write_U32(u32 var, u32 address);
   void Write_U64(u64 var, u32 address);
+
+  // Dirty page tracking. While it is enabled, MEM1 and MEM2 are write protected in every host
+  // mapping, and the first write to each page (by any thread, through any mapping) is recorded by
+  // the fault handler. Code that repeatedly scans guest RAM can then skip unchanged pages.
+  // There should only be one user at a time, since fetching the dirty pages also clears them.
+  static constexpr u32 DIRTY_PAGE_SIZE = 0x4000;
+
+  // Returns false if the host can't catch writes on all threads.
+  bool EnableDirtyTracking();
+  void DisableDirtyTracking();
+  bool IsDirtyTrackingEnabled() const { return m_dirty_tracking_enabled.load(); }
+
+  // Returns one bit per DIRTY_PAGE_SIZE bytes of the region (page i is bit i % 64 of word i / 64),
+  // set for the pages that were written to since tracking was enabled or since the last call for
+  // the same region, and write protects those pages again. Returns an empty vector if tracking is
+  // disabled.
+  std::vector<u64> FetchAndClearDirtyPages(DirtyTrackedRegion region);
+
+  // Called by the fault handler. Returns true if the fault was a write to a tracked page.
+  // Doesn't lock, so it is safe to call from a signal handler.
+  bool HandleDirtyTrackingFault(uintptr_t fault_address);
+
+  // Host I/O (like reading a file or a socket) straight into guest RAM doesn't fault while the
+  // target pages are protected, the system call fails with EFAULT instead. Call this with the
+  // pointer returned by GetPointer before such I/O to mark the range as dirty and make it
+  // writable. Does nothing if tracking is disabled.
+  void PrepareForHostWrite(const u8* pointer, size_t size);
   void Write_U32_Swap(u32 var, u32 address);
   void Write_U64_Swap(u64 var, u32 address);
 
@@ -192,6 +231,8 @@ private:
   bool m_is_initialized = false;
   // END STATE_TO_SAVE
 
+  bool m_exclude_ram_from_state = false;
+
   // MMIO mapping object.
   std::unique_ptr<MMIO::Mapping> m_mmio_mapping;
 
@@ -243,8 +284,22 @@ private:
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  struct DirtyPageBitmap
+  {
+    const PhysicalMemoryRegion* region = nullptr;
+    std::unique_ptr<std::atomic<u64>[]> words;
+  };
+  std::array<DirtyPageBitmap, 2> m_dirty_pages;
+  std::atomic<bool> m_dirty_tracking_enabled = false;
+  // Serializes changes to the page protection and to m_logical_mapped_entries. The fault handler
+  // doesn't take it and only touches the bitmaps and the page that faulted.
+  std::mutex m_dirty_tracking_mutex;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+
+  void SetWritable(u32 shm_position, u32 size, bool writable);
+  void ProtectCleanPages(u8* view, u32 shm_position, u32 size);
 };
 }  // namespace Memory
@@ -163,6 +163,7 @@ enum Hotkey
   HK_SAVE_FIRST_STATE,
   HK_UNDO_LOAD_STATE,
   HK_UNDO_SAVE_STATE,
+  HK_REWIND,
   HK_SAVE_STATE_FILE,
   HK_LOAD_STATE_FILE,
   HK_INCREMENT_SELECTED_STATE_SLOT,
@@ -326,8 +326,9 @@ std::optional<IPCReply> FSDevice::Read(const ReadWriteRequest& request)
   return MakeIPCReply([&](Ticks t) {
     auto& system = GetSystem();
     auto& memory = system.GetMemory();
-    return m_core.Read(request.fd, memory.GetPointer(request.buffer), request.size, request.buffer,
-                       t);
+    u8* const buffer = memory.GetPointer(request.buffer);
+    memory.PrepareForHostWrite(buffer, request.size);
+    return m_core.Read(request.fd, buffer, request.size, request.buffer, t);
   });
 }
 
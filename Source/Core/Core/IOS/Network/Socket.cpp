@@ -635,6 +635,7 @@ void WiiSocket::Update(bool read, bool write, bool except)
           // Not a string, Windows requires a char* for recvfrom
           char* data = (char*)memory.GetPointer(BufferOut);
           int data_len = BufferOutSize;
+          memory.PrepareForHostWrite(reinterpret_cast<u8*>(data), data_len);
 
           sockaddr_in local_name;
           memset(&local_name, 0, sizeof(sockaddr_in));
@@ -519,7 +519,9 @@ std::optional<IPCReply> WFSIDevice::IOCtl(const IOCtlRequest& request)
     }
     else
     {
-      fp.ReadBytes(memory.GetPointer(dol_addr), max_dol_size);
+      u8* const buffer = memory.GetPointer(dol_addr);
+      memory.PrepareForHostWrite(buffer, max_dol_size);
+      fp.ReadBytes(buffer, max_dol_size);
     }
     memory.Write_U32(real_dol_size, request.buffer_out);
     break;
@@ -569,7 +571,9 @@ u32 WFSIDevice::GetTmd(u16 group_id, u32 title_id, u64 subtitle_id, u32 address,
   {
     auto& system = GetSystem();
     auto& memory = system.GetMemory();
-    fp.ReadBytes(memory.GetPointer(address), fp.GetSize());
+    u8* const buffer = memory.GetPointer(address);
+    memory.PrepareForHostWrite(buffer, fp.GetSize());
+    fp.ReadBytes(buffer, fp.GetSize());
   }
   *size = fp.GetSize();
   return IPC_SUCCESS;
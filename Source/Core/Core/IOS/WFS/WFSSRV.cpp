@@ -297,7 +297,9 @@ std::optional<IPCReply> WFSSRVDevice::IOCtl(const IOCtlRequest& request)
       fd_obj->file.Seek(position, File::SeekOrigin::Begin);
     }
     size_t read_bytes;
-    fd_obj->file.ReadArray(memory.GetPointer(addr), size, &read_bytes);
+    u8* const buffer = memory.GetPointer(addr);
+    memory.PrepareForHostWrite(buffer, size);
+    fd_obj->file.ReadArray(buffer, size, &read_bytes);
     // TODO(wfs): Handle read errors.
     if (absolute)
     {
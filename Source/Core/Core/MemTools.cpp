@@ -14,6 +14,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 
+#include "Core/HW/Memmap.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
@@ -61,7 +62,11 @@ static LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
     uintptr_t fault_address = (uintptr_t)pPtrs->ExceptionRecord->ExceptionInformation[1];
     SContext* ctx = pPtrs->ContextRecord;
 
-    if (Core::System::GetInstance().GetJitInterface().HandleFault(fault_address, ctx))
+    auto& system = Core::System::GetInstance();
+    if (access_type == 1 && system.GetMemory().HandleDirtyTrackingFault(fault_address))
+      return EXCEPTION_CONTINUE_EXECUTION;
+
+    if (system.GetJitInterface().HandleFault(fault_address, ctx))
     {
       return EXCEPTION_CONTINUE_EXECUTION;
     }
@@ -119,6 +124,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #elif defined(__APPLE__) && !defined(USE_SIGACTION_ON_APPLE)
 
 static void CheckKR(const char* name, kern_return_t kr)
@@ -255,6 +265,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return false;
+}
+
 #elif defined(_POSIX_VERSION) && !defined(_M_GENERIC)
 
 static struct sigaction old_sa_segv;
@@ -282,8 +297,12 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
 #else
   mcontext_t* ctx = &context->uc_mcontext;
 #endif
+  auto& system = Core::System::GetInstance();
+  if (system.GetMemory().HandleDirtyTrackingFault(bad_address))
+    return;
+
   // assume it's not a write
-  if (!Core::System::GetInstance().GetJitInterface().HandleFault(bad_address,
+  if (!system.GetJitInterface().HandleFault(bad_address,
 #ifdef __APPLE__
                                                                  *ctx
 #else
@@ -369,6 +388,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #else  // _M_GENERIC or unsupported platform
 
 void InstallExceptionHandler()
@@ -384,6 +408,11 @@ bool IsExceptionHandlerSupported()
   return false;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return false;
+}
+
 #endif
 
 }  // namespace EMM
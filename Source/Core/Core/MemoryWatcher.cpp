@@ -3,23 +3,43 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <unistd.h>
+#include <unordered_set>
 
 #include "Common/FileUtil.h"
+#include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+// Watched addresses that are at most this many bytes apart are read together.
+constexpr u32 MAX_RANGE_GAP = 64;
 
 MemoryWatcher::MemoryWatcher()
+    : MemoryWatcher(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX),
+                    File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX))
+{
+}
+
+MemoryWatcher::MemoryWatcher(const std::string& locations_path, const std::string& socket_path)
 {
   m_running = false;
-  if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
+  if (!LoadAddresses(locations_path))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  if (!OpenSocket(socket_path))
     return;
+
+  m_binary_output = Config::Get(Config::MAIN_MEMORY_WATCHER_BINARY_OUTPUT);
+  m_sample_interval = std::max<u32>(Config::Get(Config::MAIN_MEMORY_WATCHER_SAMPLE_INTERVAL), 1);
   m_running = true;
 }
 
@@ -39,23 +59,64 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  std::unordered_set<std::string> seen_lines;
   std::string line;
-  while (std::getline(locations, line))
-    ParseLine(line);
+  for (u32 line_number = 0; std::getline(locations, line); ++line_number)
+  {
+    if (seen_lines.insert(line).second)
+      ParseLine(line, line_number);
+  }
 
-  return !m_values.empty();
+  GroupAddresses();
+  return !m_watches.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+void MemoryWatcher::ParseLine(const std::string& line, u32 line_number)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch& watch = m_watches.emplace_back();
+  watch.line = line;
+  watch.line_number = line_number;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
+}
+
+void MemoryWatcher::GroupAddresses()
+{
+  std::vector<size_t> direct_watches;
+  for (size_t i = 0; i < m_watches.size(); ++i)
+  {
+    if (m_watches[i].offsets.size() == 1 && m_watches[i].offsets[0] <= 0xFFFFFFFC)
+      direct_watches.push_back(i);
+    else
+      m_pointer_watches.push_back(i);
+  }
+
+  std::sort(direct_watches.begin(), direct_watches.end(), [this](size_t a, size_t b) {
+    return m_watches[a].offsets[0] < m_watches[b].offsets[0];
+  });
+
+  for (size_t i : direct_watches)
+  {
+    const u32 address = m_watches[i].offsets[0];
+    if (m_ranges.empty() ||
+        address > u64{m_ranges.back().address} + m_ranges.back().size + MAX_RANGE_GAP)
+    {
+      m_ranges.push_back({address, 0, {}});
+    }
+
+    ReadRange& range = m_ranges.back();
+    range.size = std::max<u32>(range.size, address + sizeof(u32) - range.address);
+    range.watches.push_back(i);
+  }
+
+  size_t max_size = 0;
+  for (const ReadRange& range : m_ranges)
+    max_size = std::max<size_t>(max_size, range.size);
+  m_read_buffer.resize(max_size);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,10 +128,10 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : watch.offsets)
   {
     value = PowerPC::MMU::HostRead_U32(guard, value + offset);
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
@@ -79,26 +140,125 @@ u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::st
   return value;
 }
 
-std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
+// Copies the range into m_read_buffer straight from MEM1 or MEM2. Returns false if that isn't
+// possible, in which case the values have to be read one by one through the MMU.
+bool MemoryWatcher::ReadRangeFromRAM(const Core::CPUThreadGuard& guard, const ReadRange& range)
 {
-  std::ostringstream message_stream;
-  message_stream << std::hex;
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  auto& memory = system.GetMemory();
+  auto& mmu = system.GetMMU();
+
+  // The data cache may hold values that haven't been written back to RAM yet
+  if (ppc_state.m_enable_dcache)
+    return false;
+
+  u32 address = range.address;
+  u32 offset = 0;
+  while (offset < range.size)
+  {
+    const u32 size = std::min<u32>(range.size - offset,
+                                   PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK));
+
+    u32 physical_address = address;
+    if (ppc_state.msr.DR)
+    {
+      const std::optional<u32> translated_address = mmu.GetTranslatedAddress(address);
+      if (!translated_address)
+        return false;
+      physical_address = *translated_address;
+    }
+
+    const u32 segment = physical_address >> 28;
+    const u32 physical_offset = physical_address & 0x0FFFFFFF;
+    const u8* src;
+    if (segment == 0x0 && physical_offset + size <= memory.GetRamSizeReal())
+      src = memory.GetRAM() + physical_offset;
+    else if (memory.GetEXRAM() && segment == 0x1 &&
+             physical_offset + size <= memory.GetExRamSizeReal())
+      src = memory.GetEXRAM() + physical_offset;
+    else
+      return false;
+
+    std::memcpy(m_read_buffer.data() + offset, src, size);
+    address += size;
+    offset += size;
+  }
+
+  return true;
+}
 
-  for (auto& entry : m_values)
+void MemoryWatcher::UpdateValue(size_t watch_index, u32 new_value)
+{
+  u32& current_value = m_watches[watch_index].value;
+  if (new_value != current_value)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
+    current_value = new_value;
+    m_changes.push_back(watch_index);
+  }
+}
 
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+void MemoryWatcher::UpdateValues(const Core::CPUThreadGuard& guard)
+{
+  m_changes.clear();
+
+  for (const ReadRange& range : m_ranges)
+  {
+    if (ReadRangeFromRAM(guard, range))
+    {
+      for (size_t i : range.watches)
+      {
+        const u32 offset = m_watches[i].offsets[0] - range.address;
+        UpdateValue(i, Common::swap32(m_read_buffer.data() + offset));
+      }
+    }
+    else
     {
-      // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      for (size_t i : range.watches)
+        UpdateValue(i, ChasePointer(guard, m_watches[i]));
     }
   }
 
-  return message_stream.str();
+  for (size_t i : m_pointer_watches)
+    UpdateValue(i, ChasePointer(guard, m_watches[i]));
+
+  // The ranges are read in address order, but changes are reported in file order
+  std::sort(m_changes.begin(), m_changes.end());
+}
+
+void MemoryWatcher::SendTextMessage()
+{
+  std::ostringstream message_stream;
+  message_stream << std::hex;
+  for (size_t i : m_changes)
+    message_stream << m_watches[i].line << '\n' << m_watches[i].value << '\n';
+
+  std::string message = message_stream.str();
+  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+         sizeof(m_addr));
+}
+
+void MemoryWatcher::SendBinaryMessages()
+{
+  constexpr size_t max_changes_per_datagram = (MAX_DATAGRAM_SIZE - 2 * sizeof(u32)) / 8;
+
+  std::vector<u32> message;
+  for (size_t first = 0; first < m_changes.size(); first += max_changes_per_datagram)
+  {
+    const size_t count = std::min(m_changes.size() - first, max_changes_per_datagram);
+    message.clear();
+    message.push_back(BINARY_MAGIC);
+    message.push_back(static_cast<u32>(count));
+    for (size_t i = first; i < first + count; ++i)
+    {
+      const Watch& watch = m_watches[m_changes[i]];
+      message.push_back(watch.line_number);
+      message.push_back(watch.value);
+    }
+
+    sendto(m_fd, message.data(), message.size() * sizeof(u32), 0,
+           reinterpret_cast<sockaddr*>(&m_addr), sizeof(m_addr));
+  }
 }
 
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
@@ -106,7 +266,16 @@ void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages(guard);
-  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
-         sizeof(m_addr));
+  if (m_frames_until_sample > 0)
+  {
+    --m_frames_until_sample;
+    return;
+  }
+  m_frames_until_sample = m_sample_interval - 1;
+
+  UpdateValues(guard);
+  if (m_binary_output)
+    SendBinaryMessages();
+  else
+    SendTextMessage();
 }
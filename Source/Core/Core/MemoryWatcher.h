@@ -5,7 +5,6 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -22,30 +21,79 @@ class CPUThreadGuard;
 // The input file is a newline-separated list of hex memory addresses, without
 // the "0x". To follow pointers, separate addresses with a space. For example,
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
-// The output to the socket is two lines. The first is the address from the
-// input file, and the second is the new value in hex.
+//
+// The addresses are sampled every MemoryWatcherSampleInterval frames.
+//
+// By default, the output to the socket is two lines per change. The first is
+// the address from the input file, and the second is the new value in hex.
+//
+// Changes are reported in the order of the lines in the input file.
+//
+// If MemoryWatcherBinaryOutput is enabled, every sample with changes is sent
+// as one datagram instead: a u32 BINARY_MAGIC and a u32 change count, followed
+// by a u32 line number (zero-based, in the input file) and the u32 new value
+// for each change, all in host byte order. If the changes don't fit into
+// MAX_DATAGRAM_SIZE, they're split across several datagrams of that format.
 class MemoryWatcher final
 {
 public:
+  static constexpr u32 BINARY_MAGIC = 0x424D5744;  // "DWMB" in little endian
+  static constexpr size_t MAX_DATAGRAM_SIZE = 0x10000;
+
+  // Watches without pointers to follow that are close enough to each other to be read at once.
+  // The watches are indices into the lines that were loaded, not counting duplicate lines.
+  struct ReadRange
+  {
+    u32 address;
+    u32 size;
+    std::vector<size_t> watches;
+  };
+
   MemoryWatcher();
+  MemoryWatcher(const std::string& locations_path, const std::string& socket_path);
   ~MemoryWatcher();
   void Step(const Core::CPUThreadGuard& guard);
 
+  bool IsRunning() const { return m_running; }
+  const std::vector<ReadRange>& GetReadRanges() const { return m_ranges; }
+
 private:
+  struct Watch
+  {
+    // Address as stored in the file
+    std::string line;
+    u32 line_number;
+    // Offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
-  std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  void ParseLine(const std::string& line, u32 line_number);
+  void GroupAddresses();
+  u32 ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch);
+  bool ReadRangeFromRAM(const Core::CPUThreadGuard& guard, const ReadRange& range);
+  void UpdateValue(size_t watch_index, u32 new_value);
+  void UpdateValues(const Core::CPUThreadGuard& guard);
+  void SendTextMessage();
+  void SendBinaryMessages();
 
   bool m_running = false;
+  bool m_binary_output = false;
+  u32 m_sample_interval = 1;
+  u32 m_frames_until_sample = 0;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  std::vector<Watch> m_watches;
+  std::vector<ReadRange> m_ranges;
+  // Watches that follow pointers, which have to be read one by one.
+  std::vector<size_t> m_pointer_watches;
+
+  // Indices into m_watches of the values that changed during the current sample.
+  std::vector<size_t> m_changes;
+  std::vector<u8> m_read_buffer;
 };
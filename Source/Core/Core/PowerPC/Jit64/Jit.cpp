@@ -3,9 +3,13 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <disasm.h>
 #include <fmt/format.h>
@@ -266,6 +270,8 @@ void Jit64::Init()
   gpr.SetEmitter(this);
   fpr.SetEmitter(this);
 
+  analyzer.SetHotBranches(&js.hotBranchAddresses);
+
   const size_t routines_size = asm_routines.CODE_SIZE;
   const size_t trampolines_size = jo.memcheck ? TRAMPOLINE_CODE_SIZE_MMU : TRAMPOLINE_CODE_SIZE;
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
@@ -307,6 +313,8 @@ void Jit64::ClearCache()
   m_const_pool.Clear();
   ClearCodeSpace();
   Clear();
+  m_branch_taken_countdown.clear();
+  m_hot_block_queue.clear();
   RefreshConfig();
   ResetFreeMemoryRanges();
 }
@@ -405,6 +413,56 @@ void Jit64::DoNothing(UGeckoInstruction _inst)
   // Yup, just don't do anything.
 }
 
+bool Jit64::PromoteHotBlock(Jit64& jit)
+{
+  const u32 address = jit.m_ppc_state.pc;
+  const u32 msr_bits = jit.m_ppc_state.msr.Hex & JitBaseBlockCache::JIT_CACHE_MSR_MASK;
+  auto& queue = jit.m_hot_block_queue;
+  const auto it = std::ranges::find(queue, std::pair(address, msr_bits));
+  if (it == queue.end())
+  {
+    // The hot version gets compiled once the CPU thread has time to spare, see CompileHotBlocks.
+    queue.emplace_back(address, msr_bits);
+    return false;
+  }
+
+  // The block reached the threshold again without the CPU thread ever waiting for the throttle,
+  // for example because the emulation speed is unlimited. Invalidating the block makes the
+  // dispatcher recompile it right away.
+  queue.erase(it);
+  jit.js.hotBlockAddresses.insert(address);
+  jit.blocks.InvalidateICache(address, 4, true);
+  return true;
+}
+
+void Jit64::CompileHotBlocks(TimePoint deadline)
+{
+  // Compiling can clear the cache, which also clears the queue, so work on a copy of it. Blocks
+  // that no longer exist are dropped, and blocks for other MSR bits are kept for later.
+  std::vector<std::pair<u32, u32>> queue = std::move(m_hot_block_queue);
+  m_hot_block_queue.clear();
+  const u32 msr_bits = m_ppc_state.msr.Hex & JitBaseBlockCache::JIT_CACHE_MSR_MASK;
+  auto it = queue.begin();
+  for (; it != queue.end() && Clock::now() < deadline; ++it)
+  {
+    const auto [address, block_msr_bits] = *it;
+    if (block_msr_bits != msr_bits)
+    {
+      m_hot_block_queue.push_back(*it);
+      continue;
+    }
+    if (!blocks.GetBlockFromStartAddress(address, m_ppc_state.msr.Hex))
+      continue;
+
+    js.hotBlockAddresses.insert(address);
+    blocks.InvalidateICache(address, 4, true);
+    m_compiling_queued_block = true;
+    Jit(address);
+    m_compiling_queued_block = false;
+  }
+  m_hot_block_queue.insert(m_hot_block_queue.end(), it, queue.end());
+}
+
 void Jit64::ImHere(Jit64& jit)
 {
   auto& ppc_state = jit.m_ppc_state;
@@ -755,13 +813,29 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  m_compiling_cold_block = m_enable_tiered_compilation && !m_enable_debugging &&
+                          !js.hotBlockAddresses.contains(em_address);
+  if (m_compiling_cold_block)
+  {
+    block_size = std::min(block_size, TIERED_COLD_BLOCK_SIZE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (m_compiling_cold_block)
+    EnableOptimization();
+
   if (code_block.m_memory_exception)
   {
+    // Leave raising the exception to the dispatcher, which compiles the block again when it runs
+    if (m_compiling_queued_block)
+      return;
+
     // Address of instruction could not be translated
     m_ppc_state.npc = nextPC;
     m_ppc_state.Exceptions |= EXCEPTION_ISI;
@@ -877,6 +951,28 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
 #endif
 
+  // Count the executions of cold blocks and promote them to the hot tier when they reach zero.
+  b->tier_countdown = TIERED_PROMOTION_THRESHOLD;
+  if (m_compiling_cold_block)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch promote = J_CC(CC_Z, Jump::Near);
+
+    SwitchToFarCode();
+    SetJumpTarget(promote);
+    MOV(32, MatR(RSCRATCH), Imm32(TIERED_PROMOTION_THRESHOLD));
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionP(PromoteHotBlock, this);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    TEST(8, R(ABI_RETURN), R(ABI_RETURN));
+    FixupBranch keep_running = J_CC(CC_Z, Jump::Near);
+    JMP(asm_routines.dispatcher_no_check, Jump::Near);
+    SwitchToNearCode();
+    SetJumpTarget(keep_running);
+  }
+
   // Start up the register allocators
   // They use the information in gpa/fpa to preload commonly used registers.
   gpr.Start();
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <rangeset/rangesizeset.h>
 
@@ -63,6 +66,10 @@ public:
 
   void Jit(u32 em_address) override;
   void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
+  void CompileHotBlocks(TimePoint deadline) override;
+  // Called by a cold block at m_ppc_state.pc when its countdown reaches zero. Returns true if the
+  // block was invalidated, in which case the caller has to go back to the dispatcher.
+  static bool PromoteHotBlock(Jit64& jit);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
   // Finds a free memory region and sets the near and far code emitters to point at that region.
@@ -263,6 +270,26 @@ private:
   void ResetFreeMemoryRanges();
 
   static void ImHere(Jit64& jit);
+  static void PromoteHotBranch(Jit64& jit, u32 branch_address);
+  void WriteBranchTakenProfile(const PPCAnalyst::CodeOp& op);
+
+  // Tiered compilation: blocks are first compiled without branch following and with a small
+  // maximum size, which keeps the compile time of code that only runs a few times low. Once such a
+  // block has run TIERED_PROMOTION_THRESHOLD times, it is queued to be recompiled with all
+  // optimizations while the CPU thread waits for the throttle. If it reaches the threshold again
+  // before that happens, it is recompiled right away.
+  static constexpr u32 TIERED_PROMOTION_THRESHOLD = 1000;
+  static constexpr std::size_t TIERED_COLD_BLOCK_SIZE = 64;
+  bool m_compiling_cold_block = false;
+  bool m_compiling_queued_block = false;
+  // The start address and MSR bits of the cold blocks waiting for their hot version
+  std::vector<std::pair<u32, u32>> m_hot_block_queue;
+
+  // Hot branch following: each forward conditional branch counts down how often its taken side
+  // leaves the block. Once HOT_BRANCH_THRESHOLD is reached, the block is recompiled with the
+  // analyzer following the taken side, so that register state survives the branch.
+  static constexpr u32 HOT_BRANCH_THRESHOLD = 1000;
+  std::unordered_map<u32, u32> m_branch_taken_countdown;
 
   JitBlockCache blocks{*this};
   TrampolineCache trampolines{*this};
@@ -151,6 +151,26 @@ void Jit64::bcx(UGeckoInstruction inst)
     return;
   }
 
+  if (js.op->conditionalBranchFollowed)
+  {
+    // The block continues at the branch target, so not branching is the side exit.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(js.compilerPC + 4);
+    }
+    SwitchToNearCode();
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -163,6 +183,7 @@ void Jit64::bcx(UGeckoInstruction inst)
     }
     else
     {
+      WriteBranchTakenProfile(*js.op);
       WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
     }
   }
@@ -180,6 +201,40 @@ void Jit64::bcx(UGeckoInstruction inst)
   }
 }
 
+void Jit64::PromoteHotBranch(Jit64& jit, u32 branch_address)
+{
+  // Invalidating the blocks containing the branch makes them get recompiled with the branch
+  // followed. The exit we're currently in is still valid until the next compile.
+  jit.js.hotBranchAddresses.insert(branch_address);
+  jit.blocks.InvalidateICache(branch_address, 4, true);
+}
+
+void Jit64::WriteBranchTakenProfile(const PPCAnalyst::CodeOp& op)
+{
+  // Only forward conditional branches without LK can be followed by the analyzer.
+  if (!m_enable_hot_branch_following || op.inst.OPCD != 16 || op.inst.LK ||
+      op.branchIsIdleLoop || op.branchTo <= op.address)
+  {
+    return;
+  }
+
+  u32& countdown =
+      m_branch_taken_countdown.try_emplace(op.address, HOT_BRANCH_THRESHOLD).first->second;
+  MOV(64, R(RSCRATCH), ImmPtr(&countdown));
+  SUB(32, MatR(RSCRATCH), Imm8(1));
+  FixupBranch hot = J_CC(CC_Z, Jump::Near);
+
+  SwitchToFarCode();
+  SetJumpTarget(hot);
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionPC(PromoteHotBranch, this, op.address);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  FixupBranch back = J(Jump::Near);
+  SwitchToNearCode();
+
+  SetJumpTarget(back);
+}
+
 void Jit64::bcctrx(UGeckoInstruction inst)
 {
   INSTRUCTION_START
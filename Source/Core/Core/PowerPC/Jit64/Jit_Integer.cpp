@@ -375,6 +375,10 @@ bool Jit64::CheckMergedBranch(u32 crf) const
   if (!CanMergeNextInstructions(1))
     return false;
 
+  // A followed branch continues the block at its target, which the merged branch code can't do.
+  if (js.op[1].conditionalBranchFollowed)
+    return false;
+
   const UGeckoInstruction& next = js.op[1].inst;
   return (((next.OPCD == 16 /* bcx */) ||
            ((next.OPCD == 19) && (next.SUBOP10 == 528) /* bcctrx */) ||
@@ -471,6 +475,7 @@ void Jit64::DoMergedBranchCondition()
     gpr.Flush();
     fpr.Flush();
 
+    WriteBranchTakenProfile(js.op[1]);
     DoMergedBranch();
   }
 
@@ -127,6 +127,12 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    // Blocks which ran often enough to be recompiled with all optimizations when tiered
+    // compilation is enabled.
+    std::unordered_set<u32> hotBlockAddresses;
+    // Conditional branches whose taken side was found to be hot at runtime. The analyzer follows
+    // them when hot branch following is enabled.
+    std::unordered_set<u32> hotBranchAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -149,6 +155,8 @@ protected:
   bool bJITRegisterCacheOff = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_hot_branch_following = false;
+  bool m_enable_tiered_compilation = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -161,7 +169,7 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 22> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh();
   void RefreshConfig();
@@ -189,6 +197,9 @@ public:
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
+  // Compiles blocks which were queued for recompilation, until the deadline is reached. Called
+  // when the CPU thread is about to sleep to keep the emulation speed.
+  virtual void CompileHotBlocks(TimePoint deadline) {}
 
   virtual const CommonAsmRoutinesBase* GetAsmRoutines() = 0;
 
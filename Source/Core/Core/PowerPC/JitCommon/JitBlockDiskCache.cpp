@@ -0,0 +1,237 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include <cstring>
+#include <vector>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+const u8* GetPhysicalCodePointer(Memory::MemoryManager& memory, u32 address)
+{
+  if (address < memory.GetRamSizeReal())
+    return memory.GetRAM() + address;
+
+  if (memory.GetEXRAM() && (address >> 28) == 0x1 &&
+      (address & 0x0fffffff) < memory.GetExRamSizeReal())
+  {
+    return memory.GetEXRAM() + (address & memory.GetExRamMask());
+  }
+
+  return nullptr;
+}
+
+template <typename Map>
+class EntryReader final : public Common::LinearDiskCacheReader<typename Map::key_type, u32>
+{
+public:
+  explicit EntryReader(Map& entries) : m_entries(entries) {}
+  void Read(const typename Map::key_type& key, const u32* value, u32 value_size) override
+  {
+    m_entries.emplace(key, std::vector<u32>(value, value + value_size));
+  }
+
+private:
+  Map& m_entries;
+};
+}  // namespace
+
+std::optional<u64> JitBlockDiskCache::HashGuestCode(Memory::MemoryManager& memory,
+                                                    const u32* physical_addresses, u32 count)
+{
+  // Both the addresses and the instructions go into the hash, so that a block which was moved
+  // around by the game doesn't match.
+  std::vector<u32> data(count * 2);
+  for (u32 i = 0; i < count; ++i)
+  {
+    const u8* ptr = GetPhysicalCodePointer(memory, physical_addresses[i]);
+    if (!ptr)
+      return std::nullopt;
+
+    data[i * 2] = physical_addresses[i];
+    std::memcpy(&data[i * 2 + 1], ptr, sizeof(u32));
+  }
+
+  return XXH64(data.data(), data.size() * sizeof(u32), 0);
+}
+
+void JitBlockDiskCache::LoadAndPrecompile(JitBase& jit, const std::string& game_id, u16 revision)
+{
+  if (game_id.empty())
+    return;
+
+  const std::string& dir = File::GetUserPath(D_JITCACHE_IDX);
+  if (!File::Exists(dir))
+    File::CreateDir(dir);
+
+  Open(fmt::format("{}{}-r{}.cache", dir, game_id, revision));
+
+  auto& memory = jit.m_system.GetMemory();
+  const u32 msr_bits = jit.m_ppc_state.msr.Hex & JitBaseBlockCache::JIT_CACHE_MSR_MASK;
+  JitBaseBlockCache& blocks = *jit.GetBlockCache();
+
+  u32 compiled = 0;
+  for (const auto& [key, physical_addresses] : m_entries)
+  {
+    // We can't compile blocks for a different address translation mode ahead of time, since the
+    // analyzer reads the guest code through the current MSR.
+    const auto translated = jit.m_mmu.JitCache_TranslateAddress(key.effective_address);
+    if (key.msr_bits != msr_bits || !translated.valid ||
+        translated.address != key.physical_address)
+    {
+      continue;
+    }
+
+    // This also happens for code that the game hasn't loaded yet, such as overlays. The entry is
+    // kept, so that it isn't appended again if the block gets compiled later in the session.
+    const std::optional<u64> hash = HashGuestCode(memory, physical_addresses.data(),
+                                                  static_cast<u32>(physical_addresses.size()));
+    if (hash != key.code_hash)
+    {
+      MarkStale(key);
+      continue;
+    }
+
+    if (!blocks.GetBlockFromStartAddress(key.effective_address, msr_bits))
+    {
+      jit.Jit(key.effective_address);
+      ++compiled;
+    }
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Precompiled {} of {} cached JIT blocks from {}", compiled,
+               m_entries.size(), m_filename);
+}
+
+void JitBlockDiskCache::Save(JitBase& jit)
+{
+  if (!m_is_open)
+    return;
+
+  auto& memory = jit.m_system.GetMemory();
+  EntryMap live_entries;
+  jit.GetBlockCache()->RunOnBlocks([&](const JitBlock& block) {
+    const std::vector<u32>& physical_addresses = block.physical_addresses;
+    const u32 count = static_cast<u32>(physical_addresses.size());
+    const std::optional<u64> hash = HashGuestCode(memory, physical_addresses.data(), count);
+    if (!hash)
+      return;
+
+    const DiskKey key{block.effectiveAddress, block.msrBits, block.physicalAddress, 0, *hash};
+    live_entries.emplace(key, physical_addresses);
+  });
+
+  Close(live_entries);
+}
+
+void JitBlockDiskCache::Open(const std::string& filename)
+{
+  m_filename = filename;
+  m_entries.clear();
+  m_stale_keys.clear();
+  EntryReader<EntryMap> reader(m_entries);
+  m_records_on_disk = m_disk_cache.OpenAndRead(m_filename, reader);
+  m_is_open = true;
+}
+
+void JitBlockDiskCache::MarkStale(const DiskKey& key)
+{
+  m_stale_keys.insert(key);
+}
+
+void JitBlockDiskCache::Close(const EntryMap& live_entries)
+{
+  if (!m_is_open)
+    return;
+
+  size_t new_entries = 0;
+  for (const auto& [key, physical_addresses] : live_entries)
+  {
+    if (!m_entries.contains(key))
+      ++new_entries;
+  }
+
+  // Records that are never used again: stale entries that weren't compiled this session either,
+  // and duplicates
+  size_t unused_records = m_records_on_disk - m_entries.size();
+  for (const DiskKey& key : m_stale_keys)
+  {
+    if (!live_entries.contains(key))
+      ++unused_records;
+  }
+
+  // Get rid of the unused records once they make up a quarter of the file
+  if (m_records_on_disk + new_entries > MAX_ENTRIES || unused_records * 4 > m_records_on_disk)
+  {
+    Rewrite(live_entries);
+  }
+  else
+  {
+    for (const auto& [key, physical_addresses] : live_entries)
+    {
+      if (!m_entries.contains(key))
+      {
+        m_disk_cache.Append(key, physical_addresses.data(),
+                            static_cast<u32>(physical_addresses.size()));
+      }
+    }
+    INFO_LOG_FMT(DYNA_REC, "Saved {} new JIT blocks to the persistent block cache", new_entries);
+  }
+
+  m_disk_cache.Sync();
+  m_disk_cache.Close();
+  m_entries.clear();
+  m_stale_keys.clear();
+  m_records_on_disk = 0;
+  m_is_open = false;
+}
+
+void JitBlockDiskCache::Rewrite(const EntryMap& live_entries)
+{
+  m_disk_cache.Close();
+  File::Delete(m_filename);
+
+  EntryMap ignored;
+  EntryReader<EntryMap> reader(ignored);
+  m_disk_cache.OpenAndRead(m_filename, reader);
+
+  // Blocks used in this session come first, then the ones from earlier sessions that weren't
+  // needed this time (for example because they belong to a part of the game that wasn't reached).
+  size_t written = 0;
+  const auto write = [&](const DiskKey& key, const std::vector<u32>& physical_addresses) {
+    m_disk_cache.Append(key, physical_addresses.data(),
+                        static_cast<u32>(physical_addresses.size()));
+    ++written;
+  };
+
+  for (const auto& [key, physical_addresses] : live_entries)
+  {
+    if (written == MAX_ENTRIES)
+      break;
+    write(key, physical_addresses);
+  }
+
+  for (const auto& [key, physical_addresses] : m_entries)
+  {
+    if (written == MAX_ENTRIES)
+      break;
+    if (!live_entries.contains(key) && !m_stale_keys.contains(key))
+      write(key, physical_addresses);
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Rewrote the persistent block cache with {} JIT blocks", written);
+}
@@ -0,0 +1,88 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
+class JitBase;
+
+namespace Memory
+{
+class MemoryManager;
+}
+
+// Remembers which guest blocks were compiled during previous sessions of a game, so that they can
+// be compiled again before the CPU thread starts instead of one by one as the game reaches them.
+//
+// Only the guest side of a block is stored (entry address, MSR bits and the physical addresses of
+// its instructions) together with a hash of the instructions. Entries whose code no longer matches
+// guest memory (self-modifying code, patches, different disc revision...) are skipped, and those
+// blocks will be compiled on demand as usual.
+//
+// The file is appended to at the end of each session. It is rewritten with only the blocks that
+// are still in use when it grows past MAX_ENTRIES or when too many of its entries went stale.
+class JitBlockDiskCache
+{
+public:
+  static constexpr size_t MAX_ENTRIES = 0x10000;
+
+  struct DiskKey
+  {
+    u32 effective_address;
+    u32 msr_bits;
+    u32 physical_address;
+    u32 padding;
+    u64 code_hash;
+
+    auto operator<=>(const DiskKey&) const = default;
+  };
+  static_assert(sizeof(DiskKey) == 24);
+
+  // Maps each block to the physical addresses of its instructions
+  using EntryMap = std::map<DiskKey, std::vector<u32>>;
+
+  // Reads the block list for the given game and compiles every block that is still valid.
+  // Must be called on the CPU thread.
+  void LoadAndPrecompile(JitBase& jit, const std::string& game_id, u16 revision);
+
+  // Writes the blocks currently in the block cache which aren't on disk yet, then closes the file.
+  void Save(JitBase& jit);
+
+  // The file handling behind LoadAndPrecompile and Save, which doesn't need a JIT.
+  void Open(const std::string& filename);
+  // Marks an entry whose code didn't match guest memory. It is dropped at the next rewrite unless
+  // the block gets compiled again before then.
+  void MarkStale(const DiskKey& key);
+  // Appends the live entries that aren't on disk yet, or rewrites the file, then closes it.
+  void Close(const EntryMap& live_entries);
+
+  const EntryMap& GetEntries() const { return m_entries; }
+  // Can be more than the number of entries if the file contains duplicates
+  u32 GetRecordsOnDisk() const { return m_records_on_disk; }
+
+private:
+  // Returns std::nullopt if any of the addresses is outside of MEM1/MEM2.
+  static std::optional<u64> HashGuestCode(Memory::MemoryManager& memory,
+                                          const u32* physical_addresses, u32 count);
+
+  void Rewrite(const EntryMap& live_entries);
+
+  Common::LinearDiskCache<DiskKey, u32> m_disk_cache;
+  std::string m_filename;
+  // Every distinct entry on disk
+  EntryMap m_entries;
+  // Entries on disk whose code didn't match guest memory when they were loaded
+  std::set<DiskKey> m_stale_keys;
+  // The number of records OpenAndRead found, including duplicates
+  u32 m_records_on_disk = 0;
+  bool m_is_open = false;
+};
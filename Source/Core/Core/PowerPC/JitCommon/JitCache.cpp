@@ -28,8 +28,8 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  return std::lower_bound(physical_addresses.begin(), physical_addresses.end(), address) !=
+         std::lower_bound(physical_addresses.begin(), physical_addresses.end(), address + length);
 }
 
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
@@ -72,6 +72,8 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.hotBlockAddresses.clear();
+  m_jit.js.hotBranchAddresses.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -127,20 +129,30 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   m_fast_block_map_ptr[index] = &block;
   block.fast_block_map_index = index;
 
-  block.physical_addresses = physical_addresses;
+  block.physical_addresses.assign(physical_addresses.begin(), physical_addresses.end());
 
+  // The addresses are sorted, so all addresses of one macro block are next to each other.
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  for (u32 addr : physical_addresses)
+  std::vector<JitBlock*>* range = nullptr;
+  u32 range_start = 0;
+  for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & range_mask].insert(&block);
+    if (!range || (addr & range_mask) != range_start)
+    {
+      range_start = addr & range_mask;
+      range = &block_range_map[range_start];
+      range->push_back(&block);
+    }
   }
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      std::vector<JitBlock*>& sources = links_to[e.exitAddress];
+      if (std::find(sources.begin(), sources.end(), &block) == sources.end())
+        sources.push_back(&block);
     }
 
     LinkBlock(block);
@@ -279,6 +291,8 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.hotBlockAddresses.erase(i);
+        m_jit.js.hotBranchAddresses.erase(i);
       }
     }
   }
@@ -293,17 +307,27 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   while (start != end)
   {
     // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    std::vector<JitBlock*>& blocks_in_range = start->second;
+    size_t i = 0;
+    while (i < blocks_in_range.size())
     {
-      JitBlock* block = *iter;
+      JitBlock* block = blocks_in_range[i];
       if (block->OverlapsPhysicalRange(address, length))
       {
         // If the block overlaps, also remove all other occupied slots in the other macro blocks.
         // This will leak empty macro blocks, but they may be reused or cleared later on.
+        u32 previous_range = start->first;
         for (u32 addr : block->physical_addresses)
-          if ((addr & range_mask) != start->first)
-            block_range_map[addr & range_mask].erase(block);
+        {
+          const u32 range = addr & range_mask;
+          if (range == previous_range || range == start->first)
+            continue;
+          previous_range = range;
+
+          auto other = block_range_map.find(range);
+          if (other != block_range_map.end())
+            std::erase(other->second, block);
+        }
 
         // And remove the block.
         DestroyBlock(*block);
@@ -317,11 +341,13 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
           }
           block_map_iter.first++;
         }
-        iter = start->second.erase(iter);
+        // The order within a macro block doesn't matter, so swap in the last element.
+        blocks_in_range[i] = blocks_in_range.back();
+        blocks_in_range.pop_back();
       }
       else
       {
-        iter++;
+        i++;
       }
     }
 
@@ -419,7 +445,7 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     auto it = links_to.find(e.exitAddress);
     if (it == links_to.end())
       continue;
-    it->second.erase(&block);
+    std::erase(it->second, &block);
     if (it->second.empty())
       links_to.erase(it);
   }
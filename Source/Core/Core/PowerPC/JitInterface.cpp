@@ -22,10 +22,13 @@
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -331,8 +334,31 @@ void JitInterface::CompileExceptionCheckFromJIT(JitInterface& jit_interface, Exc
   jit_interface.CompileExceptionCheck(type);
 }
 
+void JitInterface::CompileHotBlocks(TimePoint deadline)
+{
+  if (m_jit)
+    m_jit->CompileHotBlocks(deadline);
+}
+
+void JitInterface::PrecompileCachedBlocks(const Core::CPUThreadGuard&)
+{
+  if (!m_jit || m_jit->IsDebuggingEnabled() ||
+      !Config::Get(Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE))
+  {
+    return;
+  }
+
+  const SConfig& config = SConfig::GetInstance();
+  m_block_disk_cache = std::make_unique<JitBlockDiskCache>();
+  m_block_disk_cache->LoadAndPrecompile(*m_jit, config.GetGameID(), config.GetRevision());
+}
+
 void JitInterface::Shutdown()
 {
+  if (m_jit && m_block_disk_cache)
+    m_block_disk_cache->Save(*m_jit);
+  m_block_disk_cache.reset();
+
   if (m_jit)
   {
     m_jit->Shutdown();
@@ -13,9 +13,11 @@
 class CPUCoreBase;
 class PointerWrap;
 class JitBase;
+class JitBlockDiskCache;
 
 namespace Core
 {
+class CPUThreadGuard;
 class System;
 }
 namespace PowerPC
@@ -95,6 +97,13 @@ public:
   void CompileExceptionCheck(ExceptionType type);
   static void CompileExceptionCheckFromJIT(JitInterface& jit_interface, ExceptionType type);
 
+  // Uses the time until the deadline to recompile blocks that the JIT has queued
+  void CompileHotBlocks(TimePoint deadline);
+
+  // Compiles the blocks remembered from previous sessions of the running game, if the persistent
+  // block cache is enabled. Must be called after the game has been loaded into memory.
+  void PrecompileCachedBlocks(const Core::CPUThreadGuard& guard);
+
   /// used for the page fault unit test, don't use outside of tests!
   void SetJit(std::unique_ptr<JitBase> jit);
 
@@ -102,5 +111,6 @@ public:
 
 private:
   std::unique_ptr<JitBase> m_jit;
+  std::unique_ptr<JitBlockDiskCache> m_block_disk_cache;
   Core::System& m_system;
 };
@@ -813,6 +813,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     SetInstructionStats(block, &code[i], opinfo);
 
     bool follow = false;
+    bool follow_conditional = false;
 
     bool conditional_continue = false;
 
@@ -843,6 +844,14 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
           caller = i;
         }
       }
+      else if (inst.OPCD == 16 && !inst.LK && m_hot_branches && block_size > 1 &&
+               code[i].branchTo > address && code[i].branchTo != block->m_address &&
+               m_hot_branches->contains(address))
+      {
+        // Follow the taken side of a conditional branch which was found to be hot at runtime.
+        follow = true;
+        follow_conditional = true;
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
@@ -909,8 +918,9 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
-      // Follow the unconditional branch.
+      // Follow the branch.
       numFollows++;
+      code[i].conditionalBranchFollowed = follow_conditional;
       address = code[i].branchTo;
     }
     else
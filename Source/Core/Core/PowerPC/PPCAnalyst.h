@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -50,6 +51,9 @@ struct CodeOp  // 16B
   bool canCauseException = false;
   bool skipLRStack = false;
   bool skip = false;  // followed BL-s for example
+  // A conditional branch whose taken side was followed. The block continues at branchTo, and
+  // falling through leaves the block.
+  bool conditionalBranchFollowed = false;
   // which registers are still needed after this instruction in this block
   BitSet32 fprInUse;
   BitSet32 gprInUse;
@@ -176,6 +180,9 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  // Conditional branches listed here have their taken side followed like an unconditional branch
+  // (if OPTION_BRANCH_FOLLOW is set). Requires JIT support.
+  void SetHotBranches(const std::unordered_set<u32>* hot_branches) { m_hot_branches = hot_branches; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
@@ -200,6 +207,7 @@ private:
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  const std::unordered_set<u32>* m_hot_branches = nullptr;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
 };
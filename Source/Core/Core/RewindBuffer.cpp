@@ -0,0 +1,198 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Common/Assert.h"
+
+namespace State
+{
+RewindBuffer::RewindBuffer(size_t memory_budget, u32 keyframe_interval)
+    : m_memory_budget(memory_budget), m_keyframe_interval(std::max<u32>(keyframe_interval, 1))
+{
+}
+
+size_t RewindBuffer::Entry::GetMemoryUsage() const
+{
+  size_t usage = 0;
+  for (const RegionDelta& region : regions)
+    usage += region.data.size() + region.changed_pages.size() * sizeof(u32);
+  return usage;
+}
+
+void RewindBuffer::SetMemoryBudget(size_t memory_budget)
+{
+  m_memory_budget = memory_budget;
+  EnforceMemoryBudget();
+}
+
+RewindBuffer::RegionDelta RewindBuffer::DiffRegion(std::span<const u8> region,
+                                                   std::vector<u8>& previous,
+                                                   const ChangedPages* changed_pages)
+{
+  if (region.size() != previous.size())
+  {
+    previous.assign(region.begin(), region.end());
+    return RegionDelta{true, previous, {}};
+  }
+
+  if (changed_pages && changed_pages->bitmap.empty())
+    changed_pages = nullptr;
+
+  RegionDelta delta{false, {}, {}};
+  for (size_t offset = 0; offset < region.size(); offset += DELTA_PAGE_SIZE)
+  {
+    if (changed_pages)
+    {
+      const size_t page = offset / changed_pages->page_size;
+      if (page / 64 < changed_pages->bitmap.size() &&
+          !(changed_pages->bitmap[page / 64] & (u64{1} << (page % 64))))
+      {
+        continue;
+      }
+    }
+
+    const size_t length = std::min(DELTA_PAGE_SIZE, region.size() - offset);
+    if (std::memcmp(region.data() + offset, previous.data() + offset, length) == 0)
+      continue;
+
+    delta.changed_pages.push_back(static_cast<u32>(offset / DELTA_PAGE_SIZE));
+    delta.data.insert(delta.data.end(), region.begin() + offset, region.begin() + offset + length);
+    std::memcpy(previous.data() + offset, region.data() + offset, length);
+  }
+  return delta;
+}
+
+void RewindBuffer::Push(u64 frame, const SnapshotView& snapshot,
+                        const std::vector<ChangedPages>& changed_pages)
+{
+  ASSERT(m_entries.empty() || m_entries.back().frame < frame);
+
+  Entry entry{frame, false, {}};
+  if (m_entries.empty() || m_last_snapshot.size() != snapshot.size() ||
+      m_deltas_since_keyframe + 1 >= m_keyframe_interval)
+  {
+    entry.is_keyframe = true;
+    m_last_snapshot.resize(snapshot.size());
+    for (size_t i = 0; i < snapshot.size(); ++i)
+    {
+      m_last_snapshot[i].assign(snapshot[i].begin(), snapshot[i].end());
+      entry.regions.push_back(RegionDelta{true, m_last_snapshot[i], {}});
+    }
+    m_deltas_since_keyframe = 0;
+  }
+  else
+  {
+    for (size_t i = 0; i < snapshot.size(); ++i)
+    {
+      const ChangedPages* region_changed_pages =
+          i < changed_pages.size() ? &changed_pages[i] : nullptr;
+      entry.regions.push_back(DiffRegion(snapshot[i], m_last_snapshot[i], region_changed_pages));
+    }
+    ++m_deltas_since_keyframe;
+  }
+
+  m_memory_usage += entry.GetMemoryUsage();
+  m_entries.push_back(std::move(entry));
+
+  EnforceMemoryBudget();
+}
+
+std::optional<u64> RewindBuffer::Rewind(u64 frame, Snapshot& snapshot)
+{
+  if (m_entries.empty())
+    return std::nullopt;
+
+  const auto after = std::upper_bound(m_entries.begin(), m_entries.end(), frame,
+                                      [](u64 f, const Entry& entry) { return f < entry.frame; });
+  const size_t target = after == m_entries.begin() ? 0 : after - m_entries.begin() - 1;
+
+  size_t keyframe = target;
+  while (!m_entries[keyframe].is_keyframe)
+    --keyframe;
+
+  snapshot.clear();
+  for (const RegionDelta& region : m_entries[keyframe].regions)
+    snapshot.push_back(region.data);
+  for (size_t i = keyframe + 1; i <= target; ++i)
+    ApplyDelta(m_entries[i], snapshot);
+
+  while (m_entries.size() > target + 1)
+  {
+    m_memory_usage -= m_entries.back().GetMemoryUsage();
+    m_entries.pop_back();
+  }
+  m_deltas_since_keyframe = static_cast<u32>(target - keyframe);
+  m_last_snapshot = snapshot;
+
+  return m_entries.back().frame;
+}
+
+void RewindBuffer::Clear()
+{
+  m_entries.clear();
+  m_last_snapshot.clear();
+  m_last_snapshot.shrink_to_fit();
+  m_memory_usage = 0;
+  m_deltas_since_keyframe = 0;
+}
+
+void RewindBuffer::ApplyDelta(const Entry& delta, Snapshot& snapshot)
+{
+  ASSERT(delta.regions.size() == snapshot.size());
+
+  for (size_t i = 0; i < snapshot.size(); ++i)
+  {
+    const RegionDelta& region_delta = delta.regions[i];
+    std::vector<u8>& region = snapshot[i];
+    if (region_delta.is_full)
+    {
+      region = region_delta.data;
+      continue;
+    }
+
+    size_t data_offset = 0;
+    for (const u32 page : region_delta.changed_pages)
+    {
+      const size_t offset = size_t{page} * DELTA_PAGE_SIZE;
+      const size_t length = std::min(DELTA_PAGE_SIZE, region.size() - offset);
+      std::memcpy(region.data() + offset, region_delta.data.data() + data_offset, length);
+      data_offset += length;
+    }
+  }
+}
+
+void RewindBuffer::EnforceMemoryBudget()
+{
+  // The first entry is always a keyframe. Dropping it only makes room if the next entry is a
+  // keyframe too; otherwise the next entry has to absorb it to stay reconstructible.
+  while (m_memory_usage > m_memory_budget && m_entries.size() > 1)
+  {
+    Entry& oldest = m_entries[0];
+    Entry& next = m_entries[1];
+    m_memory_usage -= oldest.GetMemoryUsage();
+
+    if (!next.is_keyframe)
+    {
+      m_memory_usage -= next.GetMemoryUsage();
+
+      Snapshot merged;
+      for (RegionDelta& region : oldest.regions)
+        merged.push_back(std::move(region.data));
+      ApplyDelta(next, merged);
+
+      next.is_keyframe = true;
+      next.regions.clear();
+      for (std::vector<u8>& region : merged)
+        next.regions.push_back(RegionDelta{true, std::move(region), {}});
+      m_memory_usage += next.GetMemoryUsage();
+    }
+
+    m_entries.pop_front();
+  }
+}
+}  // namespace State
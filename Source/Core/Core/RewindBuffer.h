@@ -0,0 +1,103 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// A history of savestates that fits into a fixed amount of memory.
+//
+// A snapshot consists of several regions which are diffed independently, so that a region which
+// changes size (like the serialized part of a savestate) doesn't misalign the ones that don't
+// (like guest memory). Most snapshots are stored as the pages of each region that changed since
+// the previous snapshot; a region whose size changed is stored in full. Every keyframe_interval
+// snapshots a full copy is stored instead, which bounds how many deltas have to be applied to
+// reconstruct a snapshot. When the memory budget is exceeded, the oldest snapshot is merged into
+// the one after it.
+//
+// The buffer keeps a copy of the newest snapshot to diff against. Pushing a snapshot only copies
+// the pages that changed into it, so a snapshot can be pushed straight from guest memory without
+// copying all of it first.
+class RewindBuffer
+{
+public:
+  static constexpr size_t DELTA_PAGE_SIZE = 4096;
+
+  using Snapshot = std::vector<std::vector<u8>>;
+  // The regions of a snapshot that is being pushed. Push copies what it needs from them.
+  using SnapshotView = std::vector<std::span<const u8>>;
+
+  // Which pages of a region may have changed since the previous snapshot, one bit per page_size
+  // bytes (page i is bit i % 64 of word i / 64). page_size must be a multiple of DELTA_PAGE_SIZE.
+  // Pages whose bit isn't set aren't compared or copied. An empty bitmap means that nothing is
+  // known.
+  struct ChangedPages
+  {
+    size_t page_size = 0;
+    std::vector<u64> bitmap;
+  };
+
+  RewindBuffer(size_t memory_budget, u32 keyframe_interval);
+
+  void SetMemoryBudget(size_t memory_budget);
+
+  // Adds a snapshot that was taken at the given frame. Frames must be pushed in increasing order.
+  // changed_pages optionally has an entry for each region of the snapshot.
+  void Push(u64 frame, const SnapshotView& snapshot,
+            const std::vector<ChangedPages>& changed_pages = {});
+
+  // Reconstructs the newest snapshot that was taken at or before the given frame (or the oldest
+  // snapshot, if they are all newer) and discards all snapshots after it. Returns the frame that
+  // the snapshot was taken at, or std::nullopt if the buffer is empty.
+  std::optional<u64> Rewind(u64 frame, Snapshot& snapshot);
+
+  void Clear();
+
+  bool IsEmpty() const { return m_entries.empty(); }
+  // Must not be called on an empty buffer.
+  u64 GetNewestFrame() const { return m_entries.back().frame; }
+  size_t GetSnapshotCount() const { return m_entries.size(); }
+  // Doesn't include the copy of the newest snapshot that is kept around for diffing.
+  size_t GetMemoryUsage() const { return m_memory_usage; }
+
+private:
+  struct RegionDelta
+  {
+    bool is_full;
+    // If is_full, the whole region. Otherwise the contents of the changed pages, in the order of
+    // changed_pages. The last page of a region may be shorter than DELTA_PAGE_SIZE.
+    std::vector<u8> data;
+    std::vector<u32> changed_pages;
+  };
+
+  struct Entry
+  {
+    u64 frame;
+    bool is_keyframe;
+    std::vector<RegionDelta> regions;
+
+    size_t GetMemoryUsage() const;
+  };
+
+  // Also brings previous up to date with region
+  static RegionDelta DiffRegion(std::span<const u8> region, std::vector<u8>& previous,
+                                const ChangedPages* changed_pages);
+  static void ApplyDelta(const Entry& delta, Snapshot& snapshot);
+  void EnforceMemoryBudget();
+
+  std::deque<Entry> m_entries;
+  Snapshot m_last_snapshot;
+  size_t m_memory_usage = 0;
+  size_t m_memory_budget;
+  u32 m_keyframe_interval;
+  u32 m_deltas_since_keyframe = 0;
+};
+}  // namespace State
@@ -3,12 +3,16 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
 #include <filesystem>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -17,7 +21,9 @@
 #include <fmt/format.h>
 
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
+#include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -29,10 +35,12 @@
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/GeckoCode.h"
+#include "Core/HW/DSP.h"
 #include "Core/HW/HW.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/Wiimote.h"
@@ -40,6 +48,8 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
+#include "Core/StateCompression.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -48,23 +58,6 @@
 
 namespace State
 {
-#if defined(__LZO_STRICT_16BIT)
-static const u32 IN_LEN = 8 * 1024u;
-#elif defined(LZO_ARCH_I086) && !defined(LZO_HAVE_MM_HUGE_ARRAY)
-static const u32 IN_LEN = 60 * 1024u;
-#else
-static const u32 IN_LEN = 128 * 1024u;
-#endif
-
-static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
-
-static unsigned char __LZO_MMODEL out[OUT_LEN];
-
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
-
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
-
 static AfterLoadCallbackFunc s_on_after_load_callback;
 
 // Temporary undo state buffer
@@ -73,10 +66,16 @@ static std::mutex s_undo_load_buffer_mutex;
 
 static std::mutex s_load_or_save_in_progress_mutex;
 
+// Only accessed on the CPU thread (or while it is paused).
+static RewindBuffer s_rewind_buffer(0, 30);
+static u64 s_rewind_frame = 0;
+static bool s_rewind_capture_pending = false;
+
 struct CompressAndDumpState_args
 {
   std::vector<u8> buffer_vector;
   std::string filename;
+  int compression_level;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
 
@@ -96,7 +95,7 @@ static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 162;  // Last changed in PR 11767
+constexpr u32 STATE_VERSION = 163;  // Last changed for chunked Zstandard compression
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -168,7 +167,34 @@ static bool DoStateVersion(PointerWrap& p, std::string* version_created_by)
   return true;
 }
 
-static void DoState(PointerWrap& p)
+// MEM1, MEM2 and ARAM have a fixed size, so rewind snapshots keep them out of the serialized state
+// and store them as separate regions. That way the rewind buffer can diff them page by page even
+// when the serialized part changes size.
+static std::vector<std::span<u8>> GetRewindMemoryRegions(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+  std::vector<std::span<u8>> regions{{memory.GetRAM(), memory.GetRamSize()}};
+  if (memory.GetEXRAM())
+    regions.emplace_back(memory.GetEXRAM(), memory.GetExRamSize());
+  if (const std::span<u8> aram = system.GetDSP().GetDedicatedARAM(); !aram.empty())
+    regions.push_back(aram);
+  return regions;
+}
+
+static void LoadRewindMemoryRegions(Core::System& system, const RewindBuffer::Snapshot& snapshot)
+{
+  const std::vector<std::span<u8>> regions = GetRewindMemoryRegions(system);
+  ASSERT(snapshot.size() == regions.size() + 1);
+  for (size_t i = 0; i < regions.size() && i + 1 < snapshot.size(); ++i)
+  {
+    ASSERT(snapshot[i + 1].size() == regions[i].size());
+    system.GetMemory().PrepareForHostWrite(regions[i].data(), regions[i].size());
+    std::memcpy(regions[i].data(), snapshot[i + 1].data(),
+                std::min(regions[i].size(), snapshot[i + 1].size()));
+  }
+}
+
+static void DoState(PointerWrap& p, RewindBuffer::Snapshot* rewind_snapshot = nullptr)
 {
   std::string version_created_by;
   if (!DoStateVersion(p, &version_created_by))
@@ -230,7 +256,18 @@ static void DoState(PointerWrap& p)
   p.DoMarker("CoreTiming");
 
   // HW needs to be restored before PowerPC because the data cache might need to be flushed.
+  // The same goes for the guest memory that rewind snapshots store separately.
+  if (rewind_snapshot)
+  {
+    // When saving, the rewind buffer reads the regions straight from guest memory afterwards
+    if (p.IsReadMode())
+      LoadRewindMemoryRegions(system, *rewind_snapshot);
+    memory.SetExcludeRAMFromState(true);
+    system.GetDSP().SetExcludeARAMFromState(true);
+  }
   HW::DoState(system, p);
+  memory.SetExcludeRAMFromState(false);
+  system.GetDSP().SetExcludeARAMFromState(false);
   p.DoMarker("HW");
 
   system.GetPowerPC().DoState(p);
@@ -382,39 +419,15 @@ static void CompressAndDumpState(CompressAndDumpState_args& save_args)
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.gameID, std::size(header.gameID));
   header.size = s_use_compression ? (u32)buffer_size : 0;
+  header.compression = StateCompression::Zstd;
   header.time = GetSystemTimeAsDouble();
 
   f.WriteArray(&header, 1);
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
-    {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
-
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
-
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertFmtT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
-
-      if (cur_len != IN_LEN)
-        break;
-
-      i += cur_len;
-    }
+    if (!WriteZstdChunks(f, save_args.buffer_vector, save_args.compression_level))
+      PanicAlertFmtT("Internal Zstd Error - compression failed");
   }
   else  // uncompressed
   {
@@ -499,6 +512,8 @@ void SaveAs(const std::string& filename, bool wait)
           CompressAndDumpState_args save_args;
           save_args.buffer_vector = std::move(current_buffer);
           save_args.filename = filename;
+          save_args.compression_level = std::clamp(
+              Config::Get(Config::MAIN_SAVESTATE_COMPRESSION_LEVEL), 1, ZSTD_maxCLevel());
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -600,27 +615,28 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
-    lzo_uint i = 0;
-    while (true)
+    if (header.compression == StateCompression::Zstd)
     {
-      lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
-
-      if (!f.ReadArray(&cur_len, 1))
-        break;
-
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
+      if (!ReadZstdChunks(f, buffer))
       {
-        // This doesn't seem to happen anymore.
-        PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
-                       "Try loading the state again",
-                       res, i, new_len);
+        PanicAlertFmtT("Internal Zstd Error - decompression failed\n"
+                       "Try loading the state again");
         return;
       }
-
-      i += new_len;
+    }
+    else if (header.compression == StateCompression::LZO)
+    {
+      if (!ReadLZOChunks(f, buffer))
+      {
+        PanicAlertFmtT("Internal LZO Error - decompression failed\n"
+                       "Try loading the state again");
+        return;
+      }
+    }
+    else
+    {
+      Core::DisplayMessage("State uses an unknown compression method", 2000);
+      return;
     }
   }
   else  // uncompressed
@@ -688,6 +704,9 @@ void LoadAs(const std::string& filename)
 
         if (loaded)
         {
+          // The rewind history belongs to a different timeline now
+          s_rewind_buffer.Clear();
+
           if (loadedSuccessfully)
           {
             std::filesystem::path tempfilename(filename);
@@ -749,6 +768,10 @@ void Shutdown()
     std::lock_guard lk(s_undo_load_buffer_mutex);
     std::vector<u8>().swap(s_undo_load_buffer);
   }
+
+  s_rewind_buffer.Clear();
+  s_rewind_frame = 0;
+  s_rewind_capture_pending = false;
 }
 
 static std::string MakeStateFilename(int number)
@@ -834,4 +857,122 @@ void UndoSaveState()
   LoadAs(File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav");
 }
 
+// Must be called on the CPU thread. Only fills in the serialized part of the snapshot.
+static void SaveRewindSnapshot(RewindBuffer::Snapshot& snapshot)
+{
+  snapshot.resize(1);
+
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  DoState(p_measure, &snapshot);
+  const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+  snapshot[0].resize(buffer_size);
+
+  ptr = snapshot[0].data();
+  PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+  DoState(p, &snapshot);
+}
+
+// Must be called on the CPU thread.
+static void LoadRewindSnapshot(RewindBuffer::Snapshot& snapshot)
+{
+  u8* ptr = snapshot[0].data();
+  PointerWrap p(&ptr, snapshot[0].size(), PointerWrap::Mode::Read);
+  DoState(p, &snapshot);
+}
+
+static void CaptureRewindSnapshot()
+{
+  s_rewind_capture_pending = false;
+  if (!Config::Get(Config::MAIN_REWIND_ENABLE) || NetPlay::IsNetPlayRunning())
+    return;
+
+  // Skip the capture if we've rewound to (or past) this frame since it was requested.
+  if (!s_rewind_buffer.IsEmpty() && s_rewind_buffer.GetNewestFrame() >= s_rewind_frame)
+    return;
+
+  // Saving can write back to guest memory (the video backend flushes its caches first), so the
+  // dirty pages are only fetched afterwards.
+  RewindBuffer::Snapshot snapshot;
+  SaveRewindSnapshot(snapshot);
+
+  // Rewind is the user of MEM1 and MEM2 dirty tracking, which lets the rewind buffer skip comparing
+  // and copying the pages that weren't written to since the previous snapshot. The regions are in
+  // the order of GetRewindMemoryRegions, after the serialized state.
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  std::vector<RewindBuffer::ChangedPages> changed_pages;
+  if (memory.IsDirtyTrackingEnabled())
+  {
+    constexpr size_t page_size = Memory::MemoryManager::DIRTY_PAGE_SIZE;
+    changed_pages.push_back({});
+    changed_pages.push_back(
+        {page_size, memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1)});
+    if (memory.GetEXRAM())
+    {
+      changed_pages.push_back(
+          {page_size, memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM2)});
+    }
+  }
+  else
+  {
+    // Nothing is known about the writes before this point, so this snapshot is compared in full.
+    memory.EnableDirtyTracking();
+  }
+
+  RewindBuffer::SnapshotView view{snapshot[0]};
+  for (const std::span<u8> region : GetRewindMemoryRegions(system))
+    view.push_back(region);
+
+  s_rewind_buffer.SetMemoryBudget(size_t{Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET)} << 20);
+  s_rewind_buffer.Push(s_rewind_frame, view, changed_pages);
+}
+
+void OnFrameEnd()
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLE) || NetPlay::IsNetPlayRunning())
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    if (memory.IsDirtyTrackingEnabled())
+      memory.DisableDirtyTracking();
+    return;
+  }
+
+  ++s_rewind_frame;
+  const u32 interval = std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1u);
+  if (s_rewind_frame % interval != 0 || s_rewind_capture_pending)
+    return;
+
+  // We're inside the VI CoreTiming event here, where CoreTiming hasn't rescheduled the event yet
+  // and the GPU thread may still be running. Take the snapshot the same way as a regular
+  // savestate instead: pause the emulation from the host thread and save between CPU slices.
+  s_rewind_capture_pending = true;
+  Core::QueueHostJob([] {
+    if (Core::IsRunning())
+      Core::RunOnCPUThread(CaptureRewindSnapshot, false);
+  });
+}
+
+void Rewind(u32 frames)
+{
+  if (!Core::IsRunning() || NetPlay::IsNetPlayRunning())
+    return;
+
+  Core::RunOnCPUThread(
+      [&] {
+        RewindBuffer::Snapshot snapshot;
+        const u64 target = s_rewind_frame - std::min<u64>(frames, s_rewind_frame);
+        const std::optional<u64> frame = s_rewind_buffer.Rewind(target, snapshot);
+        if (!frame)
+        {
+          Core::DisplayMessage("Nothing to rewind to", 1000);
+          return;
+        }
+
+        LoadRewindSnapshot(snapshot);
+        Core::DisplayMessage(fmt::format("Rewound {} frames", s_rewind_frame - *frame), 1000);
+        s_rewind_frame = *frame;
+      },
+      true);
+}
 }  // namespace State
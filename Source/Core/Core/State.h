@@ -17,12 +17,25 @@ namespace State
 // number of states
 static const u32 NUM_STATES = 10;
 
+enum class StateCompression : u32
+{
+  // Blocks of up to 128 KiB, each prefixed with its compressed size. This field used to be
+  // reserved and always 0, so all older states use this.
+  LZO = 0,
+  // Independent Zstandard frames of STATE_CHUNK_SIZE bytes (except for the last one), each
+  // prefixed with its compressed size.
+  Zstd = 1,
+};
+
+// Uncompressed size of the chunks of a StateCompression::Zstd state.
+constexpr u32 STATE_CHUNK_SIZE = 1024 * 1024;
+
 struct StateHeader
 {
   char gameID[6];
   u16 reserved1;
-  u32 size;
-  u32 reserved2;
+  u32 size;  // Uncompressed size, or 0 if the state isn't compressed
+  StateCompression compression;
   double time;
 };
 constexpr size_t STATE_HEADER_SIZE = sizeof(StateHeader);
@@ -64,6 +77,11 @@ void SaveFirstSaved();
 void UndoSaveState();
 void UndoLoadState();
 
+// Called by the CPU thread at the end of every frame to capture rewind snapshots.
+void OnFrameEnd();
+// Goes back to the newest rewind snapshot that is at least the given number of frames old.
+void Rewind(u32 frames);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -0,0 +1,230 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/StateCompression.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <lzo/lzo1x.h>
+#include <zstd.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/ThreadPool.h"
+#include "Core/State.h"
+
+namespace State
+{
+#if defined(__LZO_STRICT_16BIT)
+static const u32 IN_LEN = 8 * 1024u;
+#elif defined(LZO_ARCH_I086) && !defined(LZO_HAVE_MM_HUGE_ARRAY)
+static const u32 IN_LEN = 60 * 1024u;
+#else
+static const u32 IN_LEN = 128 * 1024u;
+#endif
+
+static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
+
+// How many chunks that have been read but not decompressed yet are kept in memory per thread
+static constexpr size_t READ_AHEAD_CHUNKS_PER_THREAD = 2;
+
+// The threads are kept around between saves and loads, since a state is saved every few seconds
+// with auto-saving and rewinding to a savestate. Saving and loading take turns using them.
+static std::mutex s_thread_pool_mutex;
+static std::unique_ptr<Common::ThreadPool> s_thread_pool;
+
+template <typename Func>
+static void RunWithThreadPool(Func func)
+{
+  std::lock_guard lock(s_thread_pool_mutex);
+  if (!s_thread_pool)
+  {
+    s_thread_pool = std::make_unique<Common::ThreadPool>(
+        std::max(std::thread::hardware_concurrency(), 1u), "Savestate Compression");
+  }
+  func(*s_thread_pool);
+}
+
+bool WriteZstdChunks(File::IOFile& f, std::span<const u8> data, int level)
+{
+  const size_t chunk_count = (data.size() + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE;
+
+  std::mutex chunks_mutex;
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  std::vector<bool> chunks_done(chunk_count);
+
+  std::mutex write_mutex;
+  size_t next_chunk_to_write = 0;
+  bool error = false;
+
+  // Writes the chunks that are done, in order. Only one thread writes at a time, and the others
+  // move on to compressing the next chunk instead of waiting for it.
+  const auto write_done_chunks = [&] {
+    std::unique_lock write_lock(write_mutex, std::try_to_lock);
+    while (write_lock)
+    {
+      while (next_chunk_to_write < chunk_count)
+      {
+        std::vector<u8> out;
+        {
+          std::lock_guard lock(chunks_mutex);
+          if (!chunks_done[next_chunk_to_write])
+            break;
+          out = std::move(chunks[next_chunk_to_write]);
+        }
+
+        // An empty chunk is how the compression reports an error
+        const u32 out_len = static_cast<u32>(out.size());
+        if (out.empty() || !f.WriteArray(&out_len, 1) || !f.WriteBytes(out.data(), out.size()))
+          error = true;
+        ++next_chunk_to_write;
+      }
+      const size_t next_chunk = next_chunk_to_write;
+      write_lock.unlock();
+
+      // The thread that finished the next chunk may have found the lock taken by this thread
+      {
+        std::lock_guard lock(chunks_mutex);
+        if (next_chunk == chunk_count || !chunks_done[next_chunk])
+          return;
+      }
+      write_lock.try_lock();
+    }
+  };
+
+  RunWithThreadPool([&](Common::ThreadPool& thread_pool) {
+    thread_pool.ParallelFor(static_cast<u32>(chunk_count), [&](u32 chunk) {
+      const size_t offset = size_t{chunk} * STATE_CHUNK_SIZE;
+      const size_t in_len = std::min<size_t>(STATE_CHUNK_SIZE, data.size() - offset);
+
+      std::vector<u8> out(ZSTD_compressBound(in_len));
+      const size_t out_len = ZSTD_compress(out.data(), out.size(), data.data() + offset, in_len,
+                                           level);
+      if (ZSTD_isError(out_len))
+        out.clear();
+      else
+        out.resize(out_len);
+
+      {
+        std::lock_guard lock(chunks_mutex);
+        chunks[chunk] = std::move(out);
+        chunks_done[chunk] = true;
+      }
+      write_done_chunks();
+    });
+  });
+
+  // All chunks are done now, so this writes whatever is left
+  write_done_chunks();
+  return !error;
+}
+
+bool ReadZstdChunks(File::IOFile& f, std::span<u8> buffer)
+{
+  const size_t chunk_count = (buffer.size() + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE;
+
+  // The calling thread reads the chunks one at a time and hands them to the other threads. It
+  // decompresses chunks itself whenever it gets too far ahead of them, so that the whole file is
+  // never in memory at once, and once it's done reading.
+  std::mutex mutex;
+  std::condition_variable chunk_read;
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  size_t chunks_read = 0;
+  size_t next_chunk = 0;
+  bool reading_done = false;
+  bool error = false;
+
+  // Returns false once there are no more chunks to decompress
+  const auto decompress_next_chunk = [&](std::unique_lock<std::mutex>& lock) {
+    chunk_read.wait(lock, [&] { return next_chunk < chunks_read || reading_done; });
+    if (next_chunk == chunks_read)
+      return false;
+
+    const size_t chunk = next_chunk++;
+    const std::vector<u8> in = std::move(chunks[chunk]);
+    lock.unlock();
+
+    const size_t offset = chunk * STATE_CHUNK_SIZE;
+    const size_t out_len = std::min<size_t>(STATE_CHUNK_SIZE, buffer.size() - offset);
+    const size_t result = ZSTD_decompress(buffer.data() + offset, out_len, in.data(), in.size());
+
+    lock.lock();
+    if (ZSTD_isError(result) || result != out_len)
+      error = true;
+    return true;
+  };
+
+  RunWithThreadPool([&](Common::ThreadPool& thread_pool) {
+    const size_t max_chunks_ahead = READ_AHEAD_CHUNKS_PER_THREAD * thread_pool.GetThreadCount();
+
+    thread_pool.RunOnAllThreads([&](u32 thread) {
+      std::unique_lock lock(mutex);
+      if (thread == 0)
+      {
+        for (size_t chunk = 0; chunk < chunk_count && !error; ++chunk)
+        {
+          while (chunks_read - next_chunk >= max_chunks_ahead)
+            decompress_next_chunk(lock);
+          lock.unlock();
+
+          u32 chunk_size;
+          std::vector<u8> in;
+          bool read_ok = f.ReadArray(&chunk_size, 1);
+          if (read_ok)
+          {
+            in.resize(chunk_size);
+            read_ok = f.ReadBytes(in.data(), in.size());
+          }
+
+          lock.lock();
+          if (!read_ok)
+          {
+            error = true;
+            break;
+          }
+          chunks[chunk] = std::move(in);
+          ++chunks_read;
+          chunk_read.notify_one();
+        }
+        reading_done = true;
+        chunk_read.notify_all();
+      }
+
+      while (decompress_next_chunk(lock))
+      {
+      }
+    });
+  });
+
+  return !error;
+}
+
+bool ReadLZOChunks(File::IOFile& f, std::span<u8> buffer)
+{
+  std::vector<u8> in(OUT_LEN);
+  size_t position = 0;
+  lzo_uint32 in_len;
+  while (f.ReadArray(&in_len, 1))
+  {
+    if (in_len > in.size() || !f.ReadBytes(in.data(), in_len))
+      return false;
+
+    lzo_uint out_len = buffer.size() - position;
+    const int result = lzo1x_decompress_safe(in.data(), in_len, buffer.data() + position,
+                                             &out_len, nullptr);
+    if (result != LZO_E_OK)
+    {
+      ERROR_LOG_FMT(CORE, "LZO decompression failed ({}) at {}", result, position);
+      return false;
+    }
+    position += out_len;
+  }
+  return position == buffer.size();
+}
+}  // namespace State
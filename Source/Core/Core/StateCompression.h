@@ -0,0 +1,27 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Compressed savestate data, which follows the StateHeader.
+
+#pragma once
+
+#include <span>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+}
+
+namespace State
+{
+// Writes the data as the chunks of a StateCompression::Zstd state. The chunks are compressed on
+// several threads, and each one is written as soon as it and all chunks before it are done.
+bool WriteZstdChunks(File::IOFile& f, std::span<const u8> data, int level);
+
+// Read the chunks of a state from the current position of the file into buffer, which must have
+// the uncompressed size of the state. Return false if the data is truncated or corrupt.
+bool ReadZstdChunks(File::IOFile& f, std::span<u8> buffer);
+bool ReadLZOChunks(File::IOFile& f, std::span<u8> buffer);
+}  // namespace State
@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/BatchConversion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
+
+namespace DiscIO
+{
+// Returns a path that compares equal for every spelling of the same file, or the path unchanged if
+// that can't be determined.
+static std::string GetCanonicalPath(const std::string& path)
+{
+  std::error_code error;
+  const std::filesystem::path canonical_path =
+      std::filesystem::weakly_canonical(StringToPath(path), error);
+  return error ? path : PathToString(canonical_path);
+}
+
+std::optional<std::vector<std::string>> ReadBatchInputList(const std::string& list_file_path)
+{
+  std::string contents;
+  if (!File::ReadFileToString(list_file_path, contents))
+    return std::nullopt;
+
+  std::vector<std::string> input_paths;
+  for (const std::string& line : SplitString(contents, '\n'))
+  {
+    const std::string_view path = StripWhitespace(line);
+    if (!path.empty())
+      input_paths.emplace_back(path);
+  }
+  return input_paths;
+}
+
+BatchConversionPlan PlanBatchConversion(const std::vector<std::string>& input_paths,
+                                        const std::string& output_directory,
+                                        std::string_view extension)
+{
+  BatchConversionPlan plan;
+  std::unordered_set<std::string> canonical_output_paths;
+
+  for (const std::string& input_path : input_paths)
+  {
+    std::string name;
+    SplitPath(input_path, nullptr, &name, nullptr);
+    std::string output_path = fmt::format("{}/{}.{}", output_directory, name, extension);
+
+    const std::string canonical_output_path = GetCanonicalPath(output_path);
+    if (canonical_output_path == GetCanonicalPath(input_path))
+    {
+      plan.errors.push_back({input_path, "The output file would overwrite the input file"});
+      continue;
+    }
+
+    if (!canonical_output_paths.insert(canonical_output_path).second)
+    {
+      plan.errors.push_back(
+          {input_path, fmt::format("Another disc image has the same output path {}", output_path)});
+      continue;
+    }
+
+    plan.jobs.push_back({input_path, std::move(output_path)});
+  }
+
+  return plan;
+}
+
+BatchConversionResult RunBatchConversion(const std::vector<BatchConversionJob>& jobs,
+                                         u32 thread_count, const BatchConvertFunction& convert,
+                                         const BatchPrintFunction& print)
+{
+  std::atomic<size_t> converted = 0;
+  std::atomic<size_t> skipped = 0;
+  std::atomic<size_t> failed = 0;
+  std::atomic<u64> bytes_read = 0;
+  std::atomic<u64> bytes_written = 0;
+
+  const auto start_time = std::chrono::steady_clock::now();
+
+  Common::ThreadPool thread_pool(
+      static_cast<u32>(std::clamp<size_t>(jobs.size(), 1, std::max(thread_count, 1u))),
+      "Batch Conversion");
+  thread_pool.ParallelFor(static_cast<u32>(jobs.size()), [&](u32 i) {
+    const BatchConversionJob& job = jobs[i];
+
+    if (File::Exists(job.output_path))
+    {
+      print(job, fmt::format("Skipped, {} already exists\n", job.output_path));
+      ++skipped;
+      return;
+    }
+
+    const std::string temp_path = job.output_path + ".part";
+    if (!convert(job, temp_path))
+    {
+      File::Delete(temp_path, File::IfAbsentBehavior::NoConsoleWarning);
+      ++failed;
+      return;
+    }
+
+    if (!File::Rename(temp_path, job.output_path))
+    {
+      print(job, fmt::format("Error: Could not rename {} to {}\n", temp_path, job.output_path));
+      File::Delete(temp_path);
+      ++failed;
+      return;
+    }
+
+    bytes_read += File::GetSize(job.input_path);
+    bytes_written += File::GetSize(job.output_path);
+    ++converted;
+    print(job, fmt::format("Converted to {}\n", job.output_path));
+  });
+
+  BatchConversionResult result;
+  result.converted = converted;
+  result.skipped = skipped;
+  result.failed = failed;
+  result.bytes_read = bytes_read;
+  result.bytes_written = bytes_written;
+  result.seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  return result;
+}
+}  // namespace DiscIO
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Converting many disc images into one folder, as done by dolphin-tool convert when given a folder
+// or a list of disc images. The conversion of a single disc image is left to the caller.
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+struct BatchConversionJob
+{
+  std::string input_path;
+  std::string output_path;
+};
+
+struct BatchConversionError
+{
+  std::string input_path;
+  std::string message;
+};
+
+struct BatchConversionPlan
+{
+  std::vector<BatchConversionJob> jobs;
+  // Disc images that can't be converted, in the order they were given in
+  std::vector<BatchConversionError> errors;
+};
+
+struct BatchConversionResult
+{
+  size_t converted = 0;
+  size_t skipped = 0;
+  size_t failed = 0;
+  u64 bytes_read = 0;
+  u64 bytes_written = 0;
+  double seconds = 0;
+};
+
+// Called with the job and the path to write the output file to. Returns whether it succeeded.
+using BatchConvertFunction =
+    std::function<bool(const BatchConversionJob& job, const std::string& output_path)>;
+using BatchPrintFunction =
+    std::function<void(const BatchConversionJob& job, std::string_view message)>;
+
+// Reads a text file with one path per line. Empty lines and whitespace around paths are ignored.
+std::optional<std::vector<std::string>> ReadBatchInputList(const std::string& list_file_path);
+
+// Picks an output path in output_directory for each disc image, named after the disc image with
+// the given extension. Disc images whose output path would be the disc image itself, or the output
+// path of a disc image earlier in the list, are reported as errors instead.
+BatchConversionPlan PlanBatchConversion(const std::vector<std::string>& input_paths,
+                                        const std::string& output_directory,
+                                        std::string_view extension);
+
+// Runs up to thread_count conversions at the same time. Jobs whose output file already exists are
+// skipped, which lets an interrupted batch be resumed by running it again. Each output is written
+// under a temporary name and only renamed once complete, so that the file left behind by an
+// interrupted conversion isn't skipped. convert and print may be called from several threads at
+// the same time.
+BatchConversionResult RunBatchConversion(const std::vector<BatchConversionJob>& jobs,
+                                         u32 thread_count, const BatchConvertFunction& convert,
+                                         const BatchPrintFunction& print);
+}  // namespace DiscIO
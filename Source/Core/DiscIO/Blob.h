@@ -96,6 +96,10 @@ public:
     return false;
   }
 
+  // Lets formats that are slow to decompress keep up to memory_budget bytes of decompressed data
+  // around, and decompress data ahead of sequential reads on other threads. 0 turns this off.
+  virtual void SetReadaheadMemoryBudget(u64 memory_budget) {}
+
 protected:
   BlobReader() {}
 };
@@ -193,14 +197,16 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// For GCZ, WIA and RVZ, compression_threads limits how many threads compress at the same time.
+// 0 means one thread per CPU core.
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  CompressCB callback);
+                  CompressCB callback, unsigned int compression_threads = 0);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, CompressCB callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, CompressCB callback, unsigned int compression_threads = 0);
 
 }  // namespace DiscIO
@@ -271,7 +271,7 @@ static ConversionResultCode Output(OutputParameters parameters, File::IOFile* ou
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int block_size,
-                  CompressCB callback)
+                  CompressCB callback, unsigned int compression_threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -323,7 +323,7 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
-      SetUpCompressThreadState, compress, output);
+      SetUpCompressThreadState, compress, output, compression_threads);
 
   std::vector<u8> in_buf(block_size);
   for (u32 i = 0; i < header.num_blocks; i++)
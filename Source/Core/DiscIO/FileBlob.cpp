@@ -15,6 +15,25 @@
 
 namespace DiscIO
 {
+// How far ahead of sequential reads data gets prefetched
+constexpr u64 READAHEAD_SIZE = 4 * 1024 * 1024;
+
+void FileReadahead::OnRead(File::IOFile& file, u64 offset, u64 size, u64 file_size)
+{
+  const u64 end = offset + size;
+  if (offset == m_last_read_end && end + READAHEAD_SIZE / 2 > m_prefetched_until)
+  {
+    const u64 prefetch_start = std::max(end, m_prefetched_until);
+    const u64 prefetch_end = std::min(end + READAHEAD_SIZE, file_size);
+    if (prefetch_start < prefetch_end)
+    {
+      file.Prefetch(prefetch_start, prefetch_end - prefetch_start);
+      m_prefetched_until = prefetch_end;
+    }
+  }
+  m_last_read_end = end;
+}
+
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
@@ -30,6 +49,8 @@ std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  m_readahead.OnRead(m_file, offset, nbytes, m_size);
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -13,6 +13,19 @@
 
 namespace DiscIO
 {
+// Asks the OS to read ahead of sequential reads from a file, so that they don't have to wait for
+// slow storage like network shares. Reads still go through IOFile, so errors are reported as
+// failed reads.
+class FileReadahead
+{
+public:
+  void OnRead(File::IOFile& file, u64 offset, u64 size, u64 file_size);
+
+private:
+  u64 m_last_read_end = 0;
+  u64 m_prefetched_until = 0;
+};
+
 class PlainFileReader : public BlobReader
 {
 public:
@@ -35,6 +48,7 @@ private:
   PlainFileReader(File::IOFile file);
 
   File::IOFile m_file;
+  FileReadahead m_readahead;
   u64 m_size;
 };
 
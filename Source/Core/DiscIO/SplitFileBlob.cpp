@@ -44,7 +44,7 @@ std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_v
     const u64 size = f.GetSize();
     if (size == 0)
       return nullptr;
-    files.emplace_back(SingleFile{std::move(f), offset, size});
+    files.emplace_back(SingleFile{std::move(f), offset, size, {}});
     offset += size;
     ++index;
   }
@@ -71,6 +71,7 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
+      file.readahead.OnRead(f, seek_offset, current_read, file.size);
       if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
       {
         f.ClearError();
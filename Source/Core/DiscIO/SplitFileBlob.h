@@ -12,6 +12,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/FileBlob.h"
 
 namespace DiscIO
 {
@@ -39,6 +40,7 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+    FileReadahead readahead;
   };
 
   SplitPlainFileReader(std::vector<SingleFile> m_files);
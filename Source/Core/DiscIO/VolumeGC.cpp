@@ -143,6 +143,11 @@ const BlobReader& VolumeGC::GetBlobReader() const
   return *m_reader;
 }
 
+void VolumeGC::SetReadaheadMemoryBudget(u64 memory_budget)
+{
+  m_reader->SetReadaheadMemoryBudget(memory_budget);
+}
+
 Platform VolumeGC::GetVolumeType() const
 {
   return Platform::GameCubeDisc;
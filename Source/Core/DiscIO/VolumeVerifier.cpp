@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -357,7 +358,9 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
   return {Status::Unknown, Common::GetStringT("Unknown disc")};
 }
 
-constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// Large enough that the per-chunk hashing overhead doesn't matter and that reads from disc images
+// stay efficient, and the same as the size of a Wii group.
+constexpr u64 DEFAULT_READ_SIZE = 0x200000;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -1065,6 +1068,9 @@ void VolumeVerifier::SetUpHashing()
   std::sort(m_groups.begin(), m_groups.end(),
             [](const GroupToVerify& a, const GroupToVerify& b) { return a.offset < b.offset; });
 
+  if (!m_groups.empty())
+    StartBlockCheckThreads();
+
   if (m_hashes_to_calculate.crc32)
     m_crc32_context = Common::StartCRC32();
 
@@ -1094,6 +1100,63 @@ void VolumeVerifier::WaitForAsyncOperations() const
     m_group_future.wait();
 }
 
+void VolumeVerifier::StartBlockCheckThreads()
+{
+  // While a group is being checked, the thread calling Process reads the next chunk and each hash
+  // has its own thread. Only use the remaining cores, including the one checking the group.
+  const u32 hash_threads = u32{m_hashes_to_calculate.crc32} + u32{m_hashes_to_calculate.md5} +
+                           u32{m_hashes_to_calculate.sha1};
+  const u32 cores = std::max<u32>(1, std::thread::hardware_concurrency());
+  const u32 reserved_cores = std::min(cores, hash_threads + 2);
+  const u32 thread_count = std::min<u32>(cores - reserved_cores, VolumeWii::BLOCKS_PER_GROUP - 1);
+
+  for (u32 i = 0; i < thread_count; ++i)
+  {
+    m_block_check_threads.push_back(std::make_unique<Common::WorkQueueThread<BlockRange>>(
+        "Verify Blocks", [this](BlockRange range) { CheckBlocks(range); }));
+  }
+}
+
+std::vector<u8> VolumeVerifier::CheckGroupIntegrity(const GroupToVerify& group)
+{
+  const size_t blocks = group.block_index_end - group.block_index_start;
+  std::vector<u8> valid_blocks(blocks, false);
+  if (blocks == 0)
+    return valid_blocks;
+
+  // The partition key and H3 table are loaded lazily, which isn't thread-safe,
+  // so check the first block before the block check threads start
+  CheckBlocks({&group, &valid_blocks, 0, 1});
+
+  // This thread checks the first share of the remaining blocks itself
+  const size_t remaining_blocks = blocks - 1;
+  const size_t shares = std::min(remaining_blocks, m_block_check_threads.size() + 1);
+  for (size_t i = 1; i < shares; ++i)
+  {
+    m_block_check_threads[i - 1]->Push({&group, &valid_blocks, 1 + i * remaining_blocks / shares,
+                                        1 + (i + 1) * remaining_blocks / shares});
+  }
+
+  if (shares != 0)
+    CheckBlocks({&group, &valid_blocks, 1, 1 + remaining_blocks / shares});
+
+  for (size_t i = 1; i < shares; ++i)
+    m_block_check_threads[i - 1]->WaitForCompletion();
+
+  return valid_blocks;
+}
+
+void VolumeVerifier::CheckBlocks(const BlockRange& range) const
+{
+  for (size_t i = range.start; i < range.end; ++i)
+  {
+    (*range.valid_blocks)[i] =
+        m_volume.CheckBlockIntegrity(range.group->block_index_start + i,
+                                     m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                     range.group->partition);
+  }
+}
+
 bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
 {
   std::vector<u8> data(bytes_to_read);
@@ -1243,14 +1306,16 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const std::vector<u8> valid_blocks =
+          read_failed ? std::vector<u8>() : CheckGroupIntegrity(group);
+
       u64 offset_in_group = 0;
       for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
            ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+        if (!read_failed && valid_blocks[block_index - group.block_index_start])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
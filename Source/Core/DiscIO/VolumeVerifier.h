@@ -14,6 +14,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -144,6 +145,14 @@ private:
     size_t block_index_end;
   };
 
+  struct BlockRange
+  {
+    const GroupToVerify* group;
+    std::vector<u8>* valid_blocks;
+    size_t start;  // Relative to group->block_index_start
+    size_t end;
+  };
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -157,6 +166,10 @@ private:
   void CheckSuperPaperMario();
   void SetUpHashing();
   void WaitForAsyncOperations() const;
+  void StartBlockCheckThreads();
+  // Returns whether each block in the group has correct H0-H3 hashes. Reads from m_data.
+  std::vector<u8> CheckGroupIntegrity(const GroupToVerify& group);
+  void CheckBlocks(const BlockRange& range) const;
   bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
 
   void AddProblem(Severity severity, std::string text);
@@ -192,6 +205,7 @@ private:
   u16 m_content_index = 0;
   std::vector<GroupToVerify> m_groups;
   size_t m_group_index = 0;  // Index in m_groups, not index in a specific partition
+  std::vector<std::unique_ptr<Common::WorkQueueThread<BlockRange>>> m_block_check_threads;
   std::map<Partition, size_t> m_block_errors;
   std::map<Partition, size_t> m_unused_block_errors;
 
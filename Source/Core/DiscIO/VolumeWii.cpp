@@ -389,6 +389,11 @@ const BlobReader& VolumeWii::GetBlobReader() const
   return *m_reader;
 }
 
+void VolumeWii::SetReadaheadMemoryBudget(u64 memory_budget)
+{
+  m_reader->SetReadaheadMemoryBudget(memory_budget);
+}
+
 std::array<u8, 20> VolumeWii::GetSyncHash() const
 {
   auto context = Common::SHA1::CreateContext();
@@ -90,6 +90,7 @@ public:
   DataSizeType GetDataSizeType() const override;
   u64 GetRawSize() const override;
   const BlobReader& GetBlobReader() const override;
+  void SetReadaheadMemoryBudget(u64 memory_budget) override;
   std::array<u8, 20> GetSyncHash() const override;
 
   // The in parameter can either contain all the data to begin with,
@@ -11,8 +11,11 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <zstd.h>
@@ -79,13 +82,22 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_encryption_cache(this)
+    : m_path(path), m_file(std::move(file)), m_encryption_cache(this)
 {
   m_valid = Initialize(path);
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  StopReadahead();
+
+  if (m_chunk_cache_memory_budget != 0)
+  {
+    INFO_LOG_FMT(DISCIO, "Chunk cache for {}: {} hits, {} misses", m_path,
+                 m_chunk_cache_stats.hits, m_chunk_cache_stats.misses);
+  }
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -498,45 +510,51 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
     const u64 total_group_index = group_index + i;
-    if (total_group_index >= m_group_entries.size())
-      return false;
-
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
+    const u64 full_chunk_size = chunk_size;
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
+    ChunkRequest request;
+    if (!GetGroupChunkRequest(total_group_index, group_offset_in_data, chunk_size,
+                              exception_lists, &request))
     {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
+      return false;
+    }
 
-      group_data_size &= 0x7FFFFFFF;
+    if (total_group_index != m_last_read_group_index)
+    {
+      if (total_group_index == m_last_read_group_index + 1)
+        ++m_sequential_group_reads;
+      else
+        m_sequential_group_reads = 0;
+
+      m_last_read_group_index = total_group_index;
 
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
+      if (m_sequential_group_reads >= SEQUENTIAL_GROUP_READS_FOR_READAHEAD)
+      {
+        ReadAhead(i + 1, full_chunk_size, data_size, group_index, number_of_groups,
+                  exception_lists);
+      }
     }
 
-    if (group_data_size == 0)
+    if (request.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(request.offset_in_file, request.compressed_size,
+                                        request.decompressed_size, request.compression_type,
+                                        request.exception_lists, request.rvz_packed_size,
+                                        request.data_offset);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk();
         return false;
       }
 
@@ -567,10 +585,64 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
   if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+    return *m_cached_chunk;
+
+  m_cached_chunk = GetFromChunkCache(offset_in_file);
+  if (!m_cached_chunk)
+  {
+    m_cached_chunk =
+        CreateChunk(&m_file, {offset_in_file, compressed_size, decompressed_size, compression_type,
+                              exception_lists, rvz_packed_size, data_offset});
+    InsertIntoChunkCache(offset_in_file, m_cached_chunk);
+  }
+
+  m_cached_chunk_offset = offset_in_file;
+  return *m_cached_chunk;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::GetGroupChunkRequest(u64 total_group_index, u64 group_offset_in_data,
+                                                 u64 chunk_size, u32 exception_lists,
+                                                 ChunkRequest* request) const
+{
+  if (total_group_index >= m_group_entries.size())
+    return false;
+
+  const GroupEntry& group = m_group_entries[total_group_index];
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  // A compressed size of 0 means that the group is all zeroes
+  request->offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  request->compressed_size = group_data_size;
+  request->decompressed_size = chunk_size;
+  request->compression_type = compression_type;
+  request->exception_lists = exception_lists;
+  request->rvz_packed_size = rvz_packed_size;
+  request->data_offset = group_offset_in_data;
+  return true;
+}
+
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkRequest& request) const
+{
+  const u64 decompressed_size = request.decompressed_size;
+  const u32 rvz_packed_size = request.rvz_packed_size;
 
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (request.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
@@ -595,13 +667,215 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      request.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return std::make_shared<Chunk>(file, request.offset_in_file, request.compressed_size,
+                                 decompressed_size, request.exception_lists,
+                                 compressed_exception_lists, rvz_packed_size, request.data_offset,
+                                 std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk()
+{
+  if (m_cached_chunk)
+    RemoveFromChunkCache(m_cached_chunk_offset, m_cached_chunk.get());
+
+  m_cached_chunk.reset();
+  m_cached_chunk_offset = std::numeric_limits<u64>::max();
+}
+
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::GetFromChunkCache(u64 offset_in_file)
+{
+  std::unique_lock lk(m_chunk_cache_mutex);
+  if (m_chunk_cache_memory_budget == 0)
+    return nullptr;
+
+  auto it = m_chunk_cache.find(offset_in_file);
+
+  // If a readahead worker is busy with the chunk we want, waiting for it is faster than starting
+  // over. If the worker fails, the entry gets removed and we decompress the chunk ourselves.
+  while (it != m_chunk_cache.end() && !it->second.chunk)
+  {
+    m_chunk_cache_cond_var.wait(lk);
+    it = m_chunk_cache.find(offset_in_file);
+  }
+
+  if (it == m_chunk_cache.end())
+  {
+    ++m_chunk_cache_stats.misses;
+    return nullptr;
+  }
+
+  ++m_chunk_cache_stats.hits;
+  it->second.last_use = ++m_chunk_cache_use_counter;
+  return it->second.chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InsertIntoChunkCache(u64 offset_in_file, std::shared_ptr<Chunk> chunk)
+{
+  std::lock_guard lk(m_chunk_cache_mutex);
+  if (m_chunk_cache_memory_budget == 0)
+    return;
+
+  CachedChunk& entry = m_chunk_cache[offset_in_file];
+  m_chunk_cache_memory_usage -= entry.memory_usage;
+  entry.memory_usage = chunk->GetMemoryUsage();
+  m_chunk_cache_memory_usage += entry.memory_usage;
+  entry.chunk = std::move(chunk);
+  entry.last_use = ++m_chunk_cache_use_counter;
+
+  EvictFromChunkCache();
+  m_chunk_cache_cond_var.notify_all();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::RemoveFromChunkCache(u64 offset_in_file, const Chunk* chunk)
+{
+  std::lock_guard lk(m_chunk_cache_mutex);
+
+  const auto it = m_chunk_cache.find(offset_in_file);
+  if (it == m_chunk_cache.end() || it->second.chunk.get() != chunk)
+    return;
+
+  m_chunk_cache_memory_usage -= it->second.memory_usage;
+  m_chunk_cache.erase(it);
+  m_chunk_cache_cond_var.notify_all();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::EvictFromChunkCache()
+{
+  // Evict the least recently used chunks. Entries that are still being decompressed count towards
+  // the memory usage, but can't be evicted until they are done.
+  while (m_chunk_cache_memory_usage > m_chunk_cache_memory_budget)
+  {
+    auto lru = m_chunk_cache.end();
+    for (auto it = m_chunk_cache.begin(); it != m_chunk_cache.end(); ++it)
+    {
+      if (!it->second.chunk)
+        continue;
+      if (lru == m_chunk_cache.end() || it->second.last_use < lru->second.last_use)
+        lru = it;
+    }
+
+    if (lru == m_chunk_cache.end())
+      return;
+
+    m_chunk_cache_memory_usage -= lru->second.memory_usage;
+    m_chunk_cache.erase(lru);
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ReadAhead(u64 first_group, u64 chunk_size, u64 data_size,
+                                      u32 group_index, u32 number_of_groups, u32 exception_lists)
+{
+  if (m_readahead_workers.empty())
+    return;
+
+  const u64 last_group = std::min<u64>(first_group + m_readahead_groups, number_of_groups);
+  for (u64 i = first_group; i < last_group; ++i)
+  {
+    const u64 group_offset_in_data = i * chunk_size;
+    ChunkRequest request;
+    if (!GetGroupChunkRequest(group_index + i, group_offset_in_data,
+                              std::min(chunk_size, data_size - group_offset_in_data),
+                              exception_lists, &request))
+    {
+      return;
+    }
+
+    if (request.compressed_size == 0)
+      continue;
+
+    {
+      std::lock_guard lk(m_chunk_cache_mutex);
+      const auto [it, inserted] = m_chunk_cache.try_emplace(request.offset_in_file);
+      if (!inserted)
+        continue;
+
+      // Reserve memory for the compressed and the decompressed data right away, so that the chunks
+      // that are in flight can't make the cache exceed its budget
+      it->second.memory_usage = request.compressed_size + request.decompressed_size;
+      m_chunk_cache_memory_usage += it->second.memory_usage;
+      EvictFromChunkCache();
+    }
+
+    m_readahead_workers[m_next_readahead_worker]->thread.Push(request);
+    m_next_readahead_worker = (m_next_readahead_worker + 1) % m_readahead_workers.size();
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::DecompressAhead(File::IOFile* file, const ChunkRequest& request)
+{
+  std::shared_ptr<Chunk> chunk = CreateChunk(file, request);
+  if (chunk->DecompressAll())
+    InsertIntoChunkCache(request.offset_in_file, std::move(chunk));
+  else
+    RemoveFromChunkCache(request.offset_in_file, nullptr);
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::SetReadaheadMemoryBudget(u64 memory_budget)
+{
+  StopReadahead();
+
+  {
+    std::lock_guard lk(m_chunk_cache_mutex);
+    m_chunk_cache.clear();
+    m_chunk_cache_memory_usage = 0;
+    m_chunk_cache_memory_budget = memory_budget;
+  }
+
+  // A chunk takes up to about twice the chunk size in memory (compressed and decompressed data).
+  // Use at most half of the budget for chunks that haven't been read yet, leaving the rest for
+  // chunks that might get read again.
+  const u64 chunk_size = std::max<u64>(Common::swap32(m_header_2.chunk_size), 1);
+  m_readahead_groups = std::min(memory_budget / 2 / (chunk_size * 2), MAX_READAHEAD_GROUPS);
+  if (m_readahead_groups == 0)
+    return;
+
+  const u32 thread_count = std::clamp<u32>(std::thread::hardware_concurrency() / 2, 1,
+                                           MAX_READAHEAD_THREADS);
+  for (u32 i = 0; i < thread_count; ++i)
+  {
+    // Each worker needs its own file handle, since reading from a file involves seeking
+    auto worker = std::make_unique<ReadaheadWorker>();
+    if (!worker->file.Open(m_path, "rb"))
+    {
+      WARN_LOG_FMT(DISCIO, "Failed to open {} for readahead", m_path);
+      break;
+    }
+
+    File::IOFile* file = &worker->file;
+    worker->thread.Reset(RVZ ? "RVZ Readahead" : "WIA Readahead",
+                         [this, file](ChunkRequest request) { DecompressAhead(file, request); });
+    m_readahead_workers.push_back(std::move(worker));
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::StopReadahead()
+{
+  for (std::unique_ptr<ReadaheadWorker>& worker : m_readahead_workers)
+    worker->thread.Shutdown(true);
+
+  m_readahead_workers.clear();
+  m_next_readahead_worker = 0;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkCacheStats
+WIARVZFileReader<RVZ>::GetChunkCacheStats() const
+{
+  std::lock_guard lk(m_chunk_cache_mutex);
+  return m_chunk_cache_stats;
 }
 
 template <bool RVZ>
@@ -644,17 +918,33 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (!DecompressTo(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressTo(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressTo(u64 end_offset)
 {
   if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
+      end_offset > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
   {
     return false;
   }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  while (end_offset > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end_offset == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -667,7 +957,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end_offset - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -747,7 +1037,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1729,7 +2018,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               unsigned int compression_threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1836,7 +2126,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, compression_threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -2028,7 +2318,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, unsigned int compression_threads)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2046,7 +2336,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, compression_threads);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
@@ -4,17 +4,21 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -66,9 +70,19 @@ public:
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
   bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override;
 
+  void SetReadaheadMemoryBudget(u64 memory_budget) override;
+
+  struct ChunkCacheStats
+  {
+    u64 hits = 0;
+    u64 misses = 0;
+  };
+  ChunkCacheStats GetChunkCacheStats() const;
+
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      unsigned int compression_threads = 0);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -192,6 +206,9 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool DecompressAll();
+
+    size_t GetMemoryUsage() const { return m_in.data.size() + m_out.data.size(); }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -204,6 +221,7 @@ private:
     }
 
   private:
+    bool DecompressTo(u64 end_offset);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -227,6 +245,32 @@ private:
     u64 m_data_offset = 0;
   };
 
+  struct ChunkRequest
+  {
+    u64 offset_in_file = 0;
+    u64 compressed_size = 0;
+    u64 decompressed_size = 0;
+    WIARVZCompressionType compression_type{};
+    u32 exception_lists = 0;
+    u32 rvz_packed_size = 0;
+    u64 data_offset = 0;
+  };
+
+  struct CachedChunk
+  {
+    // nullptr while a readahead worker is still decompressing the chunk
+    std::shared_ptr<Chunk> chunk;
+    // Counted towards m_chunk_cache_memory_usage. An estimate while the chunk is being decompressed
+    u64 memory_usage = 0;
+    u64 last_use = 0;
+  };
+
+  struct ReadaheadWorker
+  {
+    File::IOFile file;
+    Common::WorkQueueThread<ChunkRequest> thread;
+  };
+
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
   bool Initialize(const std::string& path);
   bool HasDataOverlap() const;
@@ -236,9 +280,24 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  bool GetGroupChunkRequest(u64 total_group_index, u64 group_offset_in_data, u64 chunk_size,
+                            u32 exception_lists, ChunkRequest* request) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  std::shared_ptr<Chunk> CreateChunk(File::IOFile* file, const ChunkRequest& request) const;
+  void InvalidateCachedChunk();
+
+  std::shared_ptr<Chunk> GetFromChunkCache(u64 offset_in_file);
+  void InsertIntoChunkCache(u64 offset_in_file, std::shared_ptr<Chunk> chunk);
+  void RemoveFromChunkCache(u64 offset_in_file, const Chunk* chunk);
+  // Requires m_chunk_cache_mutex to be held
+  void EvictFromChunkCache();
+
+  void ReadAhead(u64 first_group, u64 chunk_size, u64 data_size, u32 group_index,
+                 u32 number_of_groups, u32 exception_lists);
+  void DecompressAhead(File::IOFile* file, const ChunkRequest& request);
+  void StopReadahead();
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -364,11 +423,28 @@ private:
   bool m_valid;
   WIARVZCompressionType m_compression_type;
 
+  std::string m_path;
   File::IOFile m_file;
-  Chunk m_cached_chunk;
+  std::shared_ptr<Chunk> m_cached_chunk;
   u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  // Chunks that have been decompressed recently or ahead of time, keyed by offset in the file.
+  // Only used when a readahead memory budget has been set.
+  std::map<u64, CachedChunk> m_chunk_cache;
+  mutable std::mutex m_chunk_cache_mutex;
+  std::condition_variable m_chunk_cache_cond_var;
+  u64 m_chunk_cache_memory_budget = 0;
+  u64 m_chunk_cache_memory_usage = 0;
+  u64 m_chunk_cache_use_counter = 0;
+  ChunkCacheStats m_chunk_cache_stats;
+
+  std::vector<std::unique_ptr<ReadaheadWorker>> m_readahead_workers;
+  size_t m_next_readahead_worker = 0;
+  u64 m_readahead_groups = 0;
+  u64 m_last_read_group_index = std::numeric_limits<u64>::max();
+  u32 m_sequential_group_reads = 0;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
@@ -392,6 +468,11 @@ private:
   static constexpr u32 RVZ_VERSION = 0x01000000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+
+  // Readahead starts once this many groups in a row have been read in order
+  static constexpr u32 SEQUENTIAL_GROUP_READS_FOR_READAHEAD = 2;
+  static constexpr u64 MAX_READAHEAD_GROUPS = 16;
+  static constexpr u32 MAX_READAHEAD_THREADS = 4;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
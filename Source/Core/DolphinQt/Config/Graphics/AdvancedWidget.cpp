@@ -160,12 +160,18 @@ void AdvancedWidget::CreateWidgets()
       // i18n: VS is short for vertex shaders.
       tr("Prefer VS for Point/Line Expansion"), Config::GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION);
   m_cpu_cull = new ConfigBool(tr("Cull Vertices on the CPU"), Config::GFX_CPU_CULL);
+  m_vertex_loader_cache =
+      new ConfigBool(tr("Cache Converted Vertices"), Config::GFX_VERTEX_LOADER_CACHE);
+  m_display_list_cache =
+      new ConfigBool(tr("Cache Decoded Display Lists"), Config::GFX_DISPLAY_LIST_CACHE);
 
   misc_layout->addWidget(m_enable_cropping, 0, 0);
   misc_layout->addWidget(m_enable_prog_scan, 0, 1);
   misc_layout->addWidget(m_backend_multithreading, 1, 0);
   misc_layout->addWidget(m_prefer_vs_for_point_line_expansion, 1, 1);
   misc_layout->addWidget(m_cpu_cull, 2, 0);
+  misc_layout->addWidget(m_vertex_loader_cache, 3, 0);
+  misc_layout->addWidget(m_display_list_cache, 3, 1);
 #ifdef _WIN32
   m_borderless_fullscreen =
       new ConfigBool(tr("Borderless Fullscreen"), Config::GFX_BORDERLESS_FULLSCREEN);
@@ -182,9 +188,12 @@ void AdvancedWidget::CreateWidgets()
       new ConfigBool(tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION);
   m_manual_texture_sampling =
       new ConfigBool(tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, true);
+  m_backend_recording_thread =
+      new ConfigBool(tr("Record Draws on a Separate Thread"), Config::GFX_BACKEND_RECORDING_THREAD);
 
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_backend_recording_thread, 1, 0);
 
   main_layout->addWidget(performance_box);
   main_layout->addWidget(debugging_box);
@@ -233,6 +242,7 @@ void AdvancedWidget::SaveSettings()
 void AdvancedWidget::OnBackendChanged()
 {
   m_backend_multithreading->setEnabled(g_Config.backend_info.bSupportsMultithreading);
+  m_backend_recording_thread->setEnabled(g_Config.backend_info.bSupportsMultithreading);
   m_prefer_vs_for_point_line_expansion->setEnabled(
       g_Config.backend_info.bSupportsGeometryShaders &&
       g_Config.backend_info.bSupportsVSLinePointExpand);
@@ -375,6 +385,22 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Cull vertices on the CPU to reduce the number of draw calls required.  "
                  "May affect performance and draw statistics.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_VERTEX_LOADER_CACHE_DESCRIPTION[] =
+      QT_TR_NOOP("Remembers converted vertex data, so that geometry which is sent again with the "
+                 "same contents doesn't have to be converted again. Uses up to 32 MiB of memory. "
+                 "May affect performance.<br><br>"
+                 "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_DISPLAY_LIST_CACHE_DESCRIPTION[] =
+      QT_TR_NOOP("Remembers the decoded commands of display lists, so that a display list which is "
+                 "called again with the same contents doesn't have to be parsed again. "
+                 "May affect performance.<br><br>"
+                 "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_BACKEND_RECORDING_THREAD_DESCRIPTION[] =
+      QT_TR_NOOP("Records draw commands on a separate thread, so that decoding the next draws "
+                 "overlaps with recording the previous ones. Only has an effect when Backend "
+                 "Multithreading is enabled. Currently, this is limited to the Vulkan backend. "
+                 "May cause rendering issues.<br><br>"
+                 "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION[] = QT_TR_NOOP(
       "Defers invalidation of the EFB access cache until a GPU synchronization command "
       "is executed. If disabled, the cache will be invalidated with every draw call. "
@@ -448,9 +474,12 @@ void AdvancedWidget::AddDescriptions()
   m_prefer_vs_for_point_line_expansion->SetDescription(
       tr(TR_PREFER_VS_FOR_POINT_LINE_EXPANSION_DESCRIPTION).arg(vsexpand_extra));
   m_cpu_cull->SetDescription(tr(TR_CPU_CULL_DESCRIPTION));
+  m_vertex_loader_cache->SetDescription(tr(TR_VERTEX_LOADER_CACHE_DESCRIPTION));
+  m_display_list_cache->SetDescription(tr(TR_DISPLAY_LIST_CACHE_DESCRIPTION));
 #ifdef _WIN32
   m_borderless_fullscreen->SetDescription(tr(TR_BORDERLESS_FULLSCREEN_DESCRIPTION));
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_backend_recording_thread->SetDescription(tr(TR_BACKEND_RECORDING_THREAD_DESCRIPTION));
 }
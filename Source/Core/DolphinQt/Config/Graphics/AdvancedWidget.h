@@ -70,9 +70,12 @@ private:
   ConfigBool* m_backend_multithreading;
   ConfigBool* m_prefer_vs_for_point_line_expansion;
   ConfigBool* m_cpu_cull;
+  ConfigBool* m_vertex_loader_cache;
+  ConfigBool* m_display_list_cache;
   ConfigBool* m_borderless_fullscreen;
 
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_backend_recording_thread;
 };
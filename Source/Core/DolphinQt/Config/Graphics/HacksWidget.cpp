@@ -242,7 +242,9 @@ void HacksWidget::AddDescriptions()
       "Adjusts the accuracy at which the GPU receives texture updates from RAM.<br><br>"
       "The \"Safe\" setting eliminates the likelihood of the GPU missing texture updates "
       "from RAM. Lower accuracies cause in-game text to appear garbled in certain "
-      "games.<br><br><dolphin_emphasis>If unsure, select the rightmost "
+      "games.<br><br>This setting only applies to the older texture hashing, which is selected "
+      "by setting TextureHashVersion to 1. The default hashing always checks all of the "
+      "texture.<br><br><dolphin_emphasis>If unsure, select the rightmost "
       "value.</dolphin_emphasis>");
   static const char TR_STORE_XFB_TO_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
       "Stores XFB copies exclusively on the GPU, bypassing system memory. Causes graphical defects "
@@ -604,6 +604,9 @@ void HotkeyScheduler::Run()
     if (IsHotkey(HK_UNDO_SAVE_STATE))
       emit StateSaveUndo();
 
+    if (IsHotkey(HK_REWIND))
+      State::Rewind(Config::Get(Config::MAIN_REWIND_INTERVAL));
+
     if (IsHotkey(HK_LOAD_STATE_FILE))
       emit StateLoadFile();
 
@@ -3,11 +3,16 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +20,9 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/BatchConversion.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -25,6 +33,19 @@
 
 namespace DolphinTool
 {
+struct ConversionOptions
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  // Number of threads that compress a disc image. 0 means one per CPU core.
+  unsigned int compression_threads = 0;
+};
+
+using PrintFunction = std::function<void(std::string_view)>;
+
 static std::optional<DiscIO::WIARVZCompressionType>
 ParseCompressionTypeString(const std::string& compression_str)
 {
@@ -56,6 +77,176 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConversionOptions& options, const PrintFunction& print)
+{
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    print("Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (options.scrub)
+    {
+      print("Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    print("Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (options.scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      print("Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      print("Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (!options.scrub && options.format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    print("Warning: Converting Wii disc images to GCZ without scrubbing may not offer space "
+          "advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+    print("Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+
+  if (options.format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(options.block_size.value(), volume->GetDataSize()))
+  {
+    print("Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size must be an "
+          "integer multiple of the block size and must not be an integer multiple of the block "
+          "size multiplied by 32. Continuing anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (options.format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   options.block_size.value(), NOOP_STATUS_CALLBACK,
+                                   options.compression_threads);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path,
+        options.format == DiscIO::BlobType::RVZ, options.compression.value(),
+        options.compression_level.value(), options.block_size.value(), NOOP_STATUS_CALLBACK,
+        options.compression_threads);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success)
+  {
+    print("Error: Conversion failed\n");
+    return false;
+  }
+
+  return true;
+}
+
+// Converts many disc images into output_directory. Several disc images are converted at the same
+// time, so that one conversion can be reading or writing while another one is compressing. The
+// CPU cores are split between the jobs, so that they don't all start one compression thread per
+// core.
+static int ConvertBatch(const std::vector<std::string>& input_file_paths,
+                        const std::string& output_directory, const std::string& extension,
+                        const ConversionOptions& options, int jobs)
+{
+  const DiscIO::BatchConversionPlan plan =
+      DiscIO::PlanBatchConversion(input_file_paths, output_directory, extension);
+  for (const DiscIO::BatchConversionError& error : plan.errors)
+    fmt::print(std::cerr, "{}: Error: {}\n", error.input_path, error.message);
+
+  if (!File::IsDirectory(output_directory) && !File::CreateDirs(output_directory))
+  {
+    fmt::print(std::cerr, "Error: The output folder could not be created\n");
+    return EXIT_FAILURE;
+  }
+
+  const u32 thread_count = static_cast<u32>(std::min<size_t>(jobs, plan.jobs.size()));
+  ConversionOptions job_options = options;
+  if (thread_count != 0)
+  {
+    const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    job_options.compression_threads = std::max<unsigned int>(1, cores / thread_count);
+  }
+
+  std::mutex print_mutex;
+  const DiscIO::BatchPrintFunction print_for_job =
+      [&print_mutex](const DiscIO::BatchConversionJob& job, std::string_view message) {
+        std::lock_guard lk(print_mutex);
+        fmt::print(std::cerr, "{}: {}", job.input_path, message);
+      };
+
+  const DiscIO::BatchConversionResult result = DiscIO::RunBatchConversion(
+      plan.jobs, thread_count,
+      [&](const DiscIO::BatchConversionJob& job, const std::string& output_file_path) {
+        const PrintFunction print = [&](std::string_view message) { print_for_job(job, message); };
+        return ConvertFile(job.input_path, output_file_path, job_options, print);
+      },
+      print_for_job);
+
+  const size_t failed = plan.errors.size() + result.failed;
+  const double mib_read = result.bytes_read / double(1024 * 1024);
+  const double mib_written = result.bytes_written / double(1024 * 1024);
+
+  fmt::print(std::cout, "Converted {} of {} disc images ({} skipped, {} failed) in {:.1f} s\n",
+             result.converted, input_file_paths.size(), result.skipped, failed, result.seconds);
+  fmt::print(std::cout, "Read {:.1f} MiB and wrote {:.1f} MiB ({:.1f} MiB/s written)\n",
+             mib_read, mib_written, result.seconds > 0 ? mib_written / result.seconds : 0.0);
+
+  return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -72,13 +263,21 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-i", "--input")
       .type("string")
       .action("store")
-      .help("Path to disc image FILE.")
+      .help("Path to disc image FILE, or to a folder whose disc images should all be converted.")
+      .metavar("FILE");
+
+  parser.add_option("--input_list")
+      .type("string")
+      .action("store")
+      .help("Path to a text FILE listing one disc image to convert per line.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE, or to the destination folder when converting "
+            "multiple disc images. Disc images that already have an output file in that folder "
+            "are skipped.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -110,6 +309,13 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of disc images to convert at the same time when converting multiple disc "
+            "images. The CPU cores are split between them for compression. Default is 2.")
+      .set_default(2);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -119,13 +325,14 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   // Validate options
 
-  // --input
-  if (!options.is_set("input"))
+  // --input, --input_list
+  if (options.is_set("input") == options.is_set("input_list"))
   {
-    fmt::print(std::cerr, "Error: No input set\n");
+    fmt::print(std::cerr, "Error: Exactly one of --input and --input_list must be set\n");
     return EXIT_FAILURE;
   }
   const std::string& input_file_path = options["input"];
+  const bool is_batch = options.is_set("input_list") || File::IsDirectory(input_file_path);
 
   // --output
   if (!options.is_set("output"))
@@ -144,48 +351,9 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
   // --scrub
   const bool scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
   if (scrub && format == DiscIO::BlobType::RVZ)
   {
     fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
@@ -198,19 +366,6 @@ int ConvertCommand(const std::vector<std::string>& args)
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +392,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,58 +442,54 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
+  const ConversionOptions conversion_options{format, scrub, block_size_o, compression_o,
+                                             compression_level_o};
 
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
+  if (!is_batch)
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    const PrintFunction print = [](std::string_view message) {
+      fmt::print(std::cerr, "{}", message);
+    };
+    const bool success =
+        ConvertFile(input_file_path, output_file_path, conversion_options, print);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::GCZ:
+  // --jobs
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
-    {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
-    }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+    return EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
+  std::vector<std::string> input_file_paths;
+  if (options.is_set("input_list"))
   {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    std::optional<std::vector<std::string>> input_list =
+        DiscIO::ReadBatchInputList(options["input_list"]);
+    if (!input_list)
+    {
+      fmt::print(std::cerr, "Error: The input list could not be read\n");
+      return EXIT_FAILURE;
+    }
+    input_file_paths = std::move(*input_list);
   }
-
-  default:
+  else
   {
-    ASSERT(false);
-    break;
-  }
+    // .nfs is left out because NFS disc images are split into many files
+    input_file_paths = Common::DoFileSearch(
+        {input_file_path}, {".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz"});
+    std::sort(input_file_paths.begin(), input_file_paths.end());
   }
 
-  if (!success)
+  if (input_file_paths.empty())
   {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
+    fmt::print(std::cerr, "Error: No disc images to convert\n");
     return EXIT_FAILURE;
   }
 
-  return EXIT_SUCCESS;
+  return ConvertBatch(input_file_paths, output_file_path, options["format"], conversion_options,
+                      jobs);
 }
 }  // namespace DolphinTool
@@ -11,7 +11,9 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "Common/Config/Config.h"
 #include "Common/StringUtil.h"
+#include "Core/Config/MainSettings.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeVerifier.h"
 #include "UICommon/UICommon.h"
@@ -146,6 +148,10 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
+  // Let compressed formats decompress ahead of the verifier's sequential reads
+  volume->SetReadaheadMemoryBudget(u64{Config::Get(Config::MAIN_DISC_READAHEAD_MEMORY_BUDGET)}
+                                   << 20);
+
   // Verify the volume
   DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
   verifier.Start();
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <vector>
@@ -22,7 +23,7 @@ namespace EfbInterface
 {
 static std::array<u8, EFB_WIDTH * EFB_HEIGHT * 6> efb;
 
-static std::array<u32, PQ_NUM_MEMBERS> perf_values;
+static std::array<std::atomic<u32>, PQ_NUM_MEMBERS> perf_values;
 
 static inline u32 GetColorOffset(u16 x, u16 y)
 {
@@ -36,6 +37,20 @@ static inline u32 GetDepthOffset(u16 x, u16 y)
   return (x + y * EFB_WIDTH) * 3 + depth_buffer_start;
 }
 
+// Pixels are 3 bytes each. Only those bytes may be accessed, since the rasterizer writes
+// neighboring pixels from different threads.
+static inline u32 ReadPixel(u32 offset)
+{
+  u32 val = 0;
+  std::memcpy(&val, &efb[offset], 3);
+  return val;
+}
+
+static inline void WritePixel(u32 offset, u32 val)
+{
+  std::memcpy(&efb[offset], &val, 3);
+}
+
 static void SetPixelAlphaOnly(u32 offset, u8 a)
 {
   switch (bpmem.zcontrol.pixel_format)
@@ -48,10 +63,9 @@ static void SetPixelAlphaOnly(u32 offset, u8 a)
   case PixelFormat::RGBA6_Z24:
   {
     u32 a32 = a;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xffffffc0;
+    u32 val = ReadPixel(offset) & 0xffffc0;
     val |= (a32 >> 2) & 0x0000003f;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   default:
@@ -68,31 +82,28 @@ static void SetPixelColorOnly(u32 offset, u8* rgb)
   case PixelFormat::Z24:
   {
     u32 src = *(u32*)rgb;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= src >> 8;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   case PixelFormat::RGBA6_Z24:
   {
     u32 src = *(u32*)rgb;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff00003f;
+    u32 val = ReadPixel(offset) & 0x00003f;
     val |= (src >> 4) & 0x00000fc0;  // blue
     val |= (src >> 6) & 0x0003f000;  // green
     val |= (src >> 8) & 0x00fc0000;  // red
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   case PixelFormat::RGB565_Z16:
   {
     // TODO: RGB565_Z16 is not supported correctly yet
     u32 src = *(u32*)rgb;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= src >> 8;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   default:
@@ -109,32 +120,29 @@ static void SetPixelAlphaColor(u32 offset, u8* color)
   case PixelFormat::Z24:
   {
     u32 src = *(u32*)color;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= src >> 8;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   case PixelFormat::RGBA6_Z24:
   {
     u32 src = *(u32*)color;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= (src >> 2) & 0x0000003f;  // alpha
     val |= (src >> 4) & 0x00000fc0;  // blue
     val |= (src >> 6) & 0x0003f000;  // green
     val |= (src >> 8) & 0x00fc0000;  // red
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   case PixelFormat::RGB565_Z16:
   {
     // TODO: RGB565_Z16 is not supported correctly yet
     u32 src = *(u32*)color;
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= src >> 8;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   default:
@@ -145,8 +153,7 @@ static void SetPixelAlphaColor(u32 offset, u8* color)
 
 static u32 GetPixelColor(u32 offset)
 {
-  u32 src;
-  std::memcpy(&src, &efb[offset], sizeof(u32));
+  const u32 src = ReadPixel(offset);
 
   switch (bpmem.zcontrol.pixel_format)
   {
@@ -178,19 +185,17 @@ static void SetPixelDepth(u32 offset, u32 depth)
   case PixelFormat::RGBA6_Z24:
   case PixelFormat::Z24:
   {
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= depth & 0x00ffffff;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   case PixelFormat::RGB565_Z16:
   {
     // TODO: RGB565_Z16 is not supported correctly yet
-    u32* dst = (u32*)&efb[offset];
-    u32 val = *dst & 0xff000000;
+    u32 val = 0;
     val |= depth & 0x00ffffff;
-    *dst = val;
+    WritePixel(offset, val);
   }
   break;
   default:
@@ -209,13 +214,13 @@ static u32 GetPixelDepth(u32 offset)
   case PixelFormat::RGBA6_Z24:
   case PixelFormat::Z24:
   {
-    depth = (*(u32*)&efb[offset]) & 0x00ffffff;
+    depth = ReadPixel(offset);
   }
   break;
   case PixelFormat::RGB565_Z16:
   {
     // TODO: RGB565_Z16 is not supported correctly yet
-    depth = (*(u32*)&efb[offset]) & 0x00ffffff;
+    depth = ReadPixel(offset);
   }
   break;
   default:
@@ -696,12 +701,13 @@ bool ZCompare(u16 x, u16 y, u32 z)
 
 u32 GetPerfQueryResult(PerfQueryType type)
 {
-  return perf_values[type];
+  return perf_values[type].load(std::memory_order_relaxed);
 }
 
 void ResetPerfQuery()
 {
-  perf_values = {};
+  for (std::atomic<u32>& value : perf_values)
+    value.store(0, std::memory_order_relaxed);
 }
 
 void IncPerfCounterQuadCount(PerfQueryType type)
@@ -710,10 +716,11 @@ void IncPerfCounterQuadCount(PerfQueryType type)
   // Current software renderer architecture works on pixels though, so
   // we have this "quad" hack here to only increment the registers on
   // every fourth rendered pixel
-  static u32 quad[PQ_NUM_MEMBERS];
+  // The rasterizer threads each count their own pixels.
+  thread_local u32 quad[PQ_NUM_MEMBERS];
   if (++quad[type] != 3)
     return;
   quad[type] = 0;
-  ++perf_values[type];
+  perf_values[type].fetch_add(1, std::memory_order_relaxed);
 }
 }  // namespace EfbInterface
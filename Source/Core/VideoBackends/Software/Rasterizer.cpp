@@ -4,11 +4,20 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/ThreadPool.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
@@ -23,6 +32,7 @@
 
 namespace Rasterizer
 {
+// The size of the blocks that are rasterized at once, which are drawn as one quad by the Tev
 static constexpr int BLOCK_SIZE = 2;
 
 struct SlopeContext
@@ -96,21 +106,111 @@ struct Slope
   }
 };
 
+// Everything needed to rasterize a triangle within its bounding rectangle.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed point
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clipped to the scissor
+  s32 minx, maxx, miny, maxy;
+};
+
+// The state of one thread that rasterizes triangles.
+class RasterWorker
+{
+public:
+  void SetTevKonstColors() { m_tev.SetKonstColors(); }
+  void Rasterize(const TriangleSetup& tri, s32 minx, s32 maxx, s32 miny, s32 maxy);
+  void AddStatistics();
+
+private:
+  bool PreparePixel(const TriangleSetup& tri, s32 x, s32 y, s32 xi, s32 yi);
+  void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord);
+  void BuildBlock(const TriangleSetup& tri, s32 blockX, s32 blockY);
+
+  Tev m_tev;
+  RasterBlock m_raster_block;
+  u32 m_rasterized_pixels = 0;
+};
+
+// The EFB is split into tiles of TILE_SIZE x TILE_SIZE pixels. When there are several rasterizer
+// threads, triangles are only set up while a batch is being drawn and sorted into the tiles they
+// touch. At the end of the batch, the threads rasterize whole tiles, so no two threads ever touch
+// the same pixel, and the triangles within each tile are drawn in order. Since the BP registers
+// don't change within a batch, this gives the same results as drawing each triangle right away.
+static constexpr s32 TILE_SIZE = 64;
+static constexpr u32 TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 TILE_COUNT = TILES_X * TILES_Y;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0, "Blocks must not straddle tiles");
+
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// One worker for each thread of s_thread_pool, the first of which is the GPU thread.
+static std::vector<std::unique_ptr<RasterWorker>> s_workers;
+static std::unique_ptr<Common::ThreadPool> s_thread_pool;
+static std::atomic<u32> s_next_tile;
+
+static TriangleSetup s_setup;
+static std::vector<TriangleSetup> s_triangles;
+static std::array<std::vector<u32>, TILE_COUNT> s_tile_triangles;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+static void RasterizeTiles(RasterWorker& worker)
+{
+  for (u32 tile = s_next_tile.fetch_add(1, std::memory_order_relaxed); tile < TILE_COUNT;
+       tile = s_next_tile.fetch_add(1, std::memory_order_relaxed))
+  {
+    const s32 left = static_cast<s32>(tile % TILES_X) * TILE_SIZE;
+    const s32 top = static_cast<s32>(tile / TILES_X) * TILE_SIZE;
+
+    for (const u32 index : s_tile_triangles[tile])
+    {
+      const TriangleSetup& tri = s_triangles[index];
+      worker.Rasterize(tri, std::max(tri.minx, left), std::min(tri.maxx, left + TILE_SIZE),
+                       std::max(tri.miny, top), std::min(tri.maxy, top + TILE_SIZE));
+    }
+  }
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  s_thread_pool.reset();
+
+  int thread_count = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  if (thread_count <= 0)
+  {
+    // Leave a core for the emulated CPU
+    thread_count = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+  }
+  thread_count = std::clamp<int>(thread_count, 1, TILE_COUNT);
+
+  s_workers.clear();
+  for (int i = 0; i < thread_count; i++)
+    s_workers.push_back(std::make_unique<RasterWorker>());
+  s_thread_pool = std::make_unique<Common::ThreadPool>(thread_count, "Rasterizer");
+}
+
+void Shutdown()
+{
+  s_thread_pool.reset();
+  s_workers.clear();
+  s_triangles.clear();
+  for (std::vector<u32>& tile_triangles : s_tile_triangles)
+    tile_triangles.clear();
 }
 
 void ScissorChanged()
@@ -118,6 +218,32 @@ void ScissorChanged()
   scissors = std::move(BPFunctions::ComputeScissorRects().m_result);
 }
 
+void Flush()
+{
+  if (!s_triangles.empty())
+  {
+    s_next_tile.store(0, std::memory_order_relaxed);
+    s_thread_pool->RunOnAllThreads([](u32 thread) { RasterizeTiles(*s_workers[thread]); });
+
+    s_triangles.clear();
+    for (std::vector<u32>& tile_triangles : s_tile_triangles)
+      tile_triangles.clear();
+  }
+
+  for (auto& worker : s_workers)
+    worker->AddStatistics();
+}
+
+u32 GetThreadCount()
+{
+  return static_cast<u32>(s_workers.size());
+}
+
+void RunParallel(u32 job_count, const std::function<void(u32)>& job)
+{
+  s_thread_pool->ParallelFor(job_count, job);
+}
+
 // Returns approximation of log2(f) in s28.4
 // results are close enough to use for LOD
 static s32 FixedLog2(float f)
@@ -142,14 +268,28 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  for (auto& worker : s_workers)
+    worker->SetTevKonstColors();
+}
+
+void RasterWorker::AddStatistics()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, m_rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, m_tev.PixelsIn);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, m_tev.PixelsOut);
+
+  m_rasterized_pixels = 0;
+  m_tev.PixelsIn = 0;
+  m_tev.PixelsOut = 0;
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+// Sets up the TEV inputs of one pixel of the current block. Returns false if the pixel fails the
+// early depth test.
+bool RasterWorker::PreparePixel(const TriangleSetup& tri, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  m_rasterized_pixels++;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(tri.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
@@ -159,28 +299,29 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
-        return;
+        return false;
     }
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  RasterBlockPixel& pixel = m_raster_block.Pixel[xi][yi];
+  const int index = xi + yi * BLOCK_SIZE;
 
-  tev.Position[0] = x;
-  tev.Position[1] = y;
-  tev.Position[2] = z;
+  m_tev.Position[index][0] = x;
+  m_tev.Position[index][1] = y;
+  m_tev.Position[index][2] = z;
 
   //  colors
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)tri.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
 
-      tev.Color[i][comp] = color & mask;
+      m_tev.Color[index][i][comp] = color & mask;
     }
   }
 
@@ -188,26 +329,14 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     // multiply by 128 because TEV stores UVs as s17.7
-    tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-    tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
-  {
-    tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
-    tev.IndirectLinear[i] = rasterBlock.IndirectLinear[i];
-  }
-
-  for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
-  {
-    tev.TextureLod[i] = rasterBlock.TextureLod[i];
-    tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
+    m_tev.Uv[index][i].s = (s32)(pixel.Uv[i][0] * 128);
+    m_tev.Uv[index][i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
-  tev.Draw();
+  return true;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+void RasterWorker::CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,10 +347,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
-
+  float* uv00 = m_raster_block.Pixel[0][0].Uv[texcoord];
+  float* uv10 = m_raster_block.Pixel[1][0].Uv[texcoord];
+  float* uv01 = m_raster_block.Pixel[0][1].Uv[texcoord];
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
   float dudy = fabsf(uv00[0] - uv01[0]);
@@ -258,30 +386,30 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+void RasterWorker::BuildBlock(const TriangleSetup& tri, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
     {
-      RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+      RasterBlockPixel& pixel = m_raster_block.Pixel[xi][yi];
 
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / tri.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = tri.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = tri.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = tri.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +419,10 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(&m_raster_block.IndirectLod[i], &m_raster_block.IndirectLinear[i], texmap,
+                 texcoord);
+    m_tev.IndirectLod[i] = m_raster_block.IndirectLod[i];
+    m_tev.IndirectLinear[i] = m_raster_block.IndirectLinear[i];
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +434,10 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(&m_raster_block.TextureLod[i], &m_raster_block.TextureLinear[i], texmap,
+                   texcoord);
+      m_tev.TextureLod[i] = m_raster_block.TextureLod[i];
+      m_tev.TextureLinear[i] = m_raster_block.TextureLinear[i];
     }
   }
 }
@@ -340,24 +474,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
   const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
 
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
-
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
-
-  // Fixed-pos32 deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
-
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
-
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
   s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
@@ -378,41 +494,106 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   if (minx >= maxx || miny >= maxy)
     return;
 
+  // With a single rasterizer thread, the triangle is drawn right away
+  const bool deferred = s_workers.size() > 1;
+  TriangleSetup& tri = deferred ? s_triangles.emplace_back() : s_setup;
+
+  tri.minx = minx;
+  tri.maxx = maxx;
+  tri.miny = miny;
+  tri.maxy = maxy;
+
   // Set up the remaining slopes
   const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
                          scissor.y_off);
 
+  tri.ZSlope = ZSlope;
+
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  tri.WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      tri.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     for (int comp = 0; comp < 3; comp++)
     {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
+      tri.TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                                     v2->texCoords[i][comp] * w[2], ctx);
     }
   }
 
+  // Deltas
+  tri.DX12 = X1 - X2;
+  tri.DX23 = X2 - X3;
+  tri.DX31 = X3 - X1;
+
+  tri.DY12 = Y1 - Y2;
+  tri.DY23 = Y2 - Y3;
+  tri.DY31 = Y3 - Y1;
+
   // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
+  tri.C1 = tri.DY12 * X1 - tri.DX12 * Y1;
+  tri.C2 = tri.DY23 * X2 - tri.DX23 * Y2;
+  tri.C3 = tri.DY31 * X3 - tri.DX31 * Y3;
 
   // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
+  if (tri.DY12 < 0 || (tri.DY12 == 0 && tri.DX12 > 0))
+    tri.C1++;
+  if (tri.DY23 < 0 || (tri.DY23 == 0 && tri.DX23 > 0))
+    tri.C2++;
+  if (tri.DY31 < 0 || (tri.DY31 == 0 && tri.DX31 > 0))
+    tri.C3++;
+
+  if (!deferred)
+  {
+    s_workers[0]->Rasterize(tri, minx, maxx, miny, maxy);
+    return;
+  }
+
+  const u32 index = static_cast<u32>(s_triangles.size() - 1);
+  for (u32 tile_y = miny / TILE_SIZE; tile_y <= static_cast<u32>(maxy - 1) / TILE_SIZE; tile_y++)
+  {
+    for (u32 tile_x = minx / TILE_SIZE; tile_x <= static_cast<u32>(maxx - 1) / TILE_SIZE; tile_x++)
+      s_tile_triangles[tile_y * TILES_X + tile_x].push_back(index);
+  }
+}
+
+// Draws the part of the triangle within the given rectangle, which must lie within the triangle's
+// bounding rectangle and start at a multiple of BLOCK_SIZE unless it starts at the triangle's edge.
+void RasterWorker::Rasterize(const TriangleSetup& tri, s32 minx, s32 maxx, s32 miny, s32 maxy)
+{
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  const s32 C1 = tri.C1;
+  const s32 C2 = tri.C2;
+  const s32 C3 = tri.C3;
+
+  const s32 DX12 = tri.DX12;
+  const s32 DX23 = tri.DX23;
+  const s32 DX31 = tri.DX31;
+
+  const s32 DY12 = tri.DY12;
+  const s32 DY23 = tri.DY23;
+  const s32 DY31 = tri.DY31;
+
+  // Fixed-pos32 deltas
+  const s32 FDX12 = DX12 * 16;
+  const s32 FDX23 = DX23 * 16;
+  const s32 FDX31 = DX31 * 16;
+
+  const s32 FDY12 = DY12 * 16;
+  const s32 FDY23 = DY23 * 16;
+  const s32 FDY31 = DY31 * 16;
 
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
@@ -455,7 +636,10 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(tri, x, y);
+
+      // The pixels of the block that are drawn, as a quad mask for the Tev
+      u32 mask = 0;
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +649,8 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            if (PreparePixel(tri, x + ix, y + iy, ix, iy))
+              mask |= 1u << (ix + iy * BLOCK_SIZE);
           }
         }
       }
@@ -487,8 +672,11 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
             {
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
-              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy &&
+                  PreparePixel(tri, x + ix, y + iy, ix, iy))
+              {
+                mask |= 1u << (ix + iy * BLOCK_SIZE);
+              }
             }
 
             CX1 -= FDY12;
@@ -501,6 +689,9 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
           CY3 += FDX31;
         }
       }
+
+      if (mask != 0)
+        m_tev.DrawQuad(mask);
     }
   }
 }
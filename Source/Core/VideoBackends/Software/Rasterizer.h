@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "Common/CommonTypes.h"
 
 struct OutputVertexData;
@@ -10,8 +12,19 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
+// Finishes drawing the triangles of the current batch. Must be called before the EFB is accessed
+// in any other way, or any state that affects drawing changes.
+void Flush();
+
+// Returns the number of threads used for drawing, which is set by SWRasterizerThreads.
+u32 GetThreadCount();
+// Runs job(0) to job(job_count - 1) on the rasterizer threads and waits for them to finish. Must
+// not be called while triangles are waiting to be drawn, i.e. only right after Flush.
+void RunParallel(u32 job_count, const std::function<void(u32)>& job);
+
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
                   const OutputVertexData* v2, s32 x_off, s32 y_off);
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -3,8 +3,10 @@
 
 #include "VideoBackends/Software/SWVertexLoader.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -31,6 +33,9 @@
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+// Batches are only split across threads if each thread gets at least this many vertices.
+constexpr u32 MIN_VERTICES_PER_THREAD = 4096;
+
 SWVertexLoader::SWVertexLoader() = default;
 
 SWVertexLoader::~SWVertexLoader() = default;
@@ -42,6 +47,13 @@ DataReader SWVertexLoader::PrepareForAdditionalData(OpcodeDecoder::Primitive pri
   return VertexManagerBase::PrepareForAdditionalData(primitive, count, stride, false);
 }
 
+void SWVertexLoader::AddVisibleTriangles(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                         u32 num_triangles)
+{
+  // Culled triangles still update the zfreeze slope in the clipper, so keep all of them
+  AddIndices(primitive, num_vertices);
+}
+
 void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex)
 {
   using OpcodeDecoder::Primitive;
@@ -69,44 +81,83 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
   m_setup_unit.Init(primitive_type);
   Rasterizer::SetTevKonstColors();
 
-  for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
-  {
-    const u16 index = m_cpu_index_buffer[i];
-    memset(static_cast<void*>(&m_vertex), 0, sizeof(m_vertex));
-
-    // parse the videocommon format to our own struct format (m_vertex)
-    SetFormat();
-    ParseVertex(VertexLoaderManager::GetCurrentVertexFormat()->GetVertexDeclaration(), index);
-
-    // transform this vertex so that it can be used for rasterization (outVertex)
-    OutputVertexData* outVertex = m_setup_unit.GetVertex();
-    TransformUnit::TransformPosition(&m_vertex, outVertex);
-    outVertex->normal = {};
-    if (VertexLoaderManager::g_current_components & VB_HAS_NORMAL)
-      TransformUnit::TransformNormal(&m_vertex, outVertex);
-    TransformUnit::TransformColor(&m_vertex, outVertex);
-    TransformUnit::TransformTexCoord(&m_vertex, outVertex);
+  const u32 index_count = m_index_generator.GetIndexLen();
+  const u16* indices = m_cpu_index_buffer.data();
+  if (index_count != 0)
+    TransformVertices(*std::max_element(indices, indices + index_count) + 1);
 
+  for (u32 i = 0; i < index_count; i++)
+  {
     // assemble and rasterize the primitive
+    *m_setup_unit.GetVertex() = m_transformed_vertices[indices[i]];
     m_setup_unit.SetupVertex();
 
     INCSTAT(g_stats.this_frame.num_vertices_loaded);
   }
 
+  Rasterizer::Flush();
+
   INCSTAT(g_stats.this_frame.num_drawn_objects);
 }
 
-void SWVertexLoader::SetFormat()
+void SWVertexLoader::SetFormat(InputVertexData* vertex)
+{
+  vertex->posMtx = xfmem.MatrixIndexA.PosNormalMtxIdx;
+  vertex->texMtx[0] = xfmem.MatrixIndexA.Tex0MtxIdx;
+  vertex->texMtx[1] = xfmem.MatrixIndexA.Tex1MtxIdx;
+  vertex->texMtx[2] = xfmem.MatrixIndexA.Tex2MtxIdx;
+  vertex->texMtx[3] = xfmem.MatrixIndexA.Tex3MtxIdx;
+  vertex->texMtx[4] = xfmem.MatrixIndexB.Tex4MtxIdx;
+  vertex->texMtx[5] = xfmem.MatrixIndexB.Tex5MtxIdx;
+  vertex->texMtx[6] = xfmem.MatrixIndexB.Tex6MtxIdx;
+  vertex->texMtx[7] = xfmem.MatrixIndexB.Tex7MtxIdx;
+}
+
+// Transforming a vertex only depends on the vertex itself and on state that doesn't change during
+// a batch, so large batches are split across the rasterizer threads.
+void SWVertexLoader::TransformVertices(u32 vertex_count)
 {
-  m_vertex.posMtx = xfmem.MatrixIndexA.PosNormalMtxIdx;
-  m_vertex.texMtx[0] = xfmem.MatrixIndexA.Tex0MtxIdx;
-  m_vertex.texMtx[1] = xfmem.MatrixIndexA.Tex1MtxIdx;
-  m_vertex.texMtx[2] = xfmem.MatrixIndexA.Tex2MtxIdx;
-  m_vertex.texMtx[3] = xfmem.MatrixIndexA.Tex3MtxIdx;
-  m_vertex.texMtx[4] = xfmem.MatrixIndexB.Tex4MtxIdx;
-  m_vertex.texMtx[5] = xfmem.MatrixIndexB.Tex5MtxIdx;
-  m_vertex.texMtx[6] = xfmem.MatrixIndexB.Tex6MtxIdx;
-  m_vertex.texMtx[7] = xfmem.MatrixIndexB.Tex7MtxIdx;
+  const PortableVertexDeclaration& vdec =
+      VertexLoaderManager::GetCurrentVertexFormat()->GetVertexDeclaration();
+
+  m_transformed_vertices.resize(vertex_count);
+
+  const u32 max_jobs = std::max<u32>(vertex_count / MIN_VERTICES_PER_THREAD, 1);
+  const u32 job_count = std::min(Rasterizer::GetThreadCount(), max_jobs);
+  if (job_count <= 1)
+  {
+    TransformVertexRange(vdec, 0, vertex_count);
+    return;
+  }
+
+  const u32 vertices_per_job = (vertex_count + job_count - 1) / job_count;
+  Rasterizer::RunParallel(job_count, [&](u32 job) {
+    const u32 first = job * vertices_per_job;
+    TransformVertexRange(vdec, first, std::min(first + vertices_per_job, vertex_count));
+  });
+}
+
+void SWVertexLoader::TransformVertexRange(const PortableVertexDeclaration& vdec, u32 first,
+                                          u32 last)
+{
+  InputVertexData vertex;
+  for (u32 i = first; i < last; i++)
+  {
+    memset(static_cast<void*>(&vertex), 0, sizeof(vertex));
+
+    // parse the videocommon format to our own struct format (vertex)
+    SetFormat(&vertex);
+    ParseVertex(&vertex, vdec, i);
+
+    // transform this vertex so that it can be used for rasterization (outVertex)
+    OutputVertexData* outVertex = &m_transformed_vertices[i];
+    *outVertex = {};
+    TransformUnit::TransformPosition(&vertex, outVertex);
+    if (VertexLoaderManager::g_current_components & VB_HAS_NORMAL)
+      TransformUnit::TransformNormal(&vertex, outVertex);
+    TransformUnit::TransformColor(&vertex, outVertex);
+    TransformUnit::TransformTexCoord(&vertex, outVertex);
+  }
 }
 
 template <typename T, typename I>
@@ -194,47 +245,48 @@ static void ParseColorAttributes(InputVertexData* dst, DataReader& src,
   }
 }
 
-void SWVertexLoader::ParseVertex(const PortableVertexDeclaration& vdec, int index)
+void SWVertexLoader::ParseVertex(InputVertexData* vertex, const PortableVertexDeclaration& vdec,
+                                 int index)
 {
   DataReader src(m_cpu_vertex_buffer.data(),
                  m_cpu_vertex_buffer.data() + m_cpu_vertex_buffer.size());
   src.Skip(index * vdec.stride);
 
-  ReadVertexAttribute<float>(&m_vertex.position[0], src, vdec.position, 0, 3, false);
+  ReadVertexAttribute<float>(&vertex->position[0], src, vdec.position, 0, 3, false);
 
-  for (std::size_t i = 0; i < m_vertex.normal.size(); i++)
+  for (std::size_t i = 0; i < vertex->normal.size(); i++)
   {
-    ReadVertexAttribute<float>(&m_vertex.normal[i][0], src, vdec.normals[i], 0, 3, false);
+    ReadVertexAttribute<float>(&vertex->normal[i][0], src, vdec.normals[i], 0, 3, false);
   }
   if (!vdec.normals[1].enable)
   {
     auto& system = Core::System::GetInstance();
     auto& vertex_shader_manager = system.GetVertexShaderManager();
-    m_vertex.normal[1][0] = vertex_shader_manager.constants.cached_tangent[0];
-    m_vertex.normal[1][1] = vertex_shader_manager.constants.cached_tangent[1];
-    m_vertex.normal[1][2] = vertex_shader_manager.constants.cached_tangent[2];
+    vertex->normal[1][0] = vertex_shader_manager.constants.cached_tangent[0];
+    vertex->normal[1][1] = vertex_shader_manager.constants.cached_tangent[1];
+    vertex->normal[1][2] = vertex_shader_manager.constants.cached_tangent[2];
   }
   if (!vdec.normals[2].enable)
   {
     auto& system = Core::System::GetInstance();
     auto& vertex_shader_manager = system.GetVertexShaderManager();
-    m_vertex.normal[2][0] = vertex_shader_manager.constants.cached_binormal[0];
-    m_vertex.normal[2][1] = vertex_shader_manager.constants.cached_binormal[1];
-    m_vertex.normal[2][2] = vertex_shader_manager.constants.cached_binormal[2];
+    vertex->normal[2][0] = vertex_shader_manager.constants.cached_binormal[0];
+    vertex->normal[2][1] = vertex_shader_manager.constants.cached_binormal[1];
+    vertex->normal[2][2] = vertex_shader_manager.constants.cached_binormal[2];
   }
 
-  ParseColorAttributes(&m_vertex, src, vdec);
+  ParseColorAttributes(vertex, src, vdec);
 
-  for (std::size_t i = 0; i < m_vertex.texCoords.size(); i++)
+  for (std::size_t i = 0; i < vertex->texCoords.size(); i++)
   {
-    ReadVertexAttribute<float>(m_vertex.texCoords[i].data(), src, vdec.texcoords[i], 0, 2, false);
+    ReadVertexAttribute<float>(vertex->texCoords[i].data(), src, vdec.texcoords[i], 0, 2, false);
 
     // the texmtr is stored as third component of the texCoord
     if (vdec.texcoords[i].components >= 3)
     {
-      ReadVertexAttribute<u8>(&m_vertex.texMtx[i], src, vdec.texcoords[i], 2, 1, false);
+      ReadVertexAttribute<u8>(&vertex->texMtx[i], src, vdec.texcoords[i], 2, 1, false);
     }
   }
 
-  ReadVertexAttribute<u8>(&m_vertex.posMtx, src, vdec.posmtx, 0, 1, false);
+  ReadVertexAttribute<u8>(&vertex->posMtx, src, vdec.posmtx, 0, 1, false);
 }
@@ -21,13 +21,18 @@ public:
 
   DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count, u32 stride,
                                       bool cullall) override;
+  void AddVisibleTriangles(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                           u32 num_triangles) override;
 
 protected:
   void DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex) override;
 
-  void SetFormat();
-  void ParseVertex(const PortableVertexDeclaration& vdec, int index);
+  static void SetFormat(InputVertexData* vertex);
+  void ParseVertex(InputVertexData* vertex, const PortableVertexDeclaration& vdec, int index);
+  void TransformVertices(u32 vertex_count);
+  void TransformVertexRange(const PortableVertexDeclaration& vdec, u32 first, u32 last);
 
-  InputVertexData m_vertex{};
+  // Every vertex of the current batch, transformed once no matter how often it is referenced.
+  std::vector<OutputVertexData> m_transformed_vertices;
   SetupUnit m_setup_unit;
 };
@@ -4,9 +4,14 @@
 #include "VideoBackends/Software/Tev.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
@@ -18,7 +23,6 @@
 
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
-#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -44,34 +48,37 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
   switch (colorChan)
   {
   case RasColorChan::Color0:
-  {
-    const u8* color = Color[0];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
-  }
-  break;
   case RasColorChan::Color1:
   {
-    const u8* color = Color[1];
+    const int chan = colorChan == RasColorChan::Color0 ? 0 : 1;
     const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      const u8* color = Color[pixel][chan];
+      RasColor.c[RED_C][pixel] = color[u32(swap[ColorChannel::Red])];
+      RasColor.c[GRN_C][pixel] = color[u32(swap[ColorChannel::Green])];
+      RasColor.c[BLU_C][pixel] = color[u32(swap[ColorChannel::Blue])];
+      RasColor.c[ALP_C][pixel] = color[u32(swap[ColorChannel::Alpha])];
+    }
   }
   break;
   case RasColorChan::AlphaBump:
   {
-    RasColor = TevColor::All(AlphaBump);
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      for (int i = 0; i < 4; i++)
+        RasColor.c[i][pixel] = AlphaBump[pixel];
+    }
   }
   break;
   case RasColorChan::NormalizedAlphaBump:
   {
-    const u8 normalized = AlphaBump | AlphaBump >> 5;
-    RasColor = TevColor::All(normalized);
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      const u8 normalized = AlphaBump[pixel] | AlphaBump[pixel] >> 5;
+      for (int i = 0; i < 4; i++)
+        RasColor.c[i][pixel] = normalized;
+    }
   }
   break;
   default:
@@ -79,34 +86,21 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
     if (colorChan != RasColorChan::Zero)
       PanicAlertFmt("Invalid ras color channel: {}", colorChan);
 
-    RasColor = TevColor::All(0);
+    RasColor.SetAll(0, 0, 0, 0);
   }
   break;
   }
 }
 
-void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                           s16 result[4])
 {
   for (int i = BLU_C; i <= RED_C; i++)
-  {
-    const InputRegType& InputReg = inputs[i];
-
-    const u16 c = InputReg.c + (InputReg.c >> 7);
-
-    s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
-    temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
-
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
-
-    Reg[cc.dest][i] = result;
-  }
+    result[i] = TevCombiner::ColorRegular(cc, inputs[i]);
 }
 
-void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                           s16 result[4])
 {
   for (int i = BLU_C; i <= RED_C; i++)
   {
@@ -139,30 +133,20 @@ void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const Inpu
     }
 
     if (cc.comparison == TevComparison::GT)
-      Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
+      result[i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
     else
-      Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
+      result[i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
   }
 }
 
-void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                           s16 result[4])
 {
-  const InputRegType& InputReg = inputs[ALP_C];
-
-  const u16 c = InputReg.c + (InputReg.c >> 7);
-
-  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-  temp <<= s_ScaleLShiftLUT[ac.scale];
-  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
-  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
-
-  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
-  result = result >> s_ScaleRShiftLUT[ac.scale];
-
-  Reg[ac.dest].a = result;
+  result[ALP_C] = TevCombiner::AlphaRegular(ac, inputs[ALP_C]);
 }
 
-void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                           s16 result[4])
 {
   u32 a, b;
   switch (ac.compare_mode)
@@ -193,55 +177,49 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
   }
 
   if (ac.comparison == TevComparison::GT)
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
+    result[ALP_C] = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
   else
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
+    result[ALP_C] = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
-static bool AlphaCompare(int alpha, int ref, CompareMode comp)
+// Evaluates the combiners of a stage for each pixel on its own, which is needed when one of them
+// is in compare mode.
+void Tev::CombineSeparately(const TevStageCombiner::ColorCombiner& cc,
+                            const TevStageCombiner::AlphaCombiner& ac,
+                            const TevCombiner::QuadInputs& inputs, u32 mask)
 {
-  switch (comp)
+  for (int pixel = 0; pixel < 4; pixel++)
   {
-  case CompareMode::Always:
-    return true;
-  case CompareMode::Never:
-    return false;
-  case CompareMode::LEqual:
-    return alpha <= ref;
-  case CompareMode::Less:
-    return alpha < ref;
-  case CompareMode::GEqual:
-    return alpha >= ref;
-  case CompareMode::Greater:
-    return alpha > ref;
-  case CompareMode::Equal:
-    return alpha == ref;
-  case CompareMode::NEqual:
-    return alpha != ref;
-  default:
-    PanicAlertFmt("Invalid compare mode {}", comp);
-    return true;
-  }
-}
+    if (!(mask & (1u << pixel)))
+      continue;
 
-static bool TevAlphaTest(int alpha)
-{
-  const bool comp0 = AlphaCompare(alpha, bpmem.alpha_test.ref0, bpmem.alpha_test.comp0);
-  const bool comp1 = AlphaCompare(alpha, bpmem.alpha_test.ref1, bpmem.alpha_test.comp1);
+    InputRegType pixel_inputs[4];
+    s16 result[4];
+    for (int i = 0; i < 4; i++)
+    {
+      pixel_inputs[i].a = inputs.a[i][pixel];
+      pixel_inputs[i].b = inputs.b[i][pixel];
+      pixel_inputs[i].c = inputs.c[i][pixel];
+      pixel_inputs[i].d = inputs.d[i][pixel];
+      // Invalid compare modes leave the destination unchanged
+      result[i] = (i == ALP_C ? Reg[ac.dest] : Reg[cc.dest]).c[i][pixel];
+    }
 
-  switch (bpmem.alpha_test.logic)
-  {
-  case AlphaTestOp::And:
-    return comp0 && comp1;
-  case AlphaTestOp::Or:
-    return comp0 || comp1;
-  case AlphaTestOp::Xor:
-    return comp0 ^ comp1;
-  case AlphaTestOp::Xnor:
-    return !(comp0 ^ comp1);
-  default:
-    PanicAlertFmt("Invalid AlphaTestOp {}", bpmem.alpha_test.logic);
-    return true;
+    if (cc.bias != TevBias::Compare)
+      DrawColorRegular(cc, pixel_inputs, result);
+    else
+      DrawColorCompare(cc, pixel_inputs, result);
+
+    for (int i = BLU_C; i <= RED_C; i++)
+      Reg[cc.dest].c[i][pixel] = cc.clamp ? Clamp255(result[i]) : Clamp1024(result[i]);
+
+    if (ac.bias != TevBias::Compare)
+      DrawAlphaRegular(ac, pixel_inputs, result);
+    else
+      DrawAlphaCompare(ac, pixel_inputs, result);
+
+    Reg[ac.dest].c[ALP_C][pixel] =
+        ac.clamp ? Clamp255(result[ALP_C]) : Clamp1024(result[ALP_C]);
   }
 }
 
@@ -269,10 +247,12 @@ static inline s32 WrapIndirectCoord(s32 coord, IndTexWrap wrapMode)
   }
 }
 
-void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
+void Tev::Indirect(unsigned int stageNum, int pixel, s32 s, s32 t)
 {
   const TevStageIndirect& indirect = bpmem.tevind[stageNum];
-  const u8* indmap = IndirectTex[indirect.bt];
+  const u8* indmap = IndirectTex[indirect.bt][pixel];
+  u8& alpha_bump = AlphaBump[pixel];
+  TextureCoordinateType& tex_coord = TexCoord[pixel];
 
   s32 indcoord[3];
 
@@ -280,16 +260,16 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
   switch (indirect.bs)
   {
   case IndTexBumpAlpha::Off:
-    AlphaBump = 0;
+    alpha_bump = 0;
     break;
   case IndTexBumpAlpha::S:
-    AlphaBump = indmap[TextureSampler::ALP_SMP];
+    alpha_bump = indmap[TextureSampler::ALP_SMP];
     break;
   case IndTexBumpAlpha::T:
-    AlphaBump = indmap[TextureSampler::BLU_SMP];
+    alpha_bump = indmap[TextureSampler::BLU_SMP];
     break;
   case IndTexBumpAlpha::U:
-    AlphaBump = indmap[TextureSampler::GRN_SMP];
+    alpha_bump = indmap[TextureSampler::GRN_SMP];
     break;
   default:
     PanicAlertFmt("Invalid alpha bump {}", indirect.bs);
@@ -310,25 +290,25 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
     indcoord[0] = indmap[TextureSampler::ALP_SMP] + bias[0];
     indcoord[1] = indmap[TextureSampler::BLU_SMP] + bias[1];
     indcoord[2] = indmap[TextureSampler::GRN_SMP] + bias[2];
-    AlphaBump = AlphaBump & 0xf8;
+    alpha_bump = alpha_bump & 0xf8;
     break;
   case IndTexFormat::ITF_5:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 3) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 3) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 3) + bias[2];
-    AlphaBump = AlphaBump << 5;
+    alpha_bump = alpha_bump << 5;
     break;
   case IndTexFormat::ITF_4:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 4) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 4) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 4) + bias[2];
-    AlphaBump = AlphaBump << 4;
+    alpha_bump = alpha_bump << 4;
     break;
   case IndTexFormat::ITF_3:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 5) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 5) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 5) + bias[2];
-    AlphaBump = AlphaBump << 3;
+    alpha_bump = alpha_bump << 3;
     break;
   default:
     PanicAlertFmt("Invalid indirect format {}", indirect.fmt);
@@ -382,22 +362,171 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
 
   if (indirect.fb_addprev)
   {
-    TexCoord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    tex_coord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    tex_coord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
   }
   else
   {
-    TexCoord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    tex_coord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    tex_coord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+  }
+}
+
+void Tev::ApplyFog(u8 output[4][4], u32 mask) const
+{
+  float ze[4];
+
+#if defined(_M_X86_64)
+  const __m128i z =
+      _mm_setr_epi32(Position[0][2], Position[1][2], Position[2][2], Position[3][2]);
+  if (bpmem.fog.c_proj_fsel.proj == FogProjection::Perspective)
+  {
+    // Like a scalar shift on x86, only use the low 5 bits of the shift amount
+    const __m128i denom =
+        _mm_sub_epi32(_mm_set1_epi32(bpmem.fog.b_magnitude),
+                      _mm_sra_epi32(z, _mm_cvtsi32_si128(bpmem.fog.b_shift & 0x1f)));
+    _mm_storeu_ps(ze, _mm_div_ps(_mm_set1_ps(bpmem.fog.GetA() * 16777215.0f),
+                                 _mm_cvtepi32_ps(denom)));
+  }
+  else
+  {
+    _mm_storeu_ps(ze, _mm_mul_ps(_mm_set1_ps(bpmem.fog.GetA()),
+                                 _mm_div_ps(_mm_cvtepi32_ps(z), _mm_set1_ps(16777215.0f))));
+  }
+#else
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    if (bpmem.fog.c_proj_fsel.proj == FogProjection::Perspective)
+    {
+      // perspective
+      // ze = A/(B - (Zs >> B_SHF))
+      const s32 denom = bpmem.fog.b_magnitude - (Position[pixel][2] >> bpmem.fog.b_shift);
+      // in addition downscale magnitude and zs to 0.24 bits
+      ze[pixel] = (bpmem.fog.GetA() * 16777215.0f) / static_cast<float>(denom);
+    }
+    else
+    {
+      // orthographic
+      // ze = a*Zs
+      // in addition downscale zs to 0.24 bits
+      ze[pixel] = bpmem.fog.GetA() * (static_cast<float>(Position[pixel][2]) / 16777215.0f);
+    }
+  }
+#endif
+
+  if (bpmem.fogRange.Base.Enabled)
+  {
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      // TODO: This is untested and should definitely be checked against real hw.
+      // - No idea if offset is really normalized against the viewport width or against the
+      // projection matrix or yet something else
+      // - scaling of the "k" coefficient isn't clear either.
+
+      // First, calculate the offset from the viewport center (normalized to 0..1)
+      const float offset =
+          (Position[pixel][0] - (static_cast<s32>(bpmem.fogRange.Base.Center.Value()) - 342)) /
+          static_cast<float>(xfmem.viewport.wd);
+
+      // Based on that, choose the index such that points which are far away from the z-axis use
+      // the 10th "k" value and such that central points use the first value.
+      float floatindex = 9.f - std::abs(offset) * 9.f;
+      floatindex = std::clamp(floatindex, 0.f, 9.f);  // TODO: This shouldn't be necessary!
+
+      // Get the two closest integer indices, look up the corresponding samples
+      const int indexlower = (int)floatindex;
+      const int indexupper = indexlower + 1;
+      // Look up coefficient... Seems like multiplying by 4 makes Fortune Street work properly
+      // (fog is too strong without the factor)
+      const float klower = bpmem.fogRange.K[indexlower / 2].GetValue(indexlower % 2) * 4.f;
+      const float kupper = bpmem.fogRange.K[indexupper / 2].GetValue(indexupper % 2) * 4.f;
+
+      // linearly interpolate the samples and multiple ze by the resulting adjustment factor
+      const float factor = indexupper - floatindex;
+      const float k = klower * factor + kupper * (1.f - factor);
+      const float x_adjust = sqrt(offset * offset + k * k) / k;
+      ze[pixel] *= x_adjust;  // NOTE: This is basically dividing by a cosine (hidden behind
+                              // GXInitFogAdjTable): 1/cos = c/b = sqrt(a^2+b^2)/b
+    }
+  }
+
+  // lerp from output to fog color, by fog / 256 for each color channel and 0 for alpha
+  u16 fog_weights[4][4] = {};
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    if (!(mask & (1u << pixel)))
+      continue;
+
+    // clamp 0 to 1
+    float fog = std::clamp(ze[pixel] - bpmem.fog.GetC(), 0.f, 1.f);
+
+    switch (bpmem.fog.c_proj_fsel.fsel)
+    {
+    case FogType::Exp:
+      fog = 1.0f - pow(2.0f, -8.0f * fog);
+      break;
+    case FogType::ExpSq:
+      fog = 1.0f - pow(2.0f, -8.0f * fog * fog);
+      break;
+    case FogType::BackwardsExp:
+      fog = 1.0f - fog;
+      fog = pow(2.0f, -8.0f * fog);
+      break;
+    case FogType::BackwardsExpSq:
+      fog = 1.0f - fog;
+      fog = pow(2.0f, -8.0f * fog * fog);
+      break;
+    default:
+      break;
+    }
+
+    const u16 fogInt = (u16)(fog * 256);
+    fog_weights[pixel][BLU_C] = fogInt;
+    fog_weights[pixel][GRN_C] = fogInt;
+    fog_weights[pixel][RED_C] = fogInt;
+  }
+
+#if defined(_M_X86_64)
+  // Two pixels per register, as 16-bit lanes. The results fit into 16 bits before the shift.
+  const __m128i fog_color = _mm_setr_epi16(0, bpmem.fog.color.b, bpmem.fog.color.g,
+                                           bpmem.fog.color.r, 0, bpmem.fog.color.b,
+                                           bpmem.fog.color.g, bpmem.fog.color.r);
+  const __m128i colors = _mm_loadu_si128(reinterpret_cast<const __m128i*>(output));
+  const auto lerp = [&](__m128i color, const u16* weights) {
+    const __m128i fog = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights));
+    const __m128i inv_fog = _mm_sub_epi16(_mm_set1_epi16(256), fog);
+    return _mm_srli_epi16(
+        _mm_add_epi16(_mm_mullo_epi16(color, inv_fog), _mm_mullo_epi16(fog, fog_color)), 8);
+  };
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i result = _mm_packus_epi16(lerp(_mm_unpacklo_epi8(colors, zero), fog_weights[0]),
+                                          lerp(_mm_unpackhi_epi8(colors, zero), fog_weights[2]));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), result);
+#else
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    const u32 fogInt = fog_weights[pixel][RED_C];
+    const u32 invFog = 256 - fogInt;
+
+    output[pixel][RED_C] = (output[pixel][RED_C] * invFog + fogInt * bpmem.fog.color.r) >> 8;
+    output[pixel][GRN_C] = (output[pixel][GRN_C] * invFog + fogInt * bpmem.fog.color.g) >> 8;
+    output[pixel][BLU_C] = (output[pixel][BLU_C] * invFog + fogInt * bpmem.fog.color.b) >> 8;
   }
+#endif
 }
 
-void Tev::Draw()
+void Tev::DrawQuad(u32 mask)
 {
-  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
-  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    if (!(mask & (1u << pixel)))
+      continue;
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+    ASSERT(Position[pixel][0] >= 0 && Position[pixel][0] < s32(EFB_WIDTH));
+    ASSERT(Position[pixel][1] >= 0 && Position[pixel][1] < s32(EFB_HEIGHT));
+  }
+
+  PixelsIn += std::popcount(mask);
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -405,10 +534,8 @@ void Tev::Draw()
   // initial color values
   for (int i = 0; i < 4; i++)
   {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
+    const auto& color = pixel_shader_manager.constants.colors[i];
+    Reg[static_cast<TevOutput>(i)].SetAll(color[3], color[2], color[1], color[0]);
   }
 
   for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
@@ -430,9 +557,15 @@ void Tev::Draw()
     const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
     const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
 
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
-                           IndirectTex[stageNum]);
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      if (!(mask & (1u << pixel)))
+        continue;
+
+      TextureSampler::Sample(Uv[pixel][texcoordSel].s >> scaleS,
+                             Uv[pixel][texcoordSel].t >> scaleT, IndirectLod[stageNum],
+                             IndirectLinear[stageNum], texmap, IndirectTex[stageNum][pixel]);
+    }
   }
 
   for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
@@ -453,90 +586,88 @@ void Tev::Draw()
     if (texcoordSel >= bpmem.genMode.numtexgens)
       texcoordSel = 0;
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    for (int pixel = 0; pixel < 4; pixel++)
+    {
+      if (mask & (1u << pixel))
+        Indirect(stageNum, pixel, Uv[pixel][texcoordSel].s, Uv[pixel][texcoordSel].t);
+    }
 
     // sample texture
     if (order.getEnable(stageOdd))
     {
-      // RGBA
-      u8 texel[4];
-
-      if (bpmem.genMode.numtexgens > 0)
-      {
-        TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
-      }
-      else
+      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
+      for (int pixel = 0; pixel < 4; pixel++)
       {
-        // It seems like the result is always black when no tex coords are enabled, but further
-        // hardware testing is needed.
-        std::memset(texel, 0, 4);
+        if (!(mask & (1u << pixel)))
+          continue;
+
+        // RGBA
+        u8 texel[4];
+
+        if (bpmem.genMode.numtexgens > 0)
+        {
+          TextureSampler::Sample(TexCoord[pixel].s, TexCoord[pixel].t, TextureLod[stageNum],
+                                 TextureLinear[stageNum], texmap, texel);
+        }
+        else
+        {
+          // It seems like the result is always black when no tex coords are enabled, but further
+          // hardware testing is needed.
+          std::memset(texel, 0, 4);
+        }
+
+        TexColor.c[RED_C][pixel] = texel[u32(swap[ColorChannel::Red])];
+        TexColor.c[GRN_C][pixel] = texel[u32(swap[ColorChannel::Green])];
+        TexColor.c[BLU_C][pixel] = texel[u32(swap[ColorChannel::Blue])];
+        TexColor.c[ALP_C][pixel] = texel[u32(swap[ColorChannel::Alpha])];
       }
-
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
     }
 
+    const auto copy = [](s16 dest[4], const s16* src) { std::memcpy(dest, src, sizeof(s16) * 4); };
+
     // set konst for this stage
     const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
     const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
+    copy(StageKonst.c[RED_C], m_KonstLUT[kc].r);
+    copy(StageKonst.c[GRN_C], m_KonstLUT[kc].g);
+    copy(StageKonst.c[BLU_C], m_KonstLUT[kc].b);
+    copy(StageKonst.c[ALP_C], m_KonstLUT[ka].a);
 
     // set color
     SetRasColor(order.getColorChan(stageOdd), ac.rswap);
 
     // combine inputs
-    InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
+    TevCombiner::QuadInputs inputs;
+    copy(inputs.a[BLU_C], m_ColorInputLUT[cc.a].b);
+    copy(inputs.b[BLU_C], m_ColorInputLUT[cc.b].b);
+    copy(inputs.c[BLU_C], m_ColorInputLUT[cc.c].b);
+    copy(inputs.d[BLU_C], m_ColorInputLUT[cc.d].b);
+    copy(inputs.a[GRN_C], m_ColorInputLUT[cc.a].g);
+    copy(inputs.b[GRN_C], m_ColorInputLUT[cc.b].g);
+    copy(inputs.c[GRN_C], m_ColorInputLUT[cc.c].g);
+    copy(inputs.d[GRN_C], m_ColorInputLUT[cc.d].g);
+    copy(inputs.a[RED_C], m_ColorInputLUT[cc.a].r);
+    copy(inputs.b[RED_C], m_ColorInputLUT[cc.b].r);
+    copy(inputs.c[RED_C], m_ColorInputLUT[cc.c].r);
+    copy(inputs.d[RED_C], m_ColorInputLUT[cc.d].r);
+    copy(inputs.a[ALP_C], m_AlphaInputLUT[ac.a]);
+    copy(inputs.b[ALP_C], m_AlphaInputLUT[ac.b]);
+    copy(inputs.c[ALP_C], m_AlphaInputLUT[ac.c]);
+    copy(inputs.d[ALP_C], m_AlphaInputLUT[ac.d]);
+
+    if (cc.bias != TevBias::Compare && ac.bias != TevBias::Compare)
     {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
-    }
-    else
-    {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+      // Fast path, which evaluates and clamps all channels of all pixels at once
+      s16 result[4][4];
+      TevCombiner::CombineQuad(cc, ac, inputs, result);
+      copy(Reg[cc.dest].c[RED_C], result[RED_C]);
+      copy(Reg[cc.dest].c[GRN_C], result[GRN_C]);
+      copy(Reg[cc.dest].c[BLU_C], result[BLU_C]);
+      copy(Reg[ac.dest].c[ALP_C], result[ALP_C]);
+      continue;
     }
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
-
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
-    else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+    CombineSeparately(cc, ac, inputs, mask);
   }
 
   // convert to 8 bits per component
@@ -544,145 +675,84 @@ void Tev::Draw()
   // regardless of the used destination register - TODO: Verify!
   const auto& color_index = bpmem.combiners[bpmem.genMode.numtevstages].colorC.dest;
   const auto& alpha_index = bpmem.combiners[bpmem.genMode.numtevstages].alphaC.dest;
-  u8 output[4] = {(u8)Reg[alpha_index].a, (u8)Reg[color_index].b, (u8)Reg[color_index].g,
-                  (u8)Reg[color_index].r};
+  u8 output[4][4];
+  u8 alpha[4];
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    output[pixel][ALP_C] = (u8)Reg[alpha_index].c[ALP_C][pixel];
+    output[pixel][BLU_C] = (u8)Reg[color_index].c[BLU_C][pixel];
+    output[pixel][GRN_C] = (u8)Reg[color_index].c[GRN_C][pixel];
+    output[pixel][RED_C] = (u8)Reg[color_index].c[RED_C][pixel];
+    alpha[pixel] = output[pixel][ALP_C];
+  }
 
-  if (!TevAlphaTest(output[ALP_C]))
+  mask &= TevCombiner::AlphaTestQuad(bpmem.alpha_test, alpha);
+  if (mask == 0)
     return;
 
   // z texture
   if (bpmem.ztex2.op != ZTexOp::Disabled)
   {
-    u32 ztex = bpmem.ztex1.bias;
-    switch (bpmem.ztex2.type)
+    for (int pixel = 0; pixel < 4; pixel++)
     {
-    case ZTexFormat::U8:
-      ztex += TexColor[ALP_C];
-      break;
-    case ZTexFormat::U16:
-      ztex += TexColor[ALP_C] << 8 | TexColor[RED_C];
-      break;
-    case ZTexFormat::U24:
-      ztex += TexColor[RED_C] << 16 | TexColor[GRN_C] << 8 | TexColor[BLU_C];
-      break;
-    default:
-      PanicAlertFmt("Invalid ztex format {}", bpmem.ztex2.type);
-    }
+      if (!(mask & (1u << pixel)))
+        continue;
 
-    if (bpmem.ztex2.op == ZTexOp::Add)
-      ztex += Position[2];
+      u32 ztex = bpmem.ztex1.bias;
+      switch (bpmem.ztex2.type)
+      {
+      case ZTexFormat::U8:
+        ztex += TexColor.c[ALP_C][pixel];
+        break;
+      case ZTexFormat::U16:
+        ztex += TexColor.c[ALP_C][pixel] << 8 | TexColor.c[RED_C][pixel];
+        break;
+      case ZTexFormat::U24:
+        ztex += TexColor.c[RED_C][pixel] << 16 | TexColor.c[GRN_C][pixel] << 8 |
+                TexColor.c[BLU_C][pixel];
+        break;
+      default:
+        PanicAlertFmt("Invalid ztex format {}", bpmem.ztex2.type);
+      }
 
-    Position[2] = ztex & 0x00ffffff;
+      if (bpmem.ztex2.op == ZTexOp::Add)
+        ztex += Position[pixel][2];
+
+      Position[pixel][2] = ztex & 0x00ffffff;
+    }
   }
 
   // fog
   if (bpmem.fog.c_proj_fsel.fsel != FogType::Off)
-  {
-    float ze;
+    ApplyFog(output, mask);
 
-    if (bpmem.fog.c_proj_fsel.proj == FogProjection::Perspective)
-    {
-      // perspective
-      // ze = A/(B - (Zs >> B_SHF))
-      const s32 denom = bpmem.fog.b_magnitude - (Position[2] >> bpmem.fog.b_shift);
-      // in addition downscale magnitude and zs to 0.24 bits
-      ze = (bpmem.fog.GetA() * 16777215.0f) / static_cast<float>(denom);
-    }
-    else
-    {
-      // orthographic
-      // ze = a*Zs
-      // in addition downscale zs to 0.24 bits
-      ze = bpmem.fog.GetA() * (static_cast<float>(Position[2]) / 16777215.0f);
-    }
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    if (!(mask & (1u << pixel)))
+      continue;
 
-    if (bpmem.fogRange.Base.Enabled)
+    const s32* position = Position[pixel];
+    if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
     {
-      // TODO: This is untested and should definitely be checked against real hw.
-      // - No idea if offset is really normalized against the viewport width or against the
-      // projection matrix or yet something else
-      // - scaling of the "k" coefficient isn't clear either.
+      // TODO: Check against hw if these values get incremented even if depth testing is disabled
+      EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
 
-      // First, calculate the offset from the viewport center (normalized to 0..1)
-      const float offset =
-          (Position[0] - (static_cast<s32>(bpmem.fogRange.Base.Center.Value()) - 342)) /
-          static_cast<float>(xfmem.viewport.wd);
-
-      // Based on that, choose the index such that points which are far away from the z-axis use the
-      // 10th "k" value and such that central points use the first value.
-      float floatindex = 9.f - std::abs(offset) * 9.f;
-      floatindex = std::clamp(floatindex, 0.f, 9.f);  // TODO: This shouldn't be necessary!
+      if (!EfbInterface::ZCompare(position[0], position[1], position[2]))
+        continue;
 
-      // Get the two closest integer indices, look up the corresponding samples
-      const int indexlower = (int)floatindex;
-      const int indexupper = indexlower + 1;
-      // Look up coefficient... Seems like multiplying by 4 makes Fortune Street work properly (fog
-      // is too strong without the factor)
-      const float klower = bpmem.fogRange.K[indexlower / 2].GetValue(indexlower % 2) * 4.f;
-      const float kupper = bpmem.fogRange.K[indexupper / 2].GetValue(indexupper % 2) * 4.f;
-
-      // linearly interpolate the samples and multiple ze by the resulting adjustment factor
-      const float factor = indexupper - floatindex;
-      const float k = klower * factor + kupper * (1.f - factor);
-      const float x_adjust = sqrt(offset * offset + k * k) / k;
-      ze *= x_adjust;  // NOTE: This is basically dividing by a cosine (hidden behind
-                       // GXInitFogAdjTable): 1/cos = c/b = sqrt(a^2+b^2)/b
+      EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
     }
 
-    ze -= bpmem.fog.GetC();
+    // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to
+    // the extents of these groups, rather than the exact pixel.
+    BBoxManager::Update(static_cast<u16>(position[0] & ~1), static_cast<u16>(position[0] | 1),
+                        static_cast<u16>(position[1] & ~1), static_cast<u16>(position[1] | 1));
 
-    // clamp 0 to 1
-    float fog = std::clamp(ze, 0.f, 1.f);
+    PixelsOut++;
+    EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
 
-    switch (bpmem.fog.c_proj_fsel.fsel)
-    {
-    case FogType::Exp:
-      fog = 1.0f - pow(2.0f, -8.0f * fog);
-      break;
-    case FogType::ExpSq:
-      fog = 1.0f - pow(2.0f, -8.0f * fog * fog);
-      break;
-    case FogType::BackwardsExp:
-      fog = 1.0f - fog;
-      fog = pow(2.0f, -8.0f * fog);
-      break;
-    case FogType::BackwardsExpSq:
-      fog = 1.0f - fog;
-      fog = pow(2.0f, -8.0f * fog * fog);
-      break;
-    default:
-      break;
-    }
-
-    // lerp from output to fog color
-    const u32 fogInt = (u32)(fog * 256);
-    const u32 invFog = 256 - fogInt;
-
-    output[RED_C] = (output[RED_C] * invFog + fogInt * bpmem.fog.color.r) >> 8;
-    output[GRN_C] = (output[GRN_C] * invFog + fogInt * bpmem.fog.color.g) >> 8;
-    output[BLU_C] = (output[BLU_C] * invFog + fogInt * bpmem.fog.color.b) >> 8;
-  }
-
-  if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
-  {
-    // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
-
-    if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
-      return;
-
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    EfbInterface::BlendTev(position[0], position[1], output[pixel]);
   }
-
-  // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
-  // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
-
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
-
-  EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
 void Tev::SetKonstColors()
@@ -692,9 +762,7 @@ void Tev::SetKonstColors()
 
   for (int i = 0; i < 4; i++)
   {
-    KonstantColors[i].r = pixel_shader_manager.constants.kcolors[i][0];
-    KonstantColors[i].g = pixel_shader_manager.constants.kcolors[i][1];
-    KonstantColors[i].b = pixel_shader_manager.constants.kcolors[i][2];
-    KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
+    const auto& color = pixel_shader_manager.constants.kcolors[i];
+    KonstantColors[i].SetAll(color[3], color[2], color[1], color[0]);
   }
 }
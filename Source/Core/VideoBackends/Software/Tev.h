@@ -6,97 +6,72 @@
 #include <array>
 
 #include "Common/EnumMap.h"
+#include "VideoBackends/Software/TevCombiner.h"
 #include "VideoCommon/BPMemory.h"
 
 class Tev
 {
-  struct TevColor
+  // The values of the four pixels of a quad, for each channel of a TEV color. Stored as
+  // [channel][pixel], with the channels in the order alpha, blue, green, red.
+  struct QuadColor
   {
-    constexpr TevColor() = default;
-    constexpr explicit TevColor(s16 a_, s16 b_, s16 g_, s16 r_) : a(a_), b(b_), g(g_), r(r_) {}
+    alignas(16) s16 c[4][4]{};
 
-    s16 a = 0;
-    s16 b = 0;
-    s16 g = 0;
-    s16 r = 0;
-
-    constexpr static TevColor All(s16 value) { return TevColor(value, value, value, value); }
-
-    constexpr s16& operator[](int index)
+    void SetAll(s16 a, s16 b, s16 g, s16 r)
     {
-      switch (index)
+      for (int pixel = 0; pixel < 4; pixel++)
       {
-      case ALP_C:
-        return a;
-      case BLU_C:
-        return b;
-      case GRN_C:
-        return g;
-      case RED_C:
-        return r;
-      default:
-        // invalid
-        return a;
+        c[ALP_C][pixel] = a;
+        c[BLU_C][pixel] = b;
+        c[GRN_C][pixel] = g;
+        c[RED_C][pixel] = r;
       }
     }
   };
 
+  // Each of these points to the values of one channel for the four pixels of a quad
   struct TevColorRef
   {
-    constexpr explicit TevColorRef(const s16& r_, const s16& g_, const s16& b_)
+    constexpr explicit TevColorRef(const s16* r_, const s16* g_, const s16* b_)
         : r(r_), g(g_), b(b_)
     {
     }
 
-    const s16& r;
-    const s16& g;
-    const s16& b;
+    const s16* r;
+    const s16* g;
+    const s16* b;
 
-    constexpr static TevColorRef Color(const TevColor& color)
+    constexpr static TevColorRef Color(const QuadColor& color)
     {
-      return TevColorRef(color.r, color.g, color.b);
+      return TevColorRef(color.c[RED_C], color.c[GRN_C], color.c[BLU_C]);
     }
-    constexpr static TevColorRef All(const s16& value) { return TevColorRef(value, value, value); }
-    constexpr static TevColorRef Alpha(const TevColor& color) { return All(color.a); }
-  };
-
-  struct TevAlphaRef
-  {
-    constexpr explicit TevAlphaRef(const TevColor& color) : a(color.a) {}
-    constexpr explicit TevAlphaRef(const s16& a_) : a(a_) {}
-
-    const s16& a;
+    constexpr static TevColorRef All(const s16* value) { return TevColorRef(value, value, value); }
+    constexpr static TevColorRef Alpha(const QuadColor& color) { return All(color.c[ALP_C]); }
   };
 
   struct TevKonstRef
   {
-    constexpr explicit TevKonstRef(const s16& a_, const s16& r_, const s16& g_, const s16& b_)
+    constexpr explicit TevKonstRef(const s16* a_, const s16* r_, const s16* g_, const s16* b_)
         : a(a_), r(r_), g(g_), b(b_)
     {
     }
 
-    const s16& a;
-    const s16& r;
-    const s16& g;
-    const s16& b;
+    const s16* a;
+    const s16* r;
+    const s16* g;
+    const s16* b;
 
-    constexpr static TevKonstRef Value(const s16& value)
+    constexpr static TevKonstRef Value(const s16* value)
     {
       return TevKonstRef(value, value, value, value);
     }
-    constexpr static TevKonstRef Konst(const s16& alpha, const TevColor& color)
+    constexpr static TevKonstRef Konst(const s16* alpha, const QuadColor& color)
     {
-      return TevKonstRef(alpha, color.r, color.g, color.b);
+      return TevKonstRef(alpha, color.c[RED_C], color.c[GRN_C], color.c[BLU_C]);
     }
   };
 
-  struct InputRegType
-  {
-    unsigned a : 8;
-    unsigned b : 8;
-    unsigned c : 8;
-    signed d : 11;
-  };
+  using InputRegType = TevCombiner::InputRegType;
 
   struct TextureCoordinateType
   {
@@ -105,26 +80,27 @@ class Tev
   };
 
   // color order: ABGR
-  Common::EnumMap<TevColor, TevOutput::Color2> Reg;
-  std::array<TevColor, 4> KonstantColors;
-  TevColor TexColor;
-  TevColor RasColor;
-  TevColor StageKonst;
+  Common::EnumMap<QuadColor, TevOutput::Color2> Reg;
+  std::array<QuadColor, 4> KonstantColors;
+  QuadColor TexColor;
+  QuadColor RasColor;
+  QuadColor StageKonst;
 
   // Fixed constants, corresponding to KonstSel
-  static constexpr s16 V0 = 0;
-  static constexpr s16 V1_8 = 32;
-  static constexpr s16 V1_4 = 64;
-  static constexpr s16 V3_8 = 96;
-  static constexpr s16 V1_2 = 128;
-  static constexpr s16 V5_8 = 159;
-  static constexpr s16 V3_4 = 191;
-  static constexpr s16 V7_8 = 223;
-  static constexpr s16 V1 = 255;
-
-  u8 AlphaBump = 0;
-  u8 IndirectTex[4][4]{};
-  TextureCoordinateType TexCoord{};
+  static constexpr s16 V0[4] = {0, 0, 0, 0};
+  static constexpr s16 V1_8[4] = {32, 32, 32, 32};
+  static constexpr s16 V1_4[4] = {64, 64, 64, 64};
+  static constexpr s16 V3_8[4] = {96, 96, 96, 96};
+  static constexpr s16 V1_2[4] = {128, 128, 128, 128};
+  static constexpr s16 V5_8[4] = {159, 159, 159, 159};
+  static constexpr s16 V3_4[4] = {191, 191, 191, 191};
+  static constexpr s16 V7_8[4] = {223, 223, 223, 223};
+  static constexpr s16 V1[4] = {255, 255, 255, 255};
+
+  // Per pixel of the quad
+  u8 AlphaBump[4]{};
+  u8 IndirectTex[4][4][4]{};
+  TextureCoordinateType TexCoord[4]{};
 
   const Common::EnumMap<TevColorRef, TevColorArg::Zero> m_ColorInputLUT{
       TevColorRef::Color(Reg[TevOutput::Prev]),    // prev.rgb
@@ -144,15 +120,15 @@ class Tev
       TevColorRef::Color(StageKonst),              // konst
       TevColorRef::All(V0),                        // zero
   };
-  const Common::EnumMap<TevAlphaRef, TevAlphaArg::Zero> m_AlphaInputLUT{
-      TevAlphaRef(Reg[TevOutput::Prev]),    // prev
-      TevAlphaRef(Reg[TevOutput::Color0]),  // c0
-      TevAlphaRef(Reg[TevOutput::Color1]),  // c1
-      TevAlphaRef(Reg[TevOutput::Color2]),  // c2
-      TevAlphaRef(TexColor),                // tex
-      TevAlphaRef(RasColor),                // ras
-      TevAlphaRef(StageKonst),              // konst
-      TevAlphaRef(V0),                      // zero
+  const Common::EnumMap<const s16*, TevAlphaArg::Zero> m_AlphaInputLUT{
+      Reg[TevOutput::Prev].c[ALP_C],    // prev
+      Reg[TevOutput::Color0].c[ALP_C],  // c0
+      Reg[TevOutput::Color1].c[ALP_C],  // c1
+      Reg[TevOutput::Color2].c[ALP_C],  // c2
+      TexColor.c[ALP_C],                // tex
+      RasColor.c[ALP_C],                // ras
+      StageKonst.c[ALP_C],              // konst
+      V0,                               // zero
   };
   const Common::EnumMap<TevKonstRef, KonstSel::K3_A> m_KonstLUT{
       TevKonstRef::Value(V1),    // 1
@@ -175,26 +151,23 @@ class Tev
       TevKonstRef::Konst(V0, KonstantColors[2]),  // Konst 2 RGB
       TevKonstRef::Konst(V0, KonstantColors[3]),  // Konst 3 RGB
 
-      TevKonstRef::Value(KonstantColors[0].r),  // Konst 0 Red
-      TevKonstRef::Value(KonstantColors[1].r),  // Konst 1 Red
-      TevKonstRef::Value(KonstantColors[2].r),  // Konst 2 Red
-      TevKonstRef::Value(KonstantColors[3].r),  // Konst 3 Red
-      TevKonstRef::Value(KonstantColors[0].g),  // Konst 0 Green
-      TevKonstRef::Value(KonstantColors[1].g),  // Konst 1 Green
-      TevKonstRef::Value(KonstantColors[2].g),  // Konst 2 Green
-      TevKonstRef::Value(KonstantColors[3].g),  // Konst 3 Green
-      TevKonstRef::Value(KonstantColors[0].b),  // Konst 0 Blue
-      TevKonstRef::Value(KonstantColors[1].b),  // Konst 1 Blue
-      TevKonstRef::Value(KonstantColors[2].b),  // Konst 2 Blue
-      TevKonstRef::Value(KonstantColors[3].b),  // Konst 3 Blue
-      TevKonstRef::Value(KonstantColors[0].a),  // Konst 0 Alpha
-      TevKonstRef::Value(KonstantColors[1].a),  // Konst 1 Alpha
-      TevKonstRef::Value(KonstantColors[2].a),  // Konst 2 Alpha
-      TevKonstRef::Value(KonstantColors[3].a),  // Konst 3 Alpha
+      TevKonstRef::Value(KonstantColors[0].c[RED_C]),  // Konst 0 Red
+      TevKonstRef::Value(KonstantColors[1].c[RED_C]),  // Konst 1 Red
+      TevKonstRef::Value(KonstantColors[2].c[RED_C]),  // Konst 2 Red
+      TevKonstRef::Value(KonstantColors[3].c[RED_C]),  // Konst 3 Red
+      TevKonstRef::Value(KonstantColors[0].c[GRN_C]),  // Konst 0 Green
+      TevKonstRef::Value(KonstantColors[1].c[GRN_C]),  // Konst 1 Green
+      TevKonstRef::Value(KonstantColors[2].c[GRN_C]),  // Konst 2 Green
+      TevKonstRef::Value(KonstantColors[3].c[GRN_C]),  // Konst 3 Green
+      TevKonstRef::Value(KonstantColors[0].c[BLU_C]),  // Konst 0 Blue
+      TevKonstRef::Value(KonstantColors[1].c[BLU_C]),  // Konst 1 Blue
+      TevKonstRef::Value(KonstantColors[2].c[BLU_C]),  // Konst 2 Blue
+      TevKonstRef::Value(KonstantColors[3].c[BLU_C]),  // Konst 3 Blue
+      TevKonstRef::Value(KonstantColors[0].c[ALP_C]),  // Konst 0 Alpha
+      TevKonstRef::Value(KonstantColors[1].c[ALP_C]),  // Konst 1 Alpha
+      TevKonstRef::Value(KonstantColors[2].c[ALP_C]),  // Konst 2 Alpha
+      TevKonstRef::Value(KonstantColors[3].c[ALP_C]),  // Konst 3 Alpha
   };
-  static constexpr Common::EnumMap<s16, TevBias::Compare> s_BiasLUT{0, 128, -128, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleLShiftLUT{0, 1, 2, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleRShiftLUT{0, 0, 0, 1};
 
   enum BufferBase
   {
@@ -205,22 +178,38 @@ class Tev
 
   void SetRasColor(RasColorChan colorChan, u32 swaptable);
 
-  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-
-  void Indirect(unsigned int stageNum, s32 s, s32 t);
+  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                        s16 result[4]);
+  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                        s16 result[4]);
+  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                        s16 result[4]);
+  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                        s16 result[4]);
+  void CombineSeparately(const TevStageCombiner::ColorCombiner& cc,
+                         const TevStageCombiner::AlphaCombiner& ac,
+                         const TevCombiner::QuadInputs& inputs, u32 mask);
+
+  void Indirect(unsigned int stageNum, int pixel, s32 s, s32 t);
+  void ApplyFog(u8 output[4][4], u32 mask) const;
 
 public:
-  s32 Position[3]{};
-  u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
-  TextureCoordinateType Uv[8]{};
+  // The TEV works on quads of 2x2 pixels, which are indexed as x + y * 2 within the quad. Only
+  // the pixels in the mask that is passed to DrawQuad need to be set.
+  s32 Position[4][3]{};
+  u8 Color[4][2][4]{};  // must be RGBA for correct swap table ordering
+  TextureCoordinateType Uv[4][8]{};
+  // Shared by all pixels of a quad
   s32 IndirectLod[4]{};
   bool IndirectLinear[4]{};
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Pixel statistics, which the rasterizer adds to g_stats. Several Tevs may draw at once, so they
+  // can't be counted there directly.
+  u32 PixelsIn = 0;
+  u32 PixelsOut = 0;
+
   enum
   {
     ALP_C,
@@ -230,5 +219,6 @@ public:
   };
 
   void SetKonstColors();
-  void Draw();
+  // Draws the pixels of the quad whose bits are set in mask
+  void DrawQuad(u32 mask);
 };
@@ -0,0 +1,571 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Software/TevCombiner.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/EnumMap.h"
+#include "Common/MsgHandler.h"
+
+#if defined(_M_X86_64)
+#define USE_SSE
+#include <immintrin.h>
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace TevCombiner
+{
+namespace
+{
+constexpr Common::EnumMap<s16, TevBias::Compare> s_bias_lut{0, 128, -128, 0};
+constexpr Common::EnumMap<u8, TevScale::Divide2> s_scale_lshift_lut{0, 1, 2, 0};
+constexpr Common::EnumMap<u8, TevScale::Divide2> s_scale_rshift_lut{0, 0, 0, 1};
+
+enum
+{
+  ALP_C,
+  BLU_C,
+  GRN_C,
+  RED_C
+};
+
+// The settings of one combiner, expanded so that the color and alpha combiners can be evaluated
+// with the same instructions.
+struct CombinerParameters
+{
+  // 1 << left shift of the scale
+  s16 multiplier;
+  s16 bias;
+  s32 rounding;
+  // All bits set if the product is subtracted
+  s32 negate;
+  // 1 if the result is divided by 2
+  s32 right_shift;
+  s16 min;
+  s16 max;
+};
+
+// The combiner settings of each channel of CombineRegular.
+struct LaneParameters
+{
+  // 1 << left shift of the scale
+  s16 multiplier[4];
+  s16 bias[4];
+  s32 rounding[4];
+  // All bits set for channels that are subtracted or divided by 2, respectively
+  s32 negate[4];
+  s32 halve[4];
+  s16 min[4];
+  s16 max[4];
+};
+
+CombinerParameters GetParameters(TevOp op, TevBias bias, TevScale scale, bool clamp,
+                                 bool is_alpha)
+{
+  const bool sub = op == TevOp::Sub;
+
+  s32 rounding = (scale == TevScale::Divide2) ? 0 : sub ? 127 : 128;
+  // The alpha combiner negates before shifting instead of after, which rounds the other way:
+  // (-x) >> 8 == -((x + 255) >> 8)
+  if (sub && is_alpha)
+    rounding += 255;
+
+  CombinerParameters params;
+  params.multiplier = 1 << s_scale_lshift_lut[scale];
+  params.bias = s_bias_lut[bias];
+  params.rounding = rounding;
+  params.negate = sub ? -1 : 0;
+  params.right_shift = s_scale_rshift_lut[scale];
+  params.min = clamp ? 0 : -1024;
+  params.max = clamp ? 255 : 1023;
+  return params;
+}
+
+CombinerParameters GetColorParameters(const TevStageCombiner::ColorCombiner& cc)
+{
+  return GetParameters(cc.op, cc.bias, cc.scale, cc.clamp, false);
+}
+
+CombinerParameters GetAlphaParameters(const TevStageCombiner::AlphaCombiner& ac)
+{
+  return GetParameters(ac.op, ac.bias, ac.scale, ac.clamp, true);
+}
+
+void SetLane(LaneParameters* params, int lane, const CombinerParameters& combiner)
+{
+  params->multiplier[lane] = combiner.multiplier;
+  params->bias[lane] = combiner.bias;
+  params->rounding[lane] = combiner.rounding;
+  params->negate[lane] = combiner.negate;
+  params->halve[lane] = combiner.right_shift ? -1 : 0;
+  params->min[lane] = combiner.min;
+  params->max[lane] = combiner.max;
+}
+
+#if defined(USE_SSE)
+__m128i SetHalves16(s16 low, s16 high)
+{
+  return _mm_unpacklo_epi64(_mm_set1_epi16(low), _mm_set1_epi16(high));
+}
+
+// Evaluates one combiner for four pixels, given the products a * (256 - c) + b * c (with the
+// scale's left shift already applied) and the scaled and biased d values as 32-bit lanes.
+__m128i FinishCombine(__m128i temp, __m128i d, const CombinerParameters& params)
+{
+  temp = _mm_srai_epi32(_mm_add_epi32(temp, _mm_set1_epi32(params.rounding)), 8);
+  const __m128i negate = _mm_set1_epi32(params.negate);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate), negate);
+  return _mm_sra_epi32(_mm_add_epi32(d, temp), _mm_cvtsi32_si128(params.right_shift));
+}
+
+// Evaluates two channels of a quad, which are in the low and high four 16-bit lanes of the inputs.
+__m128i CombineTwoChannels(__m128i a, __m128i b, __m128i c, __m128i d,
+                           const CombinerParameters& low, const CombinerParameters& high)
+{
+  const __m128i low_byte = _mm_set1_epi16(0xFF);
+  a = _mm_and_si128(a, low_byte);
+  b = _mm_and_si128(b, low_byte);
+  c = _mm_and_si128(c, low_byte);
+  // Sign extend the 11-bit d values
+  d = _mm_srai_epi16(_mm_slli_epi16(d, 5), 5);
+
+  const __m128i multiplier = SetHalves16(low.multiplier, high.multiplier);
+  const __m128i c_adjusted = _mm_add_epi16(c, _mm_srli_epi16(c, 7));
+  const __m128i weight_a =
+      _mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(256), c_adjusted), multiplier);
+  const __m128i weight_b = _mm_mullo_epi16(c_adjusted, multiplier);
+  const __m128i vd =
+      _mm_mullo_epi16(_mm_add_epi16(d, SetHalves16(low.bias, high.bias)), multiplier);
+
+  const __m128i product_low =
+      _mm_madd_epi16(_mm_unpacklo_epi16(a, b), _mm_unpacklo_epi16(weight_a, weight_b));
+  const __m128i product_high =
+      _mm_madd_epi16(_mm_unpackhi_epi16(a, b), _mm_unpackhi_epi16(weight_a, weight_b));
+  const __m128i sum_low =
+      FinishCombine(product_low, _mm_srai_epi32(_mm_unpacklo_epi16(vd, vd), 16), low);
+  const __m128i sum_high =
+      FinishCombine(product_high, _mm_srai_epi32(_mm_unpackhi_epi16(vd, vd), 16), high);
+
+  // The results always fit into 16 bits, so the saturation doesn't matter
+  const __m128i result = _mm_packs_epi32(sum_low, sum_high);
+  return _mm_max_epi16(_mm_min_epi16(result, SetHalves16(low.max, high.max)),
+                       SetHalves16(low.min, high.min));
+}
+
+FUNCTION_TARGET_AVX2
+inline __m256i SetHalves(__m128i low, __m128i high)
+{
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+FUNCTION_TARGET_AVX2
+inline __m256i LoadQuad(const s16 (*src)[4])
+{
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+// Like FinishCombine, for the alpha or green channel in the first half and the blue or red one in
+// the second half.
+FUNCTION_TARGET_AVX2
+inline __m256i FinishCombine_AVX2(__m256i temp, __m256i d, const CombinerParameters& first,
+                                  const CombinerParameters& second)
+{
+  temp = _mm256_add_epi32(
+      temp, SetHalves(_mm_set1_epi32(first.rounding), _mm_set1_epi32(second.rounding)));
+  temp = _mm256_srai_epi32(temp, 8);
+  const __m256i negate = SetHalves(_mm_set1_epi32(first.negate), _mm_set1_epi32(second.negate));
+  temp = _mm256_sub_epi32(_mm256_xor_si256(temp, negate), negate);
+  const __m256i shift =
+      SetHalves(_mm_set1_epi32(first.right_shift), _mm_set1_epi32(second.right_shift));
+  return _mm256_srav_epi32(_mm256_add_epi32(d, temp), shift);
+}
+
+// Evaluates all channels of a quad at once. The first 128-bit half of each register holds the
+// alpha and blue channels and the second half the green and red ones, so unpacking yields the
+// alpha and green channels in the low lanes and the blue and red ones in the high lanes.
+FUNCTION_TARGET_AVX2
+void CombineQuad_AVX2(const CombinerParameters& color, const CombinerParameters& alpha,
+                      const QuadInputs& inputs, s16 result[4][4])
+{
+  const __m256i low_byte = _mm256_set1_epi16(0xFF);
+  const __m256i a = _mm256_and_si256(LoadQuad(inputs.a), low_byte);
+  const __m256i b = _mm256_and_si256(LoadQuad(inputs.b), low_byte);
+  const __m256i c = _mm256_and_si256(LoadQuad(inputs.c), low_byte);
+  // Sign extend the 11-bit d values
+  const __m256i d = _mm256_srai_epi16(_mm256_slli_epi16(LoadQuad(inputs.d), 5), 5);
+
+  const __m256i multiplier = SetHalves(SetHalves16(alpha.multiplier, color.multiplier),
+                                       _mm_set1_epi16(color.multiplier));
+  const __m256i bias = SetHalves(SetHalves16(alpha.bias, color.bias), _mm_set1_epi16(color.bias));
+  const __m256i c_adjusted = _mm256_add_epi16(c, _mm256_srli_epi16(c, 7));
+  const __m256i weight_a =
+      _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_set1_epi16(256), c_adjusted), multiplier);
+  const __m256i weight_b = _mm256_mullo_epi16(c_adjusted, multiplier);
+  const __m256i vd = _mm256_mullo_epi16(_mm256_add_epi16(d, bias), multiplier);
+
+  const __m256i sum_low = FinishCombine_AVX2(
+      _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), _mm256_unpacklo_epi16(weight_a, weight_b)),
+      _mm256_srai_epi32(_mm256_unpacklo_epi16(vd, vd), 16), alpha, color);
+  const __m256i sum_high = FinishCombine_AVX2(
+      _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), _mm256_unpackhi_epi16(weight_a, weight_b)),
+      _mm256_srai_epi32(_mm256_unpackhi_epi16(vd, vd), 16), color, color);
+
+  const __m256i max = SetHalves(SetHalves16(alpha.max, color.max), _mm_set1_epi16(color.max));
+  const __m256i min = SetHalves(SetHalves16(alpha.min, color.min), _mm_set1_epi16(color.min));
+  __m256i clamped = _mm256_packs_epi32(sum_low, sum_high);
+  clamped = _mm256_max_epi16(_mm256_min_epi16(clamped, max), min);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(result), clamped);
+}
+#elif defined(USE_NEON)
+// Evaluates one channel of a quad
+void CombineChannel(const s16 a[4], const s16 b[4], const s16 c[4], const s16 d[4],
+                    const CombinerParameters& params, s16 result[4])
+{
+  const int32x4_t low_byte = vdupq_n_s32(0xFF);
+  const int32x4_t va = vandq_s32(vmovl_s16(vld1_s16(a)), low_byte);
+  const int32x4_t vb = vandq_s32(vmovl_s16(vld1_s16(b)), low_byte);
+  const int32x4_t vc = vandq_s32(vmovl_s16(vld1_s16(c)), low_byte);
+  // Sign extend the 11-bit d values
+  const int32x4_t vd = vshrq_n_s32(vshlq_n_s32(vmovl_s16(vld1_s16(d)), 21), 21);
+  const int32x4_t multiplier = vdupq_n_s32(params.multiplier);
+
+  // c + (c >> 7) maps 255 to 256
+  const int32x4_t c_adjusted = vaddq_s32(vc, vshrq_n_s32(vc, 7));
+  int32x4_t temp = vmulq_s32(va, vsubq_s32(vdupq_n_s32(256), c_adjusted));
+  temp = vmlaq_s32(temp, vb, c_adjusted);
+  temp = vmulq_s32(temp, multiplier);
+  temp = vaddq_s32(temp, vdupq_n_s32(params.rounding));
+  temp = vshrq_n_s32(temp, 8);
+  const int32x4_t negate = vdupq_n_s32(params.negate);
+  temp = vsubq_s32(veorq_s32(temp, negate), negate);
+
+  int32x4_t sum = vmlaq_s32(temp, vaddq_s32(vd, vdupq_n_s32(params.bias)), multiplier);
+  sum = vshlq_s32(sum, vdupq_n_s32(-params.right_shift));
+
+  int16x4_t clamped = vmovn_s32(sum);
+  clamped = vmax_s16(vmin_s16(clamped, vdup_n_s16(params.max)), vdup_n_s16(params.min));
+  vst1_s16(result, clamped);
+}
+#endif
+
+bool AlphaCompare(u8 alpha, u32 ref, CompareMode comp)
+{
+  switch (comp)
+  {
+  case CompareMode::Always:
+    return true;
+  case CompareMode::Never:
+    return false;
+  case CompareMode::LEqual:
+    return alpha <= ref;
+  case CompareMode::Less:
+    return alpha < ref;
+  case CompareMode::GEqual:
+    return alpha >= ref;
+  case CompareMode::Greater:
+    return alpha > ref;
+  case CompareMode::Equal:
+    return alpha == ref;
+  case CompareMode::NEqual:
+    return alpha != ref;
+  default:
+    PanicAlertFmt("Invalid compare mode {}", comp);
+    return true;
+  }
+}
+}  // namespace
+
+s16 ColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType& input)
+{
+  const u16 c = input.c + (input.c >> 7);
+
+  s32 temp = input.a * (256 - c) + (input.b * c);
+  temp <<= s_scale_lshift_lut[cc.scale];
+  temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  temp >>= 8;
+  temp = cc.op == TevOp::Sub ? -temp : temp;
+
+  s32 result = ((input.d + s_bias_lut[cc.bias]) << s_scale_lshift_lut[cc.scale]) + temp;
+  result = result >> s_scale_rshift_lut[cc.scale];
+
+  return static_cast<s16>(result);
+}
+
+s16 AlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType& input)
+{
+  const u16 c = input.c + (input.c >> 7);
+
+  s32 temp = input.a * (256 - c) + (input.b * c);
+  temp <<= s_scale_lshift_lut[ac.scale];
+  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
+  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
+
+  s32 result = ((input.d + s_bias_lut[ac.bias]) << s_scale_lshift_lut[ac.scale]) + temp;
+  result = result >> s_scale_rshift_lut[ac.scale];
+
+  return static_cast<s16>(result);
+}
+
+void CombineRegular(const TevStageCombiner::ColorCombiner& cc,
+                    const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                    s16 result[4])
+{
+#if defined(USE_SSE) || defined(USE_NEON)
+  LaneParameters params;
+  SetLane(&params, ALP_C, GetAlphaParameters(ac));
+  const CombinerParameters color = GetColorParameters(cc);
+  for (int i = BLU_C; i <= RED_C; i++)
+    SetLane(&params, i, color);
+
+  s16 a[4], b[4], c[4], d[4];
+  for (int i = 0; i < 4; i++)
+  {
+    a[i] = inputs[i].a;
+    b[i] = inputs[i].b;
+    c[i] = inputs[i].c;
+    d[i] = inputs[i].d;
+  }
+#endif
+
+#if defined(USE_SSE)
+  const auto load64 = [](const s16* src) {
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+  };
+  const auto load128 = [](const s32* src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  };
+
+  const __m128i multiplier = load64(params.multiplier);
+
+  // c + (c >> 7) maps 255 to 256. The scale's left shift is applied to the weights, so that
+  // a * (256 - c) + b * c can be computed by a single multiply-add.
+  const __m128i vc = load64(c);
+  const __m128i c_adjusted = _mm_add_epi16(vc, _mm_srli_epi16(vc, 7));
+  const __m128i weight_a =
+      _mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(256), c_adjusted), multiplier);
+  const __m128i weight_b = _mm_mullo_epi16(c_adjusted, multiplier);
+  __m128i temp = _mm_madd_epi16(_mm_unpacklo_epi16(load64(a), load64(b)),
+                                _mm_unpacklo_epi16(weight_a, weight_b));
+  temp = _mm_add_epi32(temp, load128(params.rounding));
+  temp = _mm_srai_epi32(temp, 8);
+  const __m128i negate = load128(params.negate);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate), negate);
+
+  __m128i vd = _mm_mullo_epi16(_mm_add_epi16(load64(d), load64(params.bias)), multiplier);
+  vd = _mm_srai_epi32(_mm_unpacklo_epi16(vd, vd), 16);
+
+  __m128i sum = _mm_add_epi32(vd, temp);
+  const __m128i halve = load128(params.halve);
+  sum = _mm_or_si128(_mm_andnot_si128(halve, sum), _mm_and_si128(halve, _mm_srai_epi32(sum, 1)));
+
+  // The results always fit into 16 bits, so the saturation doesn't matter
+  __m128i clamped = _mm_packs_epi32(sum, sum);
+  clamped = _mm_max_epi16(_mm_min_epi16(clamped, load64(params.max)), load64(params.min));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(result), clamped);
+#elif defined(USE_NEON)
+  const int32x4_t multiplier = vmovl_s16(vld1_s16(params.multiplier));
+
+  // c + (c >> 7) maps 255 to 256
+  const int32x4_t vc = vmovl_s16(vld1_s16(c));
+  const int32x4_t c_adjusted = vaddq_s32(vc, vshrq_n_s32(vc, 7));
+  int32x4_t temp = vmulq_s32(vmovl_s16(vld1_s16(a)), vsubq_s32(vdupq_n_s32(256), c_adjusted));
+  temp = vmlaq_s32(temp, vmovl_s16(vld1_s16(b)), c_adjusted);
+  temp = vmulq_s32(temp, multiplier);
+  temp = vaddq_s32(temp, vld1q_s32(params.rounding));
+  temp = vshrq_n_s32(temp, 8);
+  const int32x4_t negate = vld1q_s32(params.negate);
+  temp = vsubq_s32(veorq_s32(temp, negate), negate);
+
+  const int32x4_t vd =
+      vmulq_s32(vaddq_s32(vmovl_s16(vld1_s16(d)), vmovl_s16(vld1_s16(params.bias))), multiplier);
+
+  int32x4_t sum = vaddq_s32(vd, temp);
+  sum = vbslq_s32(vreinterpretq_u32_s32(vld1q_s32(params.halve)), vshrq_n_s32(sum, 1), sum);
+
+  int16x4_t clamped = vmovn_s32(sum);
+  clamped = vmax_s16(vmin_s16(clamped, vld1_s16(params.max)), vld1_s16(params.min));
+  vst1_s16(result, clamped);
+#else
+  for (int i = BLU_C; i <= RED_C; i++)
+  {
+    const s16 color = ColorRegular(cc, inputs[i]);
+    result[i] = cc.clamp ? std::clamp<s16>(color, 0, 255) : std::clamp<s16>(color, -1024, 1023);
+  }
+
+  const s16 alpha = AlphaRegular(ac, inputs[ALP_C]);
+  result[ALP_C] = ac.clamp ? std::clamp<s16>(alpha, 0, 255) : std::clamp<s16>(alpha, -1024, 1023);
+#endif
+}
+
+void CombineQuad(const TevStageCombiner::ColorCombiner& cc,
+                 const TevStageCombiner::AlphaCombiner& ac, const QuadInputs& inputs,
+                 s16 result[4][4])
+{
+#if defined(USE_SSE) || defined(USE_NEON)
+  const CombinerParameters color = GetColorParameters(cc);
+  const CombinerParameters alpha = GetAlphaParameters(ac);
+#endif
+
+#if defined(USE_SSE)
+  if (cpu_info.bAVX2)
+  {
+    CombineQuad_AVX2(color, alpha, inputs, result);
+    return;
+  }
+
+  const auto load = [](const s16 (*src)[4]) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(src));
+  };
+  const auto store = [](s16 (*dst)[4], __m128i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);
+  };
+  store(&result[ALP_C], CombineTwoChannels(load(&inputs.a[ALP_C]), load(&inputs.b[ALP_C]),
+                                           load(&inputs.c[ALP_C]), load(&inputs.d[ALP_C]),
+                                           alpha, color));
+  store(&result[GRN_C], CombineTwoChannels(load(&inputs.a[GRN_C]), load(&inputs.b[GRN_C]),
+                                           load(&inputs.c[GRN_C]), load(&inputs.d[GRN_C]),
+                                           color, color));
+#elif defined(USE_NEON)
+  for (int i = 0; i < 4; i++)
+  {
+    CombineChannel(inputs.a[i], inputs.b[i], inputs.c[i], inputs.d[i],
+                   i == ALP_C ? alpha : color, result[i]);
+  }
+#else
+  for (int pixel = 0; pixel < 4; pixel++)
+  {
+    InputRegType input[4];
+    for (int i = 0; i < 4; i++)
+    {
+      input[i].a = inputs.a[i][pixel];
+      input[i].b = inputs.b[i][pixel];
+      input[i].c = inputs.c[i][pixel];
+      input[i].d = inputs.d[i][pixel];
+    }
+
+    s16 pixel_result[4];
+    CombineRegular(cc, ac, input, pixel_result);
+    for (int i = 0; i < 4; i++)
+      result[i][pixel] = pixel_result[i];
+  }
+#endif
+}
+
+bool PassesAlphaTest(const AlphaTest& alpha_test, u8 alpha)
+{
+  const bool comp0 = AlphaCompare(alpha, alpha_test.ref0, alpha_test.comp0);
+  const bool comp1 = AlphaCompare(alpha, alpha_test.ref1, alpha_test.comp1);
+
+  switch (alpha_test.logic)
+  {
+  case AlphaTestOp::And:
+    return comp0 && comp1;
+  case AlphaTestOp::Or:
+    return comp0 || comp1;
+  case AlphaTestOp::Xor:
+    return comp0 ^ comp1;
+  case AlphaTestOp::Xnor:
+    return !(comp0 ^ comp1);
+  default:
+    PanicAlertFmt("Invalid AlphaTestOp {}", alpha_test.logic);
+    return true;
+  }
+}
+
+u32 AlphaTestQuad(const AlphaTest& alpha_test, const u8 alpha[4])
+{
+  // CompareMode has one bit each for passing if less, equal and greater
+#if defined(USE_SSE)
+  u32 packed;
+  std::memcpy(&packed, alpha, sizeof(packed));
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i values =
+      _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+
+  const auto compare = [&](u32 ref, CompareMode comp) {
+    const __m128i vref = _mm_set1_epi32(ref);
+    const u32 bits = static_cast<u32>(comp);
+    __m128i passed = zero;
+    if (bits & 1)
+      passed = _mm_or_si128(passed, _mm_cmplt_epi32(values, vref));
+    if (bits & 2)
+      passed = _mm_or_si128(passed, _mm_cmpeq_epi32(values, vref));
+    if (bits & 4)
+      passed = _mm_or_si128(passed, _mm_cmpgt_epi32(values, vref));
+    return passed;
+  };
+  const __m128i comp0 = compare(alpha_test.ref0, alpha_test.comp0);
+  const __m128i comp1 = compare(alpha_test.ref1, alpha_test.comp1);
+
+  __m128i passed;
+  switch (alpha_test.logic)
+  {
+  case AlphaTestOp::And:
+    passed = _mm_and_si128(comp0, comp1);
+    break;
+  case AlphaTestOp::Or:
+    passed = _mm_or_si128(comp0, comp1);
+    break;
+  case AlphaTestOp::Xor:
+    passed = _mm_xor_si128(comp0, comp1);
+    break;
+  case AlphaTestOp::Xnor:
+  default:
+    passed = _mm_xor_si128(_mm_xor_si128(comp0, comp1), _mm_set1_epi32(-1));
+    break;
+  }
+  return static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(passed)));
+#elif defined(USE_NEON)
+  const uint32x4_t values = {alpha[0], alpha[1], alpha[2], alpha[3]};
+
+  const auto compare = [&](u32 ref, CompareMode comp) {
+    const uint32x4_t vref = vdupq_n_u32(ref);
+    const u32 bits = static_cast<u32>(comp);
+    uint32x4_t passed = vdupq_n_u32(0);
+    if (bits & 1)
+      passed = vorrq_u32(passed, vcltq_u32(values, vref));
+    if (bits & 2)
+      passed = vorrq_u32(passed, vceqq_u32(values, vref));
+    if (bits & 4)
+      passed = vorrq_u32(passed, vcgtq_u32(values, vref));
+    return passed;
+  };
+  const uint32x4_t comp0 = compare(alpha_test.ref0, alpha_test.comp0);
+  const uint32x4_t comp1 = compare(alpha_test.ref1, alpha_test.comp1);
+
+  uint32x4_t passed;
+  switch (alpha_test.logic)
+  {
+  case AlphaTestOp::And:
+    passed = vandq_u32(comp0, comp1);
+    break;
+  case AlphaTestOp::Or:
+    passed = vorrq_u32(comp0, comp1);
+    break;
+  case AlphaTestOp::Xor:
+    passed = veorq_u32(comp0, comp1);
+    break;
+  case AlphaTestOp::Xnor:
+  default:
+    passed = vmvnq_u32(veorq_u32(comp0, comp1));
+    break;
+  }
+  const uint32x4_t lane_bits = {1, 2, 4, 8};
+  return vaddvq_u32(vandq_u32(passed, lane_bits));
+#else
+  u32 mask = 0;
+  for (u32 i = 0; i < 4; i++)
+  {
+    if (PassesAlphaTest(alpha_test, alpha[i]))
+      mask |= 1u << i;
+  }
+  return mask;
+#endif
+}
+}  // namespace TevCombiner
@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BPMemory.h"
+
+namespace TevCombiner
+{
+// The inputs of one channel of a TEV stage, truncated to the sizes of the hardware registers.
+struct InputRegType
+{
+  unsigned a : 8;
+  unsigned b : 8;
+  unsigned c : 8;
+  signed d : 11;
+};
+
+// Reference implementations of the color and alpha combiners for one channel, without clamping.
+// Only valid if the combiner doesn't use TevBias::Compare.
+s16 ColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType& input);
+s16 AlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType& input);
+
+// Evaluates and clamps the color and alpha combiners of a stage for all four channels at once,
+// using SIMD instructions where available. inputs and result are indexed by Tev::ALP_C, BLU_C,
+// GRN_C and RED_C, i.e. in the order alpha, blue, green, red. Gives exactly the same results as
+// ColorRegular and AlphaRegular followed by clamping, and has the same restriction.
+void CombineRegular(const TevStageCombiner::ColorCombiner& cc,
+                    const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                    s16 result[4]);
+
+// The inputs of a TEV stage for the four pixels of a 2x2 quad, as [channel][pixel] with the
+// channels in the same order as for CombineRegular. The values are truncated to the sizes of the
+// hardware registers by CombineQuad.
+struct QuadInputs
+{
+  alignas(16) s16 a[4][4];
+  alignas(16) s16 b[4][4];
+  alignas(16) s16 c[4][4];
+  alignas(16) s16 d[4][4];
+};
+
+// Like CombineRegular, for all channels of the four pixels of a quad at once. result is indexed
+// as [channel][pixel]. Uses AVX2 where available.
+void CombineQuad(const TevStageCombiner::ColorCombiner& cc,
+                 const TevStageCombiner::AlphaCombiner& ac, const QuadInputs& inputs,
+                 s16 result[4][4]);
+
+// Returns whether the given alpha value passes the alpha test.
+bool PassesAlphaTest(const AlphaTest& alpha_test, u8 alpha);
+// Returns a mask of the pixels of a quad that pass the alpha test, with bit i set for alpha[i].
+u32 AlphaTestQuad(const AlphaTest& alpha_test, const u8 alpha[4]);
+}  // namespace TevCombiner
@@ -5,6 +5,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
@@ -68,6 +75,50 @@ static inline void AddTexel(const u8* inTexel, u32* outTexel, u32 fract)
   outTexel[3] += inTexel[3] * fract;
 }
 
+// Blends four texels (top left, top right, bottom left, bottom right) with the given weights,
+// which add up to 128 * 128.
+static inline void BlendTexels(const u8 texels[4][4], const u32 weights[4], u8* sample)
+{
+#if defined(_M_X86_64)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i all = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels));
+  const __m128i top = _mm_unpacklo_epi8(all, zero);
+  const __m128i bottom = _mm_unpackhi_epi8(all, zero);
+  // Interleave the channels of the left and right texels, so that a multiply-add blends them
+  const __m128i top_pairs = _mm_unpacklo_epi16(top, _mm_srli_si128(top, 8));
+  const __m128i bottom_pairs = _mm_unpacklo_epi16(bottom, _mm_srli_si128(bottom, 8));
+  const __m128i top_weights = _mm_set1_epi32(static_cast<s32>(weights[0] | weights[1] << 16));
+  const __m128i bottom_weights = _mm_set1_epi32(static_cast<s32>(weights[2] | weights[3] << 16));
+  const __m128i sum = _mm_add_epi32(_mm_madd_epi16(top_pairs, top_weights),
+                                    _mm_madd_epi16(bottom_pairs, bottom_weights));
+  const __m128i result = _mm_srli_epi32(sum, 14);
+  const s32 packed = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(result, zero), zero));
+  std::memcpy(sample, &packed, sizeof(packed));
+#elif defined(_M_ARM_64)
+  const uint8x16_t all = vld1q_u8(&texels[0][0]);
+  const uint16x8_t top = vmovl_u8(vget_low_u8(all));
+  const uint16x8_t bottom = vmovl_u8(vget_high_u8(all));
+  uint32x4_t sum = vmull_n_u16(vget_low_u16(top), static_cast<u16>(weights[0]));
+  sum = vmlal_n_u16(sum, vget_high_u16(top), static_cast<u16>(weights[1]));
+  sum = vmlal_n_u16(sum, vget_low_u16(bottom), static_cast<u16>(weights[2]));
+  sum = vmlal_n_u16(sum, vget_high_u16(bottom), static_cast<u16>(weights[3]));
+  const uint16x4_t result = vshrn_n_u32(sum, 14);
+  vst1_lane_u32(reinterpret_cast<u32*>(sample),
+                vreinterpret_u32_u8(vmovn_u16(vcombine_u16(result, result))), 0);
+#else
+  u32 texel[4];
+  SetTexel(texels[0], texel, weights[0]);
+  AddTexel(texels[1], texel, weights[1]);
+  AddTexel(texels[2], texel, weights[2]);
+  AddTexel(texels[3], texel, weights[3]);
+
+  sample[0] = (u8)(texel[0] >> 14);
+  sample[1] = (u8)(texel[1] >> 14);
+  sample[2] = (u8)(texel[2] >> 14);
+  sample[3] = (u8)(texel[3] >> 14);
+#endif
+}
+
 void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
 {
   int baseMip = 0;
@@ -192,55 +243,38 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     int imageTPlus1 = imageT + 1;
     const int fractT = t & 0x7f;
 
-    u8 sampledTex[4];
-    u32 texel[4];
-
     WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
     WrapCoord(&imageSPlus1, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageTPlus1, tm0.wrap_t, image_height_minus_1 + 1);
 
+    u8 texels[4][4];
     if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
     {
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageT, image_width_minus_1, texfmt,
+      TexDecoder_DecodeTexel(texels[0], imageSrc, imageS, imageT, image_width_minus_1, texfmt,
                              tlut, tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageT, image_width_minus_1, texfmt,
+      TexDecoder_DecodeTexel(texels[1], imageSrc, imageSPlus1, imageT, image_width_minus_1, texfmt,
                              tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageTPlus1, image_width_minus_1, texfmt,
+      TexDecoder_DecodeTexel(texels[2], imageSrc, imageS, imageTPlus1, image_width_minus_1, texfmt,
                              tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageTPlus1, image_width_minus_1,
+      TexDecoder_DecodeTexel(texels[3], imageSrc, imageSPlus1, imageTPlus1, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
     else
     {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageT,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[0], imageSrc, imageSrcOdd, imageS, imageT,
                                           image_width_minus_1);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1, imageT,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[1], imageSrc, imageSrcOdd, imageSPlus1, imageT,
                                           image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageTPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[2], imageSrc, imageSrcOdd, imageS, imageTPlus1,
                                           image_width_minus_1);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(texels[3], imageSrc, imageSrcOdd, imageSPlus1,
                                           imageTPlus1, image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
 
-    sample[0] = (u8)(texel[0] >> 14);
-    sample[1] = (u8)(texel[1] >> 14);
-    sample[2] = (u8)(texel[2] >> 14);
-    sample[3] = (u8)(texel[3] >> 14);
+    const u32 weights[4] = {u32((128 - fractS) * (128 - fractT)), u32(fractS * (128 - fractT)),
+                            u32((128 - fractS) * fractT), u32(fractS * fractT)};
+    BlendTexels(texels, weights, sample);
   }
   else
   {
@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
@@ -15,14 +16,23 @@
 
 namespace Vulkan
 {
-CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
-    : m_use_threaded_submission(use_threaded_submission)
+CommandBufferManager::CommandBufferManager(bool use_threaded_submission, bool use_record_thread)
+    : m_use_threaded_submission(use_threaded_submission),
+      m_use_record_thread(use_threaded_submission && use_record_thread)
 {
 }
 
 CommandBufferManager::~CommandBufferManager()
 {
-  // If the worker thread is enabled, stop and block until it exits.
+  // If the worker threads are enabled, stop and block until they exit.
+  if (m_use_record_thread)
+  {
+    WaitForRecordThreadIdle();
+    m_record_loop.Stop();
+    if (m_record_thread.joinable())
+      m_record_thread.join();
+  }
+
   if (m_use_threaded_submission)
   {
     WaitForWorkerThreadIdle();
@@ -40,6 +50,9 @@ bool CommandBufferManager::Initialize()
   if (m_use_threaded_submission && !CreateSubmitThread())
     return false;
 
+  if (m_use_record_thread && !CreateRecordThread())
+    return false;
+
   return true;
 }
 
@@ -231,6 +244,18 @@ bool CommandBufferManager::CreateSubmitThread()
   return true;
 }
 
+bool CommandBufferManager::CreateRecordThread()
+{
+  // Wait() must block until the loop has started, or queued commands could be skipped.
+  m_record_loop.Prepare();
+  m_record_thread = std::thread([this] {
+    Common::SetCurrentThreadName("VK record thread");
+    m_record_loop.Run([this] { RecordQueuedCommands(); });
+  });
+
+  return true;
+}
+
 void CommandBufferManager::WaitForWorkerThreadIdle()
 {
   if (!m_use_threaded_submission)
@@ -304,7 +329,8 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                                                VkSwapchainKHR present_swap_chain,
                                                uint32_t present_image_index)
 {
-  // End the current command buffer.
+  // End the current command buffer, once the record thread is done with it.
+  WaitForRecordThreadIdle();
   CmdBufferResources& resources = GetCurrentCmdBufferResources();
   for (VkCommandBuffer command_buffer : resources.command_buffers)
   {
@@ -378,6 +404,11 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
 
   // Switch to next cmdbuffer.
   BeginCommandBuffer();
+
+  // Let the record thread sleep when it runs out of commands, instead of spinning until the next
+  // command buffer is submitted.
+  if (m_use_record_thread)
+    m_record_loop.AllowSleep();
 }
 
 void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
@@ -501,6 +532,223 @@ void CommandBufferManager::BeginCommandBuffer()
   m_current_cmd_buffer = next_buffer_index;
 }
 
+void CommandBufferManager::RecordBeginRenderPass(VkRenderPass render_pass,
+                                                 VkFramebuffer framebuffer,
+                                                 const VkRect2D& render_area)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::BeginRenderPass;
+  command.begin_render_pass = {render_pass, framebuffer, render_area};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordEndRenderPass()
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::EndRenderPass;
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordBindVertexBuffer(VkBuffer buffer, VkDeviceSize offset)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::BindVertexBuffer;
+  command.bind_buffer = {buffer, offset, VK_INDEX_TYPE_UINT16};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset,
+                                                 VkIndexType index_type)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::BindIndexBuffer;
+  command.bind_buffer = {buffer, offset, index_type};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordBindPipeline(VkPipeline pipeline)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::BindPipeline;
+  command.pipeline = pipeline;
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordSetViewport(const VkViewport& viewport)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::SetViewport;
+  command.viewport = viewport;
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordSetScissor(const VkRect2D& scissor)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::SetScissor;
+  command.scissor = scissor;
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordBindDescriptorSets(VkPipelineLayout layout, u32 num_sets,
+                                                    const VkDescriptorSet* sets, u32 num_offsets,
+                                                    const u32* offsets)
+{
+  ASSERT(num_sets <= MAX_DEFERRED_DESCRIPTOR_SETS);
+  ASSERT(num_offsets <= NUM_UBO_DESCRIPTOR_SET_BINDINGS);
+
+  DeferredCommand command;
+  command.type = DeferredCommandType::BindDescriptorSets;
+  command.bind_descriptor_sets.layout = layout;
+  command.bind_descriptor_sets.num_sets = num_sets;
+  command.bind_descriptor_sets.num_offsets = num_offsets;
+  std::copy_n(sets, num_sets, command.bind_descriptor_sets.sets.begin());
+  std::copy_n(offsets, num_offsets, command.bind_descriptor_sets.offsets.begin());
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordDraw(u32 num_vertices, u32 base_vertex)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::Draw;
+  command.draw = {num_vertices, base_vertex, 0};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordDrawIndexed(u32 num_indices, u32 base_index, u32 base_vertex)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::DrawIndexed;
+  command.draw = {num_indices, base_index, base_vertex};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordBeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::BeginQuery;
+  command.query = {pool, query, 1, flags};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordEndQuery(VkQueryPool pool, u32 query)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::EndQuery;
+  command.query = {pool, query, 1, 0};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::RecordResetQueryPool(VkQueryPool pool, u32 first_query, u32 query_count)
+{
+  DeferredCommand command;
+  command.type = DeferredCommandType::ResetQueryPool;
+  command.query = {pool, first_query, query_count, 0};
+  QueueCommand(command);
+}
+
+void CommandBufferManager::QueueCommand(const DeferredCommand& command)
+{
+  if (!m_use_record_thread)
+  {
+    ExecuteCommand(GetCurrentCmdBufferResources().command_buffers[1], command);
+    return;
+  }
+
+  // If the ring is full, wait for the record thread to empty it.
+  const u32 write_index = m_deferred_write_index.load(std::memory_order_relaxed);
+  if (write_index - m_deferred_read_index.load(std::memory_order_acquire) ==
+      DEFERRED_COMMAND_RING_SIZE)
+  {
+    m_record_loop.Wait();
+  }
+
+  m_deferred_commands[write_index % DEFERRED_COMMAND_RING_SIZE] = command;
+  m_deferred_write_index.store(write_index + 1, std::memory_order_release);
+  m_record_loop.Wakeup();
+}
+
+void CommandBufferManager::RecordQueuedCommands()
+{
+  // The GPU thread waits for this thread to be idle before it switches to another command buffer,
+  // so the current command buffer can't change while there are commands left in the ring.
+  u32 read_index = m_deferred_read_index.load(std::memory_order_relaxed);
+  const u32 write_index = m_deferred_write_index.load(std::memory_order_acquire);
+  if (read_index == write_index)
+    return;
+
+  const VkCommandBuffer command_buffer = GetCurrentCmdBufferResources().command_buffers[1];
+  for (; read_index != write_index; read_index++)
+    ExecuteCommand(command_buffer, m_deferred_commands[read_index % DEFERRED_COMMAND_RING_SIZE]);
+
+  m_deferred_read_index.store(read_index, std::memory_order_release);
+}
+
+void CommandBufferManager::ExecuteCommand(VkCommandBuffer command_buffer,
+                                          const DeferredCommand& command)
+{
+  switch (command.type)
+  {
+  case DeferredCommandType::BeginRenderPass:
+  {
+    const VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                                              nullptr,
+                                              command.begin_render_pass.render_pass,
+                                              command.begin_render_pass.framebuffer,
+                                              command.begin_render_pass.render_area,
+                                              0,
+                                              nullptr};
+    vkCmdBeginRenderPass(command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    break;
+  }
+  case DeferredCommandType::EndRenderPass:
+    vkCmdEndRenderPass(command_buffer);
+    break;
+  case DeferredCommandType::BindVertexBuffer:
+    vkCmdBindVertexBuffers(command_buffer, 0, 1, &command.bind_buffer.buffer,
+                           &command.bind_buffer.offset);
+    break;
+  case DeferredCommandType::BindIndexBuffer:
+    vkCmdBindIndexBuffer(command_buffer, command.bind_buffer.buffer, command.bind_buffer.offset,
+                         command.bind_buffer.index_type);
+    break;
+  case DeferredCommandType::BindPipeline:
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, command.pipeline);
+    break;
+  case DeferredCommandType::SetViewport:
+    vkCmdSetViewport(command_buffer, 0, 1, &command.viewport);
+    break;
+  case DeferredCommandType::SetScissor:
+    vkCmdSetScissor(command_buffer, 0, 1, &command.scissor);
+    break;
+  case DeferredCommandType::BindDescriptorSets:
+    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            command.bind_descriptor_sets.layout, 0,
+                            command.bind_descriptor_sets.num_sets,
+                            command.bind_descriptor_sets.sets.data(),
+                            command.bind_descriptor_sets.num_offsets,
+                            command.bind_descriptor_sets.offsets.data());
+    break;
+  case DeferredCommandType::Draw:
+    vkCmdDraw(command_buffer, command.draw.count, 1, command.draw.first, 0);
+    break;
+  case DeferredCommandType::DrawIndexed:
+    vkCmdDrawIndexed(command_buffer, command.draw.count, 1, command.draw.first,
+                     static_cast<s32>(command.draw.base_vertex), 0);
+    break;
+  case DeferredCommandType::BeginQuery:
+    vkCmdBeginQuery(command_buffer, command.query.pool, command.query.query, command.query.flags);
+    break;
+  case DeferredCommandType::EndQuery:
+    vkCmdEndQuery(command_buffer, command.query.pool, command.query.query);
+    break;
+  case DeferredCommandType::ResetQueryPool:
+    vkCmdResetQueryPool(command_buffer, command.query.pool, command.query.query,
+                        command.query.count);
+    break;
+  }
+}
+
 void CommandBufferManager::DeferBufferViewDestruction(VkBufferView object)
 {
   CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
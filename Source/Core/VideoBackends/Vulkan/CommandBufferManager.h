@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <deque>
 #include <functional>
@@ -26,7 +27,7 @@ namespace Vulkan
 class CommandBufferManager
 {
 public:
-  explicit CommandBufferManager(bool use_threaded_submission);
+  CommandBufferManager(bool use_threaded_submission, bool use_record_thread);
   ~CommandBufferManager();
 
   bool Initialize();
@@ -35,12 +36,16 @@ public:
   // is submitted, after that you should call these functions again.
   VkCommandBuffer GetCurrentInitCommandBuffer()
   {
+    // Both command buffers share a pool, which can't be used by two threads at once.
+    WaitForRecordThreadIdle();
     CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
     cmd_buffer_resources.init_command_buffer_used = true;
     return cmd_buffer_resources.command_buffers[0];
   }
-  VkCommandBuffer GetCurrentCommandBuffer() const
+  VkCommandBuffer GetCurrentCommandBuffer()
   {
+    // Anything recorded directly has to come after the commands still queued for the record thread.
+    WaitForRecordThreadIdle();
     const CmdBufferResources& cmd_buffer_resources = m_command_buffers[m_current_cmd_buffer];
     return cmd_buffer_resources.command_buffers[1];
   }
@@ -73,6 +78,32 @@ public:
   // Ensure that the worker thread has submitted any previous command buffers and is idle.
   void WaitForWorkerThreadIdle();
 
+  // Ensure that the record thread has recorded all queued commands into the current command buffer.
+  void WaitForRecordThreadIdle()
+  {
+    if (m_use_record_thread)
+      m_record_loop.Wait();
+  }
+
+  // The commands for drawing are queued for the record thread when it is enabled, so the GPU
+  // thread can carry on with the next draw while they are recorded. Otherwise, they are recorded
+  // into the current command buffer immediately.
+  void RecordBeginRenderPass(VkRenderPass render_pass, VkFramebuffer framebuffer,
+                             const VkRect2D& render_area);
+  void RecordEndRenderPass();
+  void RecordBindVertexBuffer(VkBuffer buffer, VkDeviceSize offset);
+  void RecordBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType index_type);
+  void RecordBindPipeline(VkPipeline pipeline);
+  void RecordSetViewport(const VkViewport& viewport);
+  void RecordSetScissor(const VkRect2D& scissor);
+  void RecordBindDescriptorSets(VkPipelineLayout layout, u32 num_sets, const VkDescriptorSet* sets,
+                                u32 num_offsets, const u32* offsets);
+  void RecordDraw(u32 num_vertices, u32 base_vertex);
+  void RecordDrawIndexed(u32 num_indices, u32 base_index, u32 base_vertex);
+  void RecordBeginQuery(VkQueryPool pool, u32 query, VkQueryControlFlags flags);
+  void RecordEndQuery(VkQueryPool pool, u32 query);
+  void RecordResetQueryPool(VkQueryPool pool, u32 first_query, u32 query_count);
+
   // Wait for a fence to be completed.
   // Also invokes callbacks for completion.
   void WaitForFenceCounter(u64 fence_counter);
@@ -99,6 +130,7 @@ private:
   void DestroyCommandBuffers();
 
   bool CreateSubmitThread();
+  bool CreateRecordThread();
 
   void WaitForCommandBufferCompletion(u32 command_buffer_index);
   void SubmitCommandBuffer(u32 command_buffer_index, VkSwapchainKHR present_swap_chain,
@@ -159,7 +191,87 @@ private:
   Common::Flag m_last_present_done;
   VkResult m_last_present_result = VK_SUCCESS;
   bool m_use_threaded_submission = false;
+  bool m_use_record_thread = false;
   u32 m_descriptor_set_count = DESCRIPTOR_SETS_PER_POOL;
+
+  // Threaded draw command recording
+  enum class DeferredCommandType : u8
+  {
+    BeginRenderPass,
+    EndRenderPass,
+    BindVertexBuffer,
+    BindIndexBuffer,
+    BindPipeline,
+    SetViewport,
+    SetScissor,
+    BindDescriptorSets,
+    Draw,
+    DrawIndexed,
+    BeginQuery,
+    EndQuery,
+    ResetQueryPool,
+  };
+
+  static constexpr u32 MAX_DEFERRED_DESCRIPTOR_SETS = 3;
+
+  struct DeferredCommand
+  {
+    DeferredCommandType type;
+    union
+    {
+      struct
+      {
+        VkRenderPass render_pass;
+        VkFramebuffer framebuffer;
+        VkRect2D render_area;
+      } begin_render_pass;
+      struct
+      {
+        VkBuffer buffer;
+        VkDeviceSize offset;
+        VkIndexType index_type;
+      } bind_buffer;
+      VkPipeline pipeline;
+      VkViewport viewport;
+      VkRect2D scissor;
+      struct
+      {
+        VkPipelineLayout layout;
+        u32 num_sets;
+        u32 num_offsets;
+        std::array<VkDescriptorSet, MAX_DEFERRED_DESCRIPTOR_SETS> sets;
+        std::array<u32, NUM_UBO_DESCRIPTOR_SET_BINDINGS> offsets;
+      } bind_descriptor_sets;
+      struct
+      {
+        u32 count;
+        u32 first;
+        u32 base_vertex;
+      } draw;
+      struct
+      {
+        VkQueryPool pool;
+        u32 query;
+        u32 count;
+        VkQueryControlFlags flags;
+      } query;
+    };
+  };
+
+  // Must be a power of two, so the ring indices can wrap around
+  static constexpr u32 DEFERRED_COMMAND_RING_SIZE = 4096;
+
+  void QueueCommand(const DeferredCommand& command);
+  void RecordQueuedCommands();
+  static void ExecuteCommand(VkCommandBuffer command_buffer, const DeferredCommand& command);
+
+  // Written by the GPU thread and read by the record thread without locking.
+  // The indices only ever increase, and are wrapped when accessing the ring.
+  std::array<DeferredCommand, DEFERRED_COMMAND_RING_SIZE> m_deferred_commands;
+  std::atomic<u32> m_deferred_write_index{0};
+  std::atomic<u32> m_deferred_read_index{0};
+  Common::BlockingLoop m_record_loop;
+  std::thread m_record_thread;
 };
 
 extern std::unique_ptr<CommandBufferManager> g_command_buffer_mgr;
@@ -287,16 +287,8 @@ void StateTracker::BeginRenderPass()
   m_current_render_pass = m_framebuffer->GetLoadRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
 
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      0,
-                                      nullptr};
-
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  g_command_buffer_mgr->RecordBeginRenderPass(m_current_render_pass, m_framebuffer->GetFB(),
+                                              m_framebuffer_render_area);
 }
 
 void StateTracker::BeginDiscardRenderPass()
@@ -307,16 +299,8 @@ void StateTracker::BeginDiscardRenderPass()
   m_current_render_pass = m_framebuffer->GetDiscardRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
 
-  VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                      nullptr,
-                                      m_current_render_pass,
-                                      m_framebuffer->GetFB(),
-                                      m_framebuffer_render_area,
-                                      0,
-                                      nullptr};
-
-  vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
-                       VK_SUBPASS_CONTENTS_INLINE);
+  g_command_buffer_mgr->RecordBeginRenderPass(m_current_render_pass, m_framebuffer->GetFB(),
+                                              m_framebuffer_render_area);
 }
 
 void StateTracker::EndRenderPass()
@@ -324,7 +308,7 @@ void StateTracker::EndRenderPass()
   if (!InRenderPass())
     return;
 
-  vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
+  g_command_buffer_mgr->RecordEndRenderPass();
   m_current_render_pass = VK_NULL_HANDLE;
 }
 
@@ -384,26 +368,28 @@ bool StateTracker::Bind()
     BeginRenderPass();
 
   // Re-bind parts of the pipeline
-  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
   const bool needs_vertex_buffer = !g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader ||
                                    m_pipeline->GetUsage() != AbstractPipelineUsage::GXUber;
   if (needs_vertex_buffer && (m_dirty_flags & DIRTY_FLAG_VERTEX_BUFFER))
   {
-    vkCmdBindVertexBuffers(command_buffer, 0, 1, &m_vertex_buffer, &m_vertex_buffer_offset);
+    g_command_buffer_mgr->RecordBindVertexBuffer(m_vertex_buffer, m_vertex_buffer_offset);
     m_dirty_flags &= ~DIRTY_FLAG_VERTEX_BUFFER;
   }
 
   if (m_dirty_flags & DIRTY_FLAG_INDEX_BUFFER)
-    vkCmdBindIndexBuffer(command_buffer, m_index_buffer, m_index_buffer_offset, m_index_type);
+  {
+    g_command_buffer_mgr->RecordBindIndexBuffer(m_index_buffer, m_index_buffer_offset,
+                                                m_index_type);
+  }
 
   if (m_dirty_flags & DIRTY_FLAG_PIPELINE)
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipeline());
+    g_command_buffer_mgr->RecordBindPipeline(m_pipeline->GetVkPipeline());
 
   if (m_dirty_flags & DIRTY_FLAG_VIEWPORT)
-    vkCmdSetViewport(command_buffer, 0, 1, &m_viewport);
+    g_command_buffer_mgr->RecordSetViewport(m_viewport);
 
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
-    vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
+    g_command_buffer_mgr->RecordSetScissor(m_scissor);
 
   m_dirty_flags &=
       ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
@@ -567,20 +553,18 @@ void StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
-                            m_gx_descriptor_sets.data(),
-                            needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                           (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    g_command_buffer_mgr->RecordBindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(),
+        needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
+        m_gx_descriptor_sets.data(),
+        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
+        m_bindings.gx_ubo_offsets.data());
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
   }
   else if (m_dirty_flags & DIRTY_FLAG_GX_UBO_OFFSETS)
   {
-    vkCmdBindDescriptorSets(
-        g_command_buffer_mgr->GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
-        m_pipeline->GetVkPipelineLayout(), 0, 1, m_gx_descriptor_sets.data(),
+    g_command_buffer_mgr->RecordBindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), 1, m_gx_descriptor_sets.data(),
         needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
         m_bindings.gx_ubo_offsets.data());
     m_dirty_flags &= ~DIRTY_FLAG_GX_UBO_OFFSETS;
@@ -647,17 +631,16 @@ void StateTracker::UpdateUtilityDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+    g_command_buffer_mgr->RecordBindDescriptorSets(
+        m_pipeline->GetVkPipelineLayout(), NUM_UTILITY_DESCRIPTOR_SETS,
+        m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            1, m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
+    g_command_buffer_mgr->RecordBindDescriptorSets(m_pipeline->GetVkPipelineLayout(), 1,
+                                                   m_utility_descriptor_sets.data(), 1,
+                                                   &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
 }
@@ -68,8 +68,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
 
     // Ensure the query starts within a render pass.
     StateTracker::GetInstance()->BeginRenderPass();
-    vkCmdBeginQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos,
-                    flags);
+    g_command_buffer_mgr->RecordBeginQuery(m_query_pool, m_query_next_pos, flags);
   }
 }
 
@@ -77,7 +76,7 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 {
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
-    vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos);
+    g_command_buffer_mgr->RecordEndQuery(m_query_pool, m_query_next_pos);
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
     entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
 
@@ -96,8 +95,7 @@ void PerfQuery::ResetQuery()
 
   // Reset entire query pool, ensuring all queries are ready to write to.
   StateTracker::GetInstance()->EndRenderPass();
-  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, 0,
-                      PERF_QUERY_BUFFER_SIZE);
+  g_command_buffer_mgr->RecordResetQueryPool(m_query_pool, 0, PERF_QUERY_BUFFER_SIZE);
 
   std::memset(m_query_buffer.data(), 0, sizeof(ActiveQuery) * m_query_buffer.size());
 }
@@ -204,8 +202,7 @@ void PerfQuery::ReadbackQueries(u32 query_count)
     LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
 
   StateTracker::GetInstance()->EndRenderPass();
-  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
-                      m_query_readback_pos, query_count);
+  g_command_buffer_mgr->RecordResetQueryPool(m_query_pool, m_query_readback_pos, query_count);
 
   // Remove pending queries.
   for (u32 i = 0; i < query_count; i++)
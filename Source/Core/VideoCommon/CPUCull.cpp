@@ -3,6 +3,9 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <bit>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -53,10 +56,15 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) &&                      \
+    defined(__AVX512VL__) && defined(__FMA__)
+static constexpr int MIN_SSE = 60;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -73,7 +81,9 @@ template <bool PositionHas3Elems, bool PerVertexPosMtx>
 static CPUCull::TransformFunction GetTransformFunction()
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  if (MIN_SSE >= 60 || (cpu_info.bAVX512 && cpu_info.bFMA))
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -91,32 +101,33 @@ static CPUCull::TransformFunction GetTransformFunction()
 }
 
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
-static CPUCull::CullFunction GetCullFunction0()
+static CPUCull::VisibleTrianglesFunction GetVisibleTrianglesFunction0()
 {
 #if defined(USE_SSE)
-  // Note: AVX version only actually AVX on compilers that support __attribute__((target))
-  // Sorry, MSVC + Sandy Bridge.  (Ivy+ and AMD see very little benefit thanks to mov elimination)
-  if (MIN_SSE >= 50 || cpu_info.bAVX)
-    return CPUCull_AVX::AreAllVerticesCulled<Primitive, Mode>;
+  if (MIN_SSE >= 60 || cpu_info.bAVX512)
+    return CPUCull_AVX512::GetVisibleTriangles<Primitive, Mode>;
+  else if (MIN_SSE >= 50 || cpu_info.bAVX)
+    return CPUCull_AVX::GetVisibleTriangles<Primitive, Mode>;
   else if (MIN_SSE >= 30 || cpu_info.bSSE3)
-    return CPUCull_SSE3::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE3::GetVisibleTriangles<Primitive, Mode>;
   else
-    return CPUCull_SSE::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE::GetVisibleTriangles<Primitive, Mode>;
 #elif defined(USE_NEON)
-  return CPUCull_NEON::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_NEON::GetVisibleTriangles<Primitive, Mode>;
 #else
-  return CPUCull_Scalar::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_Scalar::GetVisibleTriangles<Primitive, Mode>;
 #endif
 }
 
 template <OpcodeDecoder::Primitive Primitive>
-static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
+static Common::EnumMap<CPUCull::VisibleTrianglesFunction, CullMode::All>
+GetVisibleTrianglesFunction1()
 {
   return {
-      GetCullFunction0<Primitive, CullMode::None>(),
-      GetCullFunction0<Primitive, CullMode::Back>(),
-      GetCullFunction0<Primitive, CullMode::Front>(),
-      GetCullFunction0<Primitive, CullMode::All>(),
+      GetVisibleTrianglesFunction0<Primitive, CullMode::None>(),
+      GetVisibleTrianglesFunction0<Primitive, CullMode::Back>(),
+      GetVisibleTrianglesFunction0<Primitive, CullMode::Front>(),
+      GetVisibleTrianglesFunction0<Primitive, CullMode::All>(),
   };
 }
 
@@ -129,18 +140,20 @@ void CPUCull::Init()
   m_transform_table[true][false] = GetTransformFunction<true, false>();
   m_transform_table[true][true] = GetTransformFunction<true, true>();
   using Prim = OpcodeDecoder::Primitive;
-  m_cull_table[Prim::GX_DRAW_QUADS] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
-  m_cull_table[Prim::GX_DRAW_QUADS_2] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
-  m_cull_table[Prim::GX_DRAW_TRIANGLES] = GetCullFunction1<Prim::GX_DRAW_TRIANGLES>();
-  m_cull_table[Prim::GX_DRAW_TRIANGLE_STRIP] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
-  m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
+  m_visible_triangles_table[Prim::GX_DRAW_QUADS] =
+      GetVisibleTrianglesFunction1<Prim::GX_DRAW_QUADS>();
+  m_visible_triangles_table[Prim::GX_DRAW_QUADS_2] =
+      GetVisibleTrianglesFunction1<Prim::GX_DRAW_QUADS>();
+  m_visible_triangles_table[Prim::GX_DRAW_TRIANGLES] =
+      GetVisibleTrianglesFunction1<Prim::GX_DRAW_TRIANGLES>();
+  m_visible_triangles_table[Prim::GX_DRAW_TRIANGLE_STRIP] =
+      GetVisibleTrianglesFunction1<Prim::GX_DRAW_TRIANGLE_STRIP>();
+  m_visible_triangles_table[Prim::GX_DRAW_TRIANGLE_FAN] =
+      GetVisibleTrianglesFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
-bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                                   const u8* src, u32 count)
+CullMode CPUCull::TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count)
 {
-  ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
-             "CPUCull should not be called on lines or points");
   const u32 stride = loader->m_native_vtx_decl.stride;
   const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
   const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
@@ -149,7 +162,7 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     u32 new_size = MathUtil::NextPowerOf2(count);
     m_transform_buffer_size = new_size;
     m_transform_buffer.reset(static_cast<TransformedVertex*>(
-        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
+        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 64)));
   }
 
   // transform functions need the projection matrix to tranform to clip space
@@ -163,8 +176,27 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+  return cullmode;
+}
+
+u32 CPUCull::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                           const u8* src, u32 count)
+{
+  ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
+             "CPUCull should not be called on lines or points");
+  const CullMode cullmode = TransformVertices(loader, src, count);
+  return CullTransformedTriangles(primitive, cullmode, m_transform_buffer.get(), count);
+}
+
+u32 CPUCull::CullTransformedTriangles(OpcodeDecoder::Primitive primitive, CullMode cullmode,
+                                      const TransformedVertex* transformed, u32 count)
+{
+  // No primitive has more triangles than vertices
+  if (m_visible_triangles.size() < count * 3) [[unlikely]]
+    m_visible_triangles.resize(MathUtil::NextPowerOf2(count) * 3);
+
+  const VisibleTrianglesFunction cull = m_visible_triangles_table[primitive][cullmode];
+  return cull(transformed, count, m_visible_triangles.data());
 }
 
 template <typename T>
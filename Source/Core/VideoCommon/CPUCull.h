@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -12,18 +14,27 @@ class CPUCull
 public:
   ~CPUCull();
   void Init();
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  // Culls each triangle of the primitive individually, and returns the number of triangles that
+  // survived. Their vertex indices, relative to src, can be read from GetVisibleTriangles().
+  u32 CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                    u32 count);
+  const u16* GetVisibleTriangles() const { return m_visible_triangles.data(); }
 
   struct alignas(16) TransformedVertex
   {
     float x, y, z, w;
   };
 
+  // Like CullTriangles, but for vertices that are already in clip space.
+  u32 CullTransformedTriangles(OpcodeDecoder::Primitive primitive, CullMode cullmode,
+                               const TransformedVertex* transformed, u32 count);
+
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using VisibleTrianglesFunction = u32 (*)(const CPUCull::TransformedVertex*, int, u16*);
 
 private:
+  CullMode TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count);
+
   template <typename T>
   struct BufferDeleter
   {
@@ -32,7 +43,8 @@ private:
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
-  Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
+  Common::EnumMap<Common::EnumMap<VisibleTrianglesFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
-      m_cull_table{};
+      m_visible_triangles_table{};
+  std::vector<u16> m_visible_triangles;
 };
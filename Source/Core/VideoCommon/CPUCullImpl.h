@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,11 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) &&                                                   \
+    !(defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) &&                    \
+      defined(__AVX512VL__) && defined(__FMA__))
+#define ATTR_TARGET __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -236,6 +242,129 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+}
+
+// Copies the 128-bit lane of a YMM register that was loaded with a broadcast to all four lanes
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 BroadcastZMM(__m256 v)
+{
+  return _mm512_broadcast_f32x4(_mm256_castps256_ps128(v));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 Combine4(Vector v0, Vector v1, Vector v2, Vector v3)
+{
+  __m512 output = _mm512_castps128_ps512(v0);
+  output = _mm512_insertf32x4(output, v1, 1);
+  output = _mm512_insertf32x4(output, v2, 2);
+  return _mm512_insertf32x4(output, v3, 3);
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(vector_broadcast<0>(v), m0);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), m1, output);
+  output = _mm512_fmadd_ps(vector_broadcast<2>(v), m2, output);
+  output = _mm512_fmadd_ps(vector_broadcast<3>(v), m3, output);
+  return output;
+}
+
+// Adds adjacent pairs like _mm_hadd_ps does for each 128-bit lane, which has no 512-bit version
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 HorizontalAddZMM(__m512 a, __m512 b)
+{
+  return _mm512_add_ps(_mm512_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm512_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+TransformVertexNoTransposeZMM(__m512 vertex, __m512 pos0, __m512 pos1, __m512 pos2,  //
+                              __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 mul0 = _mm512_mul_ps(vertex, pos0);
+  __m512 mul1 = _mm512_mul_ps(vertex, pos1);
+  __m512 mul2 = _mm512_mul_ps(vertex, pos2);
+  __m512 mul3 = BroadcastZMM(_mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+  __m512 output = HorizontalAddZMM(HorizontalAddZMM(mul0, mul1), HorizontalAddZMM(mul2, mul3));
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+TransformVertexZMM(__m512 vertex, __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                   __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(vector_broadcast<0>(vertex), pos0, output);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(vertex), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(vector_broadcast<2>(vertex), pos2, output);
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static Vector LoadPosition(const u8* data)
+{
+  if constexpr (PositionHas3Elems)
+    return _mm_loadu_ps(reinterpret_cast<const float*>(data));
+  else
+    return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
+}
+
+template <bool PositionHas3Elems, bool PerVertexPosMtx>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  const u8* v0data = data;
+  const u8* v1data = data + stride;
+  const u8* v2data = data + stride * 2;
+  const u8* v3data = data + stride * 3;
+  __m512 v0123;
+  if constexpr (PerVertexPosMtx)
+  {
+    // Vertex data layout always starts with posmtx data if available, then position data
+    const Vector* m0 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v0data[0] & 0x3f) * 4]);
+    const Vector* m1 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v1data[0] & 0x3f) * 4]);
+    const Vector* m2 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v2data[0] & 0x3f) * 4]);
+    const Vector* m3 = reinterpret_cast<const Vector*>(&xfmem.posMatrices[(v3data[0] & 0x3f) * 4]);
+    pos0 = Combine4(m0[0], m1[0], m2[0], m3[0]);
+    pos1 = Combine4(m0[1], m1[1], m2[1], m3[1]);
+    pos2 = Combine4(m0[2], m1[2], m2[2], m3[2]);
+
+    // The position of two element vertices is loaded with a zero z
+    v0123 = Combine4(LoadPosition<PositionHas3Elems>(v0data + sizeof(u32)),
+                     LoadPosition<PositionHas3Elems>(v1data + sizeof(u32)),
+                     LoadPosition<PositionHas3Elems>(v2data + sizeof(u32)),
+                     LoadPosition<PositionHas3Elems>(v3data + sizeof(u32)));
+    v0123 = _mm512_mask_blend_ps(0x8888, v0123, _mm512_set1_ps(1.0f));
+
+    v0123 = TransformVertexNoTransposeZMM(v0123, pos0, pos1, pos2, proj0, proj1, proj2, proj3);
+  }
+  else
+  {
+    v0123 = Combine4(LoadPosition<PositionHas3Elems>(v0data),
+                     LoadPosition<PositionHas3Elems>(v1data),
+                     LoadPosition<PositionHas3Elems>(v2data),
+                     LoadPosition<PositionHas3Elems>(v3data));
+
+#ifdef __clang__
+    // See LoadTransform2Vertices
+    asm("" : "+v"(v0123)::);
+#endif
+
+    v0123 = TransformVertexZMM<PositionHas3Elems>(v0123, pos0, pos1, pos2, pos3,  //
+                                                  proj0, proj1, proj2, proj3);
+  }
+
+  return v0123;
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -517,6 +646,22 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+#ifdef USE_AVX512
+  {
+    const __m512 proj0z = BroadcastZMM(proj0), proj1z = BroadcastZMM(proj1);
+    const __m512 proj2z = BroadcastZMM(proj2), proj3z = BroadcastZMM(proj3);
+    const __m512 pos0z = BroadcastZMM(pos0), pos1z = BroadcastZMM(pos1);
+    const __m512 pos2z = BroadcastZMM(pos2), pos3z = BroadcastZMM(pos3);
+    for (; count >= 4; count -= 4)
+    {
+      __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems, PerVertexPosMtx>(
+          cvertices, stride, pos0z, pos1z, pos2z, pos3z, proj0z, proj1z, proj2z, proj3z);
+      _mm512_store_ps(reinterpret_cast<float*>(voutput), v0123);
+      cvertices += stride * 4;
+      voutput += 4;
+    }
+  }
+#endif
   for (int i = 1; i < count; i += 2)
   {
     const u8* v0data = cvertices;
@@ -551,6 +696,183 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
 #endif
 }
 
+#ifdef USE_AVX512
+// Gets the vertex indices of 16 consecutive triangles, in the order and winding that
+// IndexGenerator uses
+template <OpcodeDecoder::Primitive Primitive>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void TriangleIndices(__m512i triangle, __m512i& a,
+                                                             __m512i& b, __m512i& c)
+{
+  const __m512i one = _mm512_set1_epi32(1);
+  switch (Primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+  {
+    // Every quad is split into (0, 1, 2) and (0, 2, 3)
+    const __m512i second_half = _mm512_and_si512(triangle, one);
+    a = _mm512_slli_epi32(_mm512_srli_epi32(triangle, 1), 2);
+    b = _mm512_add_epi32(_mm512_add_epi32(a, one), second_half);
+    c = _mm512_add_epi32(b, one);
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    a = _mm512_mullo_epi32(triangle, _mm512_set1_epi32(3));
+    b = _mm512_add_epi32(a, one);
+    c = _mm512_add_epi32(b, one);
+    break;
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  {
+    // Every other triangle has its last two vertices swapped
+    const __m512i wind = _mm512_and_si512(triangle, one);
+    a = triangle;
+    b = _mm512_add_epi32(_mm512_add_epi32(triangle, one), wind);
+    c = _mm512_sub_epi32(_mm512_add_epi32(triangle, _mm512_set1_epi32(2)), wind);
+    break;
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+    a = _mm512_setzero_si512();
+    b = _mm512_add_epi32(triangle, one);
+    c = _mm512_add_epi32(b, one);
+    break;
+  }
+}
+
+template <OpcodeDecoder::Primitive Primitive>
+static int TriangleCount(int count)
+{
+  switch (Primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+    // three vertices remaining, so render a triangle
+    return count / 4 * 2 + (count % 4 == 3);
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    return count / 3;
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+    return std::max(count - 2, 0);
+  }
+  return 0;
+}
+
+// Tests 16 triangles at once. The vertices are gathered component by component, so the math is
+// the same as in the scalar version of CullTriangle, just with each triangle in its own lane.
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+ATTR_TARGET static u32 GetVisibleTriangles(const CPUCull::TransformedVertex* transformed,
+                                           int count, u16* triangles)
+{
+  if (Mode == CullMode::All)
+    return 0;
+
+  // GCC doesn't honor FP_CONTRACT OFF, and this namespace is compiled with FMA enabled. The
+  // explicit rounding variants are never fused, which keeps degenerate triangles at exactly zero.
+  constexpr int rounding = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+  const float* base = &transformed[0].x;
+  const __m512i sign = _mm512_set1_epi32(0x80000000);
+  const int triangle_count = TriangleCount<Primitive>(count);
+  u16* out = triangles;
+  for (int first = 0; first < triangle_count; first += 16)
+  {
+    const int remaining = triangle_count - first;
+    const __mmask16 valid = remaining >= 16 ? 0xFFFF : static_cast<__mmask16>((1 << remaining) - 1);
+    const __m512i triangle = _mm512_add_epi32(
+        _mm512_set1_epi32(first),
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    __m512i a, b, c;
+    TriangleIndices<Primitive>(triangle, a, b, c);
+
+    // Indices of the x component of each vertex, in floats
+    a = _mm512_slli_epi32(a, 2);
+    b = _mm512_slli_epi32(b, 2);
+    c = _mm512_slli_epi32(c, 2);
+    const __m512i y = _mm512_set1_epi32(1);
+    const __m512i w = _mm512_set1_epi32(3);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 ax = _mm512_mask_i32gather_ps(zero, valid, a, base, 4);
+    const __m512 ay = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(a, y), base, 4);
+    const __m512 aw = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(a, w), base, 4);
+    const __m512 bx = _mm512_mask_i32gather_ps(zero, valid, b, base, 4);
+    const __m512 by = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(b, y), base, 4);
+    const __m512 bw = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(b, w), base, 4);
+    const __m512 cx = _mm512_mask_i32gather_ps(zero, valid, c, base, 4);
+    const __m512 cy = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(c, y), base, 4);
+    const __m512 cw = _mm512_mask_i32gather_ps(zero, valid, _mm512_add_epi32(c, w), base, 4);
+
+    // See videosoftware Clipper.cpp
+    const __m512 part0 = _mm512_mul_round_ps(
+        _mm512_sub_round_ps(_mm512_mul_round_ps(ax, cw, rounding),
+                            _mm512_mul_round_ps(cx, aw, rounding), rounding),
+        by, rounding);
+    const __m512 part1 = _mm512_mul_round_ps(
+        _mm512_sub_round_ps(_mm512_mul_round_ps(ay, cx, rounding),
+                            _mm512_mul_round_ps(cy, ax, rounding), rounding),
+        bw, rounding);
+    const __m512 part2 = _mm512_mul_round_ps(
+        _mm512_sub_round_ps(_mm512_mul_round_ps(aw, cy, rounding),
+                            _mm512_mul_round_ps(cw, ay, rounding), rounding),
+        bx, rounding);
+    const __m512 normal_z_dir =
+        _mm512_add_round_ps(_mm512_add_round_ps(part0, part1, rounding), part2, rounding);
+
+    __mmask16 cull = 0;
+    switch (Mode)
+    {
+    case CullMode::None:
+      cull = _mm512_cmp_ps_mask(normal_z_dir, zero, _CMP_EQ_OQ);
+      break;
+    case CullMode::Front:
+      cull = _mm512_cmp_ps_mask(normal_z_dir, zero, _CMP_LE_OQ);
+      break;
+    case CullMode::Back:
+      cull = _mm512_cmp_ps_mask(normal_z_dir, zero, _CMP_GE_OQ);
+      break;
+    case CullMode::All:
+      break;
+    }
+
+    // Like the SSE version, a vertex exactly on the positive edge counts as outside
+    const __m512 anw = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(aw), sign));
+    const __m512 bnw = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(bw), sign));
+    const __m512 cnw = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(cw), sign));
+    __mmask16 x_lt_nw = _mm512_cmp_ps_mask(ax, anw, _CMP_LT_OQ);
+    x_lt_nw = _mm512_mask_cmp_ps_mask(x_lt_nw, bx, bnw, _CMP_LT_OQ);
+    x_lt_nw = _mm512_mask_cmp_ps_mask(x_lt_nw, cx, cnw, _CMP_LT_OQ);
+    __mmask16 y_lt_nw = _mm512_cmp_ps_mask(ay, anw, _CMP_LT_OQ);
+    y_lt_nw = _mm512_mask_cmp_ps_mask(y_lt_nw, by, bnw, _CMP_LT_OQ);
+    y_lt_nw = _mm512_mask_cmp_ps_mask(y_lt_nw, cy, cnw, _CMP_LT_OQ);
+    __mmask16 x_gt_pw = _mm512_cmp_ps_mask(aw, ax, _CMP_LE_OQ);
+    x_gt_pw = _mm512_mask_cmp_ps_mask(x_gt_pw, bw, bx, _CMP_LE_OQ);
+    x_gt_pw = _mm512_mask_cmp_ps_mask(x_gt_pw, cw, cx, _CMP_LE_OQ);
+    __mmask16 y_gt_pw = _mm512_cmp_ps_mask(aw, ay, _CMP_LE_OQ);
+    y_gt_pw = _mm512_mask_cmp_ps_mask(y_gt_pw, bw, by, _CMP_LE_OQ);
+    y_gt_pw = _mm512_mask_cmp_ps_mask(y_gt_pw, cw, cy, _CMP_LE_OQ);
+    cull |= x_lt_nw | y_lt_nw | x_gt_pw | y_gt_pw;
+
+    u32 visible = valid & ~cull;
+    if (visible == 0)
+      continue;
+
+    alignas(64) u32 indices_a[16];
+    alignas(64) u32 indices_b[16];
+    alignas(64) u32 indices_c[16];
+    _mm512_store_si512(indices_a, _mm512_srli_epi32(a, 2));
+    _mm512_store_si512(indices_b, _mm512_srli_epi32(b, 2));
+    _mm512_store_si512(indices_c, _mm512_srli_epi32(c, 2));
+    while (visible != 0)
+    {
+      const int i = std::countr_zero(visible);
+      visible &= visible - 1;
+      out[0] = static_cast<u16>(indices_a[i]);
+      out[1] = static_cast<u16>(indices_b[i]);
+      out[2] = static_cast<u16>(indices_c[i]);
+      out += 3;
+    }
+  }
+
+  return static_cast<u32>(out - triangles) / 3;
+}
+#else
 template <CullMode Mode>
 ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::TransformedVertex& a,
                                                           const CPUCull::TransformedVertex& b,
@@ -653,10 +975,24 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u16*
+AddTriangleIfVisible(const CPUCull::TransformedVertex* transformed, int a, int b, int c, u16* out)
+{
+  if (CullTriangle<Mode>(transformed[a], transformed[b], transformed[c]))
+    return out;
+  out[0] = static_cast<u16>(a);
+  out[1] = static_cast<u16>(b);
+  out[2] = static_cast<u16>(c);
+  return out + 3;
+}
+
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
-ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+ATTR_TARGET static u32 GetVisibleTriangles(const CPUCull::TransformedVertex* transformed,
+                                           int count, u16* triangles)
 {
+  // Triangles are written in the same order and winding that IndexGenerator uses
+  u16* out = triangles;
   switch (Primitive)
   {
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
@@ -665,48 +1001,37 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     int i = 3;
     for (; i < count; i += 4)
     {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 1], transformed[i - 0]))
-        return false;
+      out = AddTriangleIfVisible<Mode>(transformed, i - 3, i - 2, i - 1, out);
+      out = AddTriangleIfVisible<Mode>(transformed, i - 3, i - 1, i - 0, out);
     }
     // three vertices remaining, so render a triangle
     if (i == count)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-    }
+      out = AddTriangleIfVisible<Mode>(transformed, i - 3, i - 2, i - 1, out);
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
     for (int i = 2; i < count; i += 3)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - 1], transformed[i - 0]))
-        return false;
-    }
+      out = AddTriangleIfVisible<Mode>(transformed, i - 2, i - 1, i - 0, out);
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
   {
     bool wind = false;
     for (int i = 2; i < count; ++i)
     {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
-        return false;
+      out = AddTriangleIfVisible<Mode>(transformed, i - 2, i - !wind, i - wind, out);
       wind = !wind;
     }
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
     for (int i = 2; i < count; ++i)
-    {
-      if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
-        return false;
-    }
+      out = AddTriangleIfVisible<Mode>(transformed, 0, i - 1, i, out);
     break;
   }
 
-  return true;
+  return static_cast<u32>(out - triangles) / 3;
 }
+#endif
 
 }  // namespace VECTOR_NAMESPACE
 
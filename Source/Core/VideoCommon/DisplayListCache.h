@@ -0,0 +1,266 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
+
+namespace OpcodeDecoder
+{
+// Remembers the decoded commands of display lists, so that a display list which is called again
+// with the same contents can be replayed through the callback without parsing it again.
+// Display lists can't be fully precompiled, since the size of a vertex depends on the vertex format
+// at the time of the call. Every primitive command therefore checks that the vertex size still
+// matches, and the rest of the list is parsed normally if it doesn't.
+// Lists are identified by their address and size. Before a list is replayed, the bytes that the
+// recorded commands were decoded from are compared with the current ones. Vertex and XF payloads
+// are skipped, since they are passed to the callback from the current list anyway, and they are
+// usually most of the list.
+class DisplayListCache
+{
+public:
+  // Display lists smaller than this are cheaper to parse than to look up
+  static constexpr u32 MIN_CACHED_SIZE = 128;
+  static constexpr size_t MAX_ENTRIES = 4096;
+
+  template <typename T>
+  void Run(u32 address, const u8* data, u32 size, T& callback)
+  {
+    if (size < MIN_CACHED_SIZE)
+    {
+      OpcodeDecoder::Run(data, size, callback);
+      return;
+    }
+
+    const u64 key = (static_cast<u64>(address) << 32) | size;
+    if (auto iter = m_entries.find(key); iter != m_entries.end() && Matches(iter->second, data))
+    {
+      Replay(iter->second.commands, data, size, callback);
+      INCSTAT(g_stats.this_frame.num_dlists_replayed);
+      return;
+    }
+
+    if (m_entries.size() >= MAX_ENTRIES)
+      m_entries.clear();
+
+    Entry& entry = m_entries[key];
+    entry.commands.clear();
+    entry.spans.clear();
+    RecordingCallback<T> recorder(callback, entry, data);
+    const u32 parsed_size = OpcodeDecoder::Run(data, size, recorder);
+
+    // A change to an incomplete command at the end could turn it into a complete one
+    AddSpan(entry, parsed_size, size - parsed_size);
+
+    entry.bytes.clear();
+    for (const Span& span : entry.spans)
+      entry.bytes.insert(entry.bytes.end(), data + span.offset, data + span.offset + span.size);
+  }
+
+  void Clear() { m_entries.clear(); }
+
+private:
+  enum class CommandType : u8
+  {
+    Nop,
+    CP,
+    XF,
+    BP,
+    IndexedLoad,
+    Primitive,
+    DisplayList,
+    Unknown,
+  };
+
+  struct Command
+  {
+    CommandType type;
+    // CP/BP command, XF count, indexed load size, vertex attribute table or opcode
+    u8 arg8;
+    // XF or indexed load address, or the number of vertices
+    u16 arg16;
+    // CP/BP value, indexed load index, vertex size, display list address or number of nops
+    u32 value;
+    // Primitive, array or display list size
+    u32 extra;
+    // Position and size of the whole command in the display list
+    u32 offset;
+    u32 size;
+  };
+
+  // A range of the display list that the recorded commands depend on
+  struct Span
+  {
+    u32 offset;
+    u32 size;
+  };
+
+  struct Entry
+  {
+    std::vector<Command> commands;
+    std::vector<Span> spans;
+    // The contents of all spans, one after another
+    std::vector<u8> bytes;
+  };
+
+  static void AddSpan(Entry& entry, u32 offset, u32 size)
+  {
+    if (size == 0)
+      return;
+
+    if (!entry.spans.empty() && entry.spans.back().offset + entry.spans.back().size == offset)
+      entry.spans.back().size += size;
+    else
+      entry.spans.push_back({offset, size});
+  }
+
+  static bool Matches(const Entry& entry, const u8* data)
+  {
+    const u8* bytes = entry.bytes.data();
+    for (const Span& span : entry.spans)
+    {
+      if (std::memcmp(data + span.offset, bytes, span.size) != 0)
+        return false;
+      bytes += span.size;
+    }
+    return true;
+  }
+
+  // Forwards every command to the wrapped callback, and records it.
+  template <typename T>
+  class RecordingCallback final : public Callback
+  {
+  public:
+    RecordingCallback(T& callback, Entry& entry, const u8* start)
+        : m_callback(callback), m_entry(entry), m_start(start)
+    {
+    }
+
+    OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+    {
+      Add(CommandType::XF, count, address, 0, 0);
+      m_callback.OnXF(address, count, data);
+    }
+    OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+    {
+      Add(CommandType::CP, command, 0, value, 0);
+      m_callback.OnCP(command, value);
+    }
+    OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+    {
+      Add(CommandType::BP, command, 0, value, 0);
+      m_callback.OnBP(command, value);
+    }
+    OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+    {
+      Add(CommandType::IndexedLoad, size, address, index, static_cast<u32>(array));
+      m_callback.OnIndexedLoad(array, index, address, size);
+    }
+    OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                            u32 vertex_size, u16 num_vertices,
+                                            const u8* vertex_data))
+    {
+      Add(CommandType::Primitive, vat, num_vertices, vertex_size, static_cast<u32>(primitive));
+      m_callback.OnPrimitiveCommand(primitive, vat, vertex_size, num_vertices, vertex_data);
+    }
+    OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+    {
+      Add(CommandType::DisplayList, 0, 0, address, size);
+      m_callback.OnDisplayList(address, size);
+    }
+    OPCODE_CALLBACK(void OnNop(u32 count))
+    {
+      Add(CommandType::Nop, 0, 0, count, 0);
+      m_callback.OnNop(count);
+    }
+    OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+    {
+      Add(CommandType::Unknown, opcode, 0, 0, 0);
+      m_callback.OnUnknown(opcode, data);
+    }
+    OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size))
+    {
+      Command& command = m_entry.commands.back();
+      command.offset = static_cast<u32>(data - m_start);
+      command.size = size;
+
+      // Only the header of primitives and XF writes is decoded, the rest is passed through
+      u32 decoded_size = size;
+      if (command.type == CommandType::Primitive)
+        decoded_size = 3;
+      else if (command.type == CommandType::XF)
+        decoded_size = 5;
+      AddSpan(m_entry, command.offset, std::min(decoded_size, size));
+
+      m_callback.OnCommand(data, size);
+    }
+    OPCODE_CALLBACK(CPState& GetCPState()) { return m_callback.GetCPState(); }
+    OPCODE_CALLBACK(u32 GetVertexSize(u8 vat)) { return m_callback.GetVertexSize(vat); }
+
+  private:
+    void Add(CommandType type, u8 arg8, u16 arg16, u32 value, u32 extra)
+    {
+      m_entry.commands.push_back({type, arg8, arg16, value, extra, 0, 0});
+    }
+
+    T& m_callback;
+    Entry& m_entry;
+    const u8* m_start;
+  };
+
+  template <typename T>
+  static void Replay(const std::vector<Command>& commands, const u8* data, u32 size, T& callback)
+  {
+    for (const Command& command : commands)
+    {
+      const u8* command_data = data + command.offset;
+      switch (command.type)
+      {
+      case CommandType::Nop:
+        callback.OnNop(command.value);
+        break;
+      case CommandType::CP:
+        callback.OnCP(command.arg8, command.value);
+        break;
+      case CommandType::XF:
+        callback.OnXF(command.arg16, command.arg8, command_data + 5);
+        break;
+      case CommandType::BP:
+        callback.OnBP(command.arg8, command.value);
+        break;
+      case CommandType::IndexedLoad:
+        callback.OnIndexedLoad(static_cast<CPArray>(command.extra), command.value, command.arg16,
+                               command.arg8);
+        break;
+      case CommandType::Primitive:
+        // The vertex format may have changed since the display list was recorded, in which case
+        // the remaining commands are somewhere else
+        if (callback.GetVertexSize(command.arg8) != command.value)
+        {
+          OpcodeDecoder::Run(command_data, size - command.offset, callback);
+          return;
+        }
+        callback.OnPrimitiveCommand(static_cast<OpcodeDecoder::Primitive>(command.extra),
+                                    command.arg8, command.value, command.arg16, command_data + 3);
+        break;
+      case CommandType::DisplayList:
+        callback.OnDisplayList(command.value, command.extra);
+        break;
+      case CommandType::Unknown:
+        callback.OnUnknown(command.arg8, command_data);
+        break;
+      }
+      callback.OnCommand(command_data, command.size);
+    }
+  }
+
+  std::unordered_map<u64, Entry> m_entries;
+};
+}  // namespace OpcodeDecoder
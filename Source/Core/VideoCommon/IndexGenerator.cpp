@@ -266,7 +266,8 @@ void IndexGenerator::Init()
 {
   using OpcodeDecoder::Primitive;
 
-  if (g_Config.backend_info.bSupportsPrimitiveRestart)
+  m_primitive_restart = g_Config.backend_info.bSupportsPrimitiveRestart;
+  if (m_primitive_restart)
   {
     m_primitive_table[Primitive::GX_DRAW_QUADS] = AddQuads<true>;
     m_primitive_table[Primitive::GX_DRAW_QUADS_2] = AddQuads_nonstandard<true>;
@@ -326,6 +327,36 @@ void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddTriangles(OpcodeDecoder::Primitive primitive, const u16* triangles,
+                                  u32 num_triangles, u32 num_vertices)
+{
+  // Without primitive restart, the triangles are a subset of what AddIndices would write. With it,
+  // every triangle takes four indices, and AddIndices reserves at least one index per vertex.
+  if (m_primitive_restart && num_triangles * 4 > num_vertices)
+  {
+    AddIndices(primitive, num_vertices);
+    return;
+  }
+
+  u16* index_ptr = m_index_buffer_current;
+  const u32 index = m_base_index;
+  for (u32 i = 0; i < num_triangles; i++, triangles += 3)
+  {
+    if (m_primitive_restart)
+    {
+      index_ptr = WriteTriangle<true>(index_ptr, index + triangles[0], index + triangles[1],
+                                      index + triangles[2]);
+    }
+    else
+    {
+      index_ptr = WriteTriangle<false>(index_ptr, index + triangles[0], index + triangles[1],
+                                       index + triangles[2]);
+    }
+  }
+  m_index_buffer_current = index_ptr;
+  m_base_index += num_vertices;
+}
+
 u32 IndexGenerator::GetRemainingIndices(OpcodeDecoder::Primitive primitive) const
 {
   u32 max_index = UINT16_MAX;
@@ -20,6 +20,12 @@ public:
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
+  // Adds a subset of the triangles of a primitive, given as triples of vertex indices relative to
+  // the first vertex of the primitive. Falls back to AddIndices if the triangles would need more
+  // index space than the whole primitive.
+  void AddTriangles(OpcodeDecoder::Primitive primitive, const u16* triangles, u32 num_triangles,
+                    u32 num_vertices);
+
   // returns numprimitives
   u32 GetNumVerts() const { return m_base_index; }
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
@@ -29,6 +35,7 @@ private:
   u16* m_index_buffer_current = nullptr;
   u16* m_base_index_ptr = nullptr;
   u32 m_base_index = 0;
+  bool m_primitive_restart = false;
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
@@ -23,11 +23,13 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStructs.h"
 
@@ -35,6 +37,9 @@ namespace OpcodeDecoder
 {
 bool g_record_fifo_data = false;
 
+// Only used by the GPU thread
+static DisplayListCache s_display_list_cache;
+
 template <bool is_preprocess>
 class RunCallback final : public Callback
 {
@@ -188,7 +193,10 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
-          Run(start_address, size, *this);
+          if (g_ActiveConfig.bDisplayListCache)
+            s_display_list_cache.Run(address, start_address, size, *this);
+          else
+            Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
           // un-swap
@@ -257,6 +265,11 @@ public:
   bool m_in_display_list = false;
 };
 
+void ClearDisplayListCache()
+{
+  s_display_list_cache.Clear();
+}
+
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
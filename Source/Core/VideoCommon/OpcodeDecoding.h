@@ -276,6 +276,9 @@ DOLPHIN_FORCE_INLINE u32 Run(const u8* data, u32 available, T& callback)
 template <bool is_preprocess = false>
 u8* RunFifo(DataReader src, u32* cycles);
 
+// Frees the decoded display lists, which are only valid for the game that is running
+void ClearDisplayListCache();
+
 }  // namespace OpcodeDecoder
 
 template <>
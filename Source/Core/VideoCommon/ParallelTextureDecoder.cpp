@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/ParallelTextureDecoder.h"
+
+#include <algorithm>
+#include <thread>
+
+// More threads than this rarely help, since decoding quickly becomes limited by memory bandwidth
+static constexpr u32 MAX_THREADS = 8;
+
+static u32 GetDecoderThreadCount(u32 thread_count)
+{
+  if (thread_count == 0)
+  {
+    // Leave a core for the emulated CPU. The calling thread is one of the decoding threads.
+    thread_count = static_cast<u32>(std::max(std::thread::hardware_concurrency(), 2u)) - 1;
+  }
+  return std::clamp<u32>(thread_count, 1, MAX_THREADS);
+}
+
+ParallelTextureDecoder::ParallelTextureDecoder(u32 thread_count)
+    : m_thread_pool(GetDecoderThreadCount(thread_count), "Texture Decoder")
+{
+}
+
+void ParallelTextureDecoder::AddLevel(u8* dst, const u8* src, u32 width, u32 height,
+                                      TextureFormat format, const u8* tlut, TLUTFormat tlut_format)
+{
+  m_levels.push_back({dst, src, width, height, format, tlut, tlut_format});
+}
+
+void ParallelTextureDecoder::Decode()
+{
+  u32 total_texels = 0;
+  for (const Level& level : m_levels)
+    total_texels += level.width * level.height;
+
+  if (m_thread_pool.GetThreadCount() == 1 || total_texels < MIN_PARALLEL_TEXELS)
+  {
+    for (const Level& level : m_levels)
+    {
+      TexDecoder_Decode(level.dst, level.src, level.width, level.height, level.format, level.tlut,
+                        level.tlut_format);
+    }
+    m_levels.clear();
+    return;
+  }
+
+  m_strips.clear();
+  for (u32 i = 0; i < static_cast<u32>(m_levels.size()); i++)
+  {
+    const Level& level = m_levels[i];
+    const u32 block_height = TexDecoder_GetBlockHeightInTexels(level.format);
+    const u32 min_rows = std::max(MIN_TEXELS_PER_STRIP / std::max(level.width, 1u), 1u);
+    const u32 rows_per_strip = (min_rows + block_height - 1) / block_height * block_height;
+    for (u32 row = 0; row < level.height; row += rows_per_strip)
+      m_strips.push_back({i, row, std::min(rows_per_strip, level.height - row)});
+  }
+
+  m_thread_pool.ParallelFor(static_cast<u32>(m_strips.size()),
+                            [this](u32 i) { DecodeStrip(m_strips[i]); });
+
+  // The overlay covers the corner of the whole level, so it can only be drawn once all strips of
+  // the level are decoded
+  for (const Level& level : m_levels)
+    TexDecoder_DrawOverlay(level.dst, level.width, level.height, level.format);
+
+  m_levels.clear();
+}
+
+void ParallelTextureDecoder::DecodeStrip(const Strip& strip) const
+{
+  const Level& level = m_levels[strip.level];
+
+  const int src_offset = TexDecoder_GetTextureSizeInBytes(level.width, strip.first_row,
+                                                          level.format);
+  u8* const dst = level.dst + static_cast<size_t>(strip.first_row) * level.width * sizeof(u32);
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst), level.src + src_offset, level.width,
+                         strip.num_rows, level.format, level.tlut, level.tlut_format);
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// Decodes the levels of a texture on several threads. Each level is split into strips of whole
+// block rows, which can be decoded independently of each other. Small textures are decoded on the
+// calling thread, since waking up the worker threads would take longer than decoding them.
+class ParallelTextureDecoder
+{
+public:
+  // Textures with fewer texels than this in all of their queued levels are decoded serially
+  static constexpr u32 MIN_PARALLEL_TEXELS = 256 * 256;
+  // Levels are split into strips of at least this many texels
+  static constexpr u32 MIN_TEXELS_PER_STRIP = 128 * 128;
+
+  // A thread count of 0 uses one thread per core, except for the core of the emulated CPU.
+  // The calling thread always helps with decoding, so 1 means no worker threads.
+  explicit ParallelTextureDecoder(u32 thread_count = 0);
+
+  // Queues a level to be decoded by the next call to Decode(). The width and height must be
+  // multiples of the block size of the format, as for TexDecoder_Decode.
+  void AddLevel(u8* dst, const u8* src, u32 width, u32 height, TextureFormat format,
+                const u8* tlut, TLUTFormat tlut_format);
+
+  // Decodes all queued levels and returns once they are done.
+  void Decode();
+
+  u32 GetThreadCount() const { return m_thread_pool.GetThreadCount(); }
+
+private:
+  struct Level
+  {
+    u8* dst;
+    const u8* src;
+    u32 width;
+    u32 height;
+    TextureFormat format;
+    const u8* tlut;
+    TLUTFormat tlut_format;
+  };
+
+  struct Strip
+  {
+    u32 level;
+    // Texel rows, always a multiple of the block height
+    u32 first_row;
+    u32 num_rows;
+  };
+
+  void DecodeStrip(const Strip& strip) const;
+
+  std::vector<Level> m_levels;
+  std::vector<Strip> m_strips;
+
+  Common::ThreadPool m_thread_pool;
+};
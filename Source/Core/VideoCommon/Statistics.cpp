@@ -95,6 +95,8 @@ void Statistics::Display() const
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
+  if (g_ActiveConfig.bDisplayListCache)
+    draw_statistic("dlists replayed", "%d", this_frame.num_dlists_replayed);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
@@ -109,6 +111,14 @@ void Statistics::Display() const
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
+  if (g_ActiveConfig.bVertexLoaderCache)
+  {
+    draw_statistic("Vertex cache hits", "%d/%d", this_frame.num_vertex_loader_cache_hits,
+                   this_frame.num_vertex_loader_cache_hits +
+                       this_frame.num_vertex_loader_cache_misses);
+    draw_statistic("Vertex cache saved", "%i kB",
+                   this_frame.bytes_vertex_loader_cache_saved / 1024);
+  }
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
@@ -53,6 +53,7 @@ struct Statistics
     int num_draw_calls = 0;
 
     int num_dlists_called = 0;
+    int num_dlists_replayed = 0;
 
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
@@ -66,6 +67,9 @@ struct Statistics
     int rasterized_pixels = 0;
     int num_triangles_drawn = 0;
     int num_vertices_loaded = 0;
+    int num_vertex_loader_cache_hits = 0;
+    int num_vertex_loader_cache_misses = 0;
+    int bytes_vertex_loader_cache_saved = 0;
     int tev_pixels_in = 0;
     int tev_pixels_out = 0;
 
@@ -65,6 +65,17 @@ static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+// Version 1 is the sampled hash of older versions. Version 2 hashes all of the data with XXH3,
+// so it can't miss updates to the parts of a texture that sampling skips, and ignores the sample
+// count.
+static u64 HashTextureData(const u8* src, u32 len, u32 samples)
+{
+  if (g_ActiveConfig.iTextureHashVersion < 2)
+    return Common::GetHash64(src, len, samples);
+
+  return Common::GetXXH3Hash64(src, len);
+}
+
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
@@ -158,6 +169,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
   // TODO: Invalidating texcache is really stupid in some of these cases
   if (config.iSafeTextureCache_ColorSamples != m_backup_config.color_samples ||
+      config.iTextureHashVersion != m_backup_config.texture_hash_version ||
       config.bTexFmtOverlayEnable != m_backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != m_backup_config.texfmt_overlay_center ||
       config.bHiresTextures != m_backup_config.hires_textures ||
@@ -247,6 +259,7 @@ bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
 void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
 {
   m_backup_config.color_samples = config.iSafeTextureCache_ColorSamples;
+  m_backup_config.texture_hash_version = config.iTextureHashVersion;
   m_backup_config.texfmt_overlay = config.bTexFmtOverlayEnable;
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
@@ -1386,15 +1399,15 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  base_hash = HashTextureData(texture_info.GetData(), texture_info.GetTextureSize(),
+                              textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
-                                      textureCacheSafetyColorSampleSize);
+        base_hash ^ HashTextureData(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
+                                    textureCacheSafetyColorSampleSize);
   }
   else
   {
@@ -1758,14 +1771,10 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
+    const auto allocate_dst_buffer = [&] {
+      if (dst_buffer)
+        return;
 
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
-    {
       size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
       // Allocate memory for all levels at once
@@ -1786,11 +1795,35 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
+    };
+
+    // The levels which aren't decoded on the GPU are all decoded at once, so that large textures
+    // and their mipmaps can be split between several threads
+    struct DecodedLevel
+    {
+      u32 level;
+      u32 width;
+      u32 height;
+      u32 expanded_width;
+      u8* data;
+      size_t size;
+    };
+    std::vector<DecodedLevel> decoded_levels;
+
+    if (!decode_on_gpu ||
+        !DecodeTextureOnGPU(
+            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
+            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    {
+      allocate_dst_buffer();
+      const size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        m_texture_decoder.AddLevel(dst_buffer, texture_info.GetData(), expanded_width,
+                                   expanded_height, texture_info.GetTextureFormat(),
+                                   texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
       }
       else
       {
@@ -1799,10 +1832,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                        expanded_height);
       }
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
-
+      decoded_levels.push_back(
+          {0, width, height, expanded_width, dst_buffer, decoded_texture_size});
       dst_buffer += decoded_texture_size;
     }
 
@@ -1821,22 +1852,29 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                   (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
                               texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
-        // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
+        allocate_dst_buffer();
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
+        m_texture_decoder.AddLevel(dst_buffer, mip_level->GetData(),
+                                   mip_level->GetExpandedWidth(), mip_level->GetExpandedHeight(),
+                                   texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                                   texture_info.GetTlutFormat());
 
+        decoded_levels.push_back({level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                  mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size});
         dst_buffer += decoded_mip_size;
       }
     }
 
+    m_texture_decoder.Decode();
+
+    for (const DecodedLevel& level : decoded_levels)
+    {
+      entry->texture->Load(level.level, level.width, level.height, level.expanded_width,
+                           level.data, level.size);
+      arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, level.data);
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump)
@@ -3183,7 +3221,7 @@ u64 TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointer(addr);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return HashTextureData(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3202,7 +3240,7 @@ u64 TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ HashTextureData(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
@@ -24,6 +24,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -424,6 +425,7 @@ private:
   struct BackupConfig
   {
     int color_samples;
+    int texture_hash_version;
     bool texfmt_overlay;
     bool texfmt_overlay_center;
     bool hires_textures;
@@ -446,6 +448,9 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Threads used for decoding large textures on the CPU.
+  ParallelTextureDecoder m_texture_decoder;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
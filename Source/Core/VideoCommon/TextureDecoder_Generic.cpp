@@ -6,6 +6,10 @@
 #include <algorithm>
 #include <cmath>
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -141,6 +145,173 @@ static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
 #endif
 }
 
+#ifdef _M_ARM_64
+// Stores 8 texels, given as the low (GR) and high (AB) halves of their RGBA8 values, 4 per row.
+static inline void StoreTexels_NEON(u32* row0, u32* row1, uint16x8_t low, uint16x8_t high)
+{
+  vst1q_u16((u16*)row0, vzip1q_u16(low, high));
+  vst1q_u16((u16*)row1, vzip2q_u16(low, high));
+}
+
+// Decodes two consecutive rows of a 4x4 block.
+static inline void DecodeRows_IA8_NEON(u32* row0, u32* row1, const u8* src)
+{
+  // (ai) -> (aiii) for each texel, the first row is in the low 8 bytes
+  static constexpr u8 mask0[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+  static constexpr u8 mask1[16] = {9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14};
+  const uint8x16_t val = vld1q_u8(src);
+  vst1q_u8((u8*)row0, vqtbl1q_u8(val, vld1q_u8(mask0)));
+  vst1q_u8((u8*)row1, vqtbl1q_u8(val, vld1q_u8(mask1)));
+}
+
+// Decodes two consecutive rows of a 4x4 block.
+static inline void DecodeRows_RGB565_NEON(u32* row0, u32* row1, const u8* src)
+{
+  const uint16x8_t val = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+  const uint16x8_t r5 = vshrq_n_u16(val, 11);
+  const uint16x8_t g6 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x3f));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1f));
+
+  // Swizzle bits: 00012345 -> 12345123 and 00123456 -> 12345612
+  const uint16x8_t r = vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2));
+  const uint16x8_t g = vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4));
+  const uint16x8_t b = vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2));
+
+  StoreTexels_NEON(row0, row1, vorrq_u16(r, vshlq_n_u16(g, 8)),
+                   vorrq_u16(b, vdupq_n_u16(0xff00)));
+}
+
+// Decodes two consecutive rows of a 4x4 block. Both encodings are decoded, and the top bit of each
+// texel selects one.
+static inline void DecodeRows_RGB5A3_NEON(u32* row0, u32* row1, const u8* src)
+{
+  const uint16x8_t val = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+
+  // RGB555: swizzle bits: 00012345 -> 12345123
+  const uint16x8_t r5 = vandq_u16(vshrq_n_u16(val, 10), vdupq_n_u16(0x1f));
+  const uint16x8_t g5 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x1f));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1f));
+  const uint16x8_t r0 = vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2));
+  const uint16x8_t g0 = vorrq_u16(vshlq_n_u16(g5, 3), vshrq_n_u16(g5, 2));
+  const uint16x8_t b0 = vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2));
+
+  // RGBA4443: swizzle bits: 00001234 -> 12341234 and 00000123 -> 12312312
+  const uint16x8_t r4 = vandq_u16(vshrq_n_u16(val, 8), vdupq_n_u16(0xf));
+  const uint16x8_t g4 = vandq_u16(vshrq_n_u16(val, 4), vdupq_n_u16(0xf));
+  const uint16x8_t b4 = vandq_u16(val, vdupq_n_u16(0xf));
+  const uint16x8_t a3 = vandq_u16(vshrq_n_u16(val, 12), vdupq_n_u16(0x7));
+  const uint16x8_t r1 = vorrq_u16(vshlq_n_u16(r4, 4), r4);
+  const uint16x8_t g1 = vorrq_u16(vshlq_n_u16(g4, 4), g4);
+  const uint16x8_t b1 = vorrq_u16(vshlq_n_u16(b4, 4), b4);
+  const uint16x8_t a1 =
+      vorrq_u16(vshlq_n_u16(a3, 5), vorrq_u16(vshlq_n_u16(a3, 2), vshrq_n_u16(a3, 1)));
+
+  const uint16x8_t is_rgb555 = vtstq_u16(val, vdupq_n_u16(0x8000));
+  const uint16x8_t low = vbslq_u16(is_rgb555, vorrq_u16(r0, vshlq_n_u16(g0, 8)),
+                                   vorrq_u16(r1, vshlq_n_u16(g1, 8)));
+  const uint16x8_t high = vbslq_u16(is_rgb555, vorrq_u16(b0, vdupq_n_u16(0xff00)),
+                                    vorrq_u16(b1, vshlq_n_u16(a1, 8)));
+  StoreTexels_NEON(row0, row1, low, high);
+}
+
+// Decodes one row of a block, given the AR and GB halves of the row.
+static inline void DecodeRow_RGBA8_NEON(u32* dst, const u8* ar, const u8* gb)
+{
+  // (gbgbgbgb arararar) -> (abgr abgr abgr abgr)
+  static constexpr u8 mask[16] = {1, 8, 9, 0, 3, 10, 11, 2, 5, 12, 13, 4, 7, 14, 15, 6};
+  const uint8x16_t val = vcombine_u8(vld1_u8(ar), vld1_u8(gb));
+  vst1q_u8((u8*)dst, vqtbl1q_u8(val, vld1q_u8(mask)));
+}
+
+// Decodes the given number of palette entries, which must be a multiple of 8. TLUTs use the same
+// encodings as the IA8, RGB565 and RGB5A3 texture formats.
+static void DecodePalette_NEON(u32* dst, const u8* tlut, TLUTFormat tlutfmt, int count)
+{
+  for (int i = 0; i < count; i += 8, tlut += 16)
+  {
+    switch (tlutfmt)
+    {
+    case TLUTFormat::IA8:
+      DecodeRows_IA8_NEON(dst + i, dst + i + 4, tlut);
+      break;
+    case TLUTFormat::RGB565:
+      DecodeRows_RGB565_NEON(dst + i, dst + i + 4, tlut);
+      break;
+    case TLUTFormat::RGB5A3:
+      DecodeRows_RGB5A3_NEON(dst + i, dst + i + 4, tlut);
+      break;
+    default:
+      std::fill(dst + i, dst + i + 8, 0);
+      break;
+    }
+  }
+}
+
+// Selects the bytes of texels 4 * n to 4 * n + 3 from a vector of 16 texels, four times each
+static constexpr u8 s_spread_mask[4][16] = {
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3},
+    {4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7},
+    {8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11},
+    {12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15},
+};
+
+// Splits two consecutive rows of an 8x8 block of 4-bit values into one byte per texel, with the
+// first row in the low 8 bytes.
+static inline uint8x16_t LoadRows_4Bit_NEON(const u8* src)
+{
+  const uint8x8_t val = vld1_u8(src);
+  const uint8x8x2_t nibbles = vzip_u8(vshr_n_u8(val, 4), vand_u8(val, vdup_n_u8(0xf)));
+  return vcombine_u8(nibbles.val[0], nibbles.val[1]);
+}
+
+// Decodes two consecutive rows of an 8x8 block.
+static inline void DecodeRows_I4_NEON(u32* row0, u32* row1, const u8* src)
+{
+  // Swizzle bits: 00001234 -> 12341234
+  const uint8x16_t i4 = LoadRows_4Bit_NEON(src);
+  const uint8x16_t i = vorrq_u8(vshlq_n_u8(i4, 4), i4);
+  vst1q_u8((u8*)row0, vqtbl1q_u8(i, vld1q_u8(s_spread_mask[0])));
+  vst1q_u8((u8*)(row0 + 4), vqtbl1q_u8(i, vld1q_u8(s_spread_mask[1])));
+  vst1q_u8((u8*)row1, vqtbl1q_u8(i, vld1q_u8(s_spread_mask[2])));
+  vst1q_u8((u8*)(row1 + 4), vqtbl1q_u8(i, vld1q_u8(s_spread_mask[3])));
+}
+
+// Decodes two consecutive rows of an 8x8 block, given the first 16 entries of the decoded palette.
+static inline void DecodeRows_C4_NEON(u32* row0, u32* row1, const u8* src,
+                                      const uint8x16x4_t& palette)
+{
+  // Each texel is looked up as 4 bytes in the 64-byte table
+  static constexpr u8 byte_in_texel[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  const uint8x16_t offsets = vshlq_n_u8(LoadRows_4Bit_NEON(src), 2);
+  const uint8x16_t bytes = vld1q_u8(byte_in_texel);
+  u32* const dst[4] = {row0, row0 + 4, row1, row1 + 4};
+  for (int n = 0; n < 4; n++)
+  {
+    const uint8x16_t index = vaddq_u8(vqtbl1q_u8(offsets, vld1q_u8(s_spread_mask[n])), bytes);
+    vst1q_u8((u8*)dst[n], vqtbl4q_u8(palette, index));
+  }
+}
+
+// Decodes two consecutive rows of an 8x4 block.
+static inline void DecodeRows_IA4_NEON(u32* row0, u32* row1, const u8* src)
+{
+  // Swizzle bits: 00001234 -> 12341234
+  const uint8x16_t val = vld1q_u8(src);
+  const uint8x16_t a4 = vshrq_n_u8(val, 4);
+  const uint8x16_t l4 = vandq_u8(val, vdupq_n_u8(0xf));
+  const uint8x16_t a = vorrq_u8(vshlq_n_u8(a4, 4), a4);
+  const uint8x16_t l = vorrq_u8(vshlq_n_u8(l4, 4), l4);
+
+  // (ll) and (la) halves of the (llla) texels, the first row in val[0]
+  const uint8x16x2_t ll = vzipq_u8(l, l);
+  const uint8x16x2_t la = vzipq_u8(l, a);
+  StoreTexels_NEON(row0, row0 + 4, vreinterpretq_u16_u8(ll.val[0]),
+                   vreinterpretq_u16_u8(la.val[0]));
+  StoreTexels_NEON(row1, row1 + 4, vreinterpretq_u16_u8(ll.val[1]),
+                   vreinterpretq_u16_u8(la.val[1]));
+}
+#endif
+
 static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 {
   // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
@@ -198,18 +369,41 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
                             const u8* tlut, TLUTFormat tlutfmt)
 {
   const int Wsteps4 = (width + 3) / 4;
-  const int Wsteps8 = (width + 7) / 8;
+  [[maybe_unused]] const int Wsteps8 = (width + 7) / 8;
 
   switch (texformat)
   {
   case TextureFormat::C4:
+  {
+#ifdef _M_ARM_64
+    u32 palette[16];
+    DecodePalette_NEON(palette, tlut, tlutfmt, 16);
+    const u8* palette_bytes = reinterpret_cast<const u8*>(palette);
+    const uint8x16x4_t palette_table = {vld1q_u8(palette_bytes), vld1q_u8(palette_bytes + 16),
+                                        vld1q_u8(palette_bytes + 32), vld1q_u8(palette_bytes + 48)};
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+        {
+          DecodeRows_C4_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src,
+                             palette_table);
+        }
+#else
     for (int y = 0; y < height; y += 8)
       for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
           DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
-    break;
+#endif
+  }
+  break;
   case TextureFormat::I4:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+          DecodeRows_I4_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 8)
       for (int x = 0; x < width; x += 8)
@@ -222,10 +416,26 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
             memset(dst + (y + iy) * width + x + ix * 2, i1, 4);
             memset(dst + (y + iy) * width + x + ix * 2 + 1, i2, 4);
           }
+#endif
   }
   break;
   case TextureFormat::I8:  // speed critical
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; ++iy, src += 8)
+        {
+          // (hgfedcba) -> (hhgg ffee ddcc bbaa) -> (hhhh gggg ffff eeee dddd cccc bbbb aaaa)
+          const uint8x8_t val = vld1_u8(src);
+          const uint8x8x2_t val2 = vzip_u8(val, val);
+          const uint8x16_t val2q = vcombine_u8(val2.val[0], val2.val[1]);
+          const uint8x16x2_t val4 = vzipq_u8(val2q, val2q);
+          u8* newdst = (u8*)(dst + (y + iy) * width + x);
+          vst1q_u8(newdst, val4.val[0]);
+          vst1q_u8(newdst + 16, val4.val[1]);
+        }
+#else
     // Reference C implementation
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 8)
@@ -252,24 +462,54 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           srcval = newsrc[0];
           newdst[0] = srcval | (srcval << 8) | (srcval << 16) | (srcval << 24);
         }
+#endif
   }
   break;
   case TextureFormat::C8:
+  {
+#ifdef _M_ARM_64
+    // NEON has no gather, so only the palette is decoded with it, once for the whole texture
+    u32 palette[256];
+    DecodePalette_NEON(palette, tlut, tlutfmt, 256);
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          u32* newdst = dst + (y + iy) * width + x;
+          for (int ix = 0; ix < 8; ix++)
+            newdst[ix] = palette[src[ix]];
+        }
+#else
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
           DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
-    break;
+#endif
+  }
+  break;
   case TextureFormat::IA4:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+          DecodeRows_IA4_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
           DecodeBytes_IA4(dst + (y + iy) * width + x, src + 8 * xStep);
+#endif
   }
   break;
   case TextureFormat::IA8:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+          DecodeRows_IA8_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -282,6 +522,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           ptr[2] = DecodePixel_IA8(s[2]);
           ptr[3] = DecodePixel_IA8(s[3]);
         }
+#endif
   }
   break;
   case TextureFormat::C14X2:
@@ -292,6 +533,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
   case TextureFormat::RGB565:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+          DecodeRows_RGB565_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     // Reference C implementation.
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
@@ -302,15 +549,23 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
           for (int j = 0; j < 4; j++)
             *ptr++ = DecodePixel_RGB565(Common::swap16(*s++));
         }
+#endif
   }
   break;
   case TextureFormat::RGB5A3:
   {
+#ifdef _M_ARM_64
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+          DecodeRows_RGB5A3_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, src);
+#else
     // Reference C implementation:
     for (int y = 0; y < height; y += 4)
       for (int x = 0; x < width; x += 4)
         for (int iy = 0; iy < 4; iy++, src += 8)
           DecodeBytes_RGB5A3(dst + (y + iy) * width + x, (u16*)src);
+#endif
   }
   break;
   case TextureFormat::RGBA8:  // speed critical
@@ -320,8 +575,14 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
       for (int x = 0; x < width; x += 4)
       {
         for (int iy = 0; iy < 4; iy++)
+        {
+#ifdef _M_ARM_64
+          DecodeRow_RGBA8_NEON(dst + (y + iy) * width + x, src + 8 * iy, src + 8 * iy + 32);
+#else
           DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy,
                             (u16*)src + 4 * iy + 16);
+#endif
+        }
         src += 64;
       }
   }
@@ -165,6 +165,146 @@ static inline void DecodeBytes_IA4(u32* dst, const u8* src)
   }
 }
 
+// Decodes the first `count` entries of a TLUT, so that the AVX2 decoders of the color indexed
+// formats can look up a whole row of texels at once. Returns false for invalid TLUT formats.
+static bool DecodePalette(u32* palette, const u8* tlut_, TLUTFormat tlutfmt, int count)
+{
+  const u16* tlut = (u16*)tlut_;
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    for (int i = 0; i < count; i++)
+      palette[i] = DecodePixel_IA8(tlut[i]);
+    return true;
+
+  case TLUTFormat::RGB565:
+    for (int i = 0; i < count; i++)
+      palette[i] = DecodePixel_RGB565(Common::swap16(tlut[i]));
+    return true;
+
+  case TLUTFormat::RGB5A3:
+    for (int i = 0; i < count; i++)
+      palette[i] = DecodePixel_RGB5A3(Common::swap16(tlut[i]));
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+// Decodes 16 RGB565 texels in the 16-bit words of `val` to the low (GR) and high (AB) halves of
+// their RGBA8 values.
+FUNCTION_TARGET_AVX2
+static inline void DecodeTexels_RGB565_AVX2(__m256i val, __m256i* low, __m256i* high)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi16(0x1f);
+  const __m256i kMask_x3f = _mm256_set1_epi16(0x3f);
+  const __m256i kAlpha = _mm256_set1_epi16(static_cast<s16>(0xff00));
+
+  const __m256i r5 = _mm256_srli_epi16(val, 11);
+  const __m256i g6 = _mm256_and_si256(_mm256_srli_epi16(val, 5), kMask_x3f);
+  const __m256i b5 = _mm256_and_si256(val, kMask_x1f);
+
+  // Swizzle bits: 00012345 -> 12345123 and 00123456 -> 12345612
+  const __m256i r = _mm256_or_si256(_mm256_slli_epi16(r5, 3), _mm256_srli_epi16(r5, 2));
+  const __m256i g = _mm256_or_si256(_mm256_slli_epi16(g6, 2), _mm256_srli_epi16(g6, 4));
+  const __m256i b = _mm256_or_si256(_mm256_slli_epi16(b5, 3), _mm256_srli_epi16(b5, 2));
+
+  *low = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+  *high = _mm256_or_si256(b, kAlpha);
+}
+
+// Decodes 16 RGB5A3 texels in the 16-bit words of `val` to the low (GR) and high (AB) halves of
+// their RGBA8 values. Both encodings are decoded, and the top bit of each texel selects one.
+FUNCTION_TARGET_AVX2
+static inline void DecodeTexels_RGB5A3_AVX2(__m256i val, __m256i* low, __m256i* high)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi16(0x1f);
+  const __m256i kMask_x0f = _mm256_set1_epi16(0x0f);
+  const __m256i kMask_x07 = _mm256_set1_epi16(0x07);
+  const __m256i kAlpha = _mm256_set1_epi16(static_cast<s16>(0xff00));
+
+  // RGB555: swizzle bits: 00012345 -> 12345123
+  const __m256i r5 = _mm256_and_si256(_mm256_srli_epi16(val, 10), kMask_x1f);
+  const __m256i g5 = _mm256_and_si256(_mm256_srli_epi16(val, 5), kMask_x1f);
+  const __m256i b5 = _mm256_and_si256(val, kMask_x1f);
+  const __m256i r0 = _mm256_or_si256(_mm256_slli_epi16(r5, 3), _mm256_srli_epi16(r5, 2));
+  const __m256i g0 = _mm256_or_si256(_mm256_slli_epi16(g5, 3), _mm256_srli_epi16(g5, 2));
+  const __m256i b0 = _mm256_or_si256(_mm256_slli_epi16(b5, 3), _mm256_srli_epi16(b5, 2));
+  const __m256i low555 = _mm256_or_si256(r0, _mm256_slli_epi16(g0, 8));
+  const __m256i high555 = _mm256_or_si256(b0, kAlpha);
+
+  // RGBA4443: swizzle bits: 00001234 -> 12341234 and 00000123 -> 12312312
+  const __m256i r4 = _mm256_and_si256(_mm256_srli_epi16(val, 8), kMask_x0f);
+  const __m256i g4 = _mm256_and_si256(_mm256_srli_epi16(val, 4), kMask_x0f);
+  const __m256i b4 = _mm256_and_si256(val, kMask_x0f);
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi16(val, 12), kMask_x07);
+  const __m256i r1 = _mm256_or_si256(_mm256_slli_epi16(r4, 4), r4);
+  const __m256i g1 = _mm256_or_si256(_mm256_slli_epi16(g4, 4), g4);
+  const __m256i b1 = _mm256_or_si256(_mm256_slli_epi16(b4, 4), b4);
+  const __m256i a1 =
+      _mm256_or_si256(_mm256_slli_epi16(a3, 5),
+                      _mm256_or_si256(_mm256_slli_epi16(a3, 2), _mm256_srli_epi16(a3, 1)));
+  const __m256i low4443 = _mm256_or_si256(r1, _mm256_slli_epi16(g1, 8));
+  const __m256i high4443 = _mm256_or_si256(b1, _mm256_slli_epi16(a1, 8));
+
+  // (val & 0x8000) selects RGB555
+  const __m256i is_rgb555 = _mm256_srai_epi16(val, 15);
+  *low = _mm256_blendv_epi8(low4443, low555, is_rgb555);
+  *high = _mm256_blendv_epi8(high4443, high555, is_rgb555);
+}
+
+// Decodes the formats with 4x4 blocks of big-endian 16-bit texels. Two horizontally adjacent
+// blocks are decoded at once, so that whole rows of 8 texels can be written with one store.
+template <void (*DecodeTexels)(__m256i, __m256i*, __m256i*)>
+FUNCTION_TARGET_AVX2 static void DecodeImpl_Texel16_AVX2(u32* dst, const u8* src, int width,
+                                                         int height, int Wsteps4)
+{
+  const __m256i kSwap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      // (row 3 | row 2 | row 1 | row 0) of each block
+      const __m256i* block = (const __m256i*)(src + 32 * yStep);
+      const __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256(block), kSwap16);
+      const __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256(block + 1), kSwap16);
+
+      // Rows 0 and 2, then rows 1 and 3, of both blocks: (b2 a2 | b0 a0) and (b3 a3 | b1 a1)
+      const __m256i rows[2] = {_mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b)};
+      for (int iy = 0; iy < 2; iy++)
+      {
+        __m256i low, high;
+        DecodeTexels(rows[iy], &low, &high);
+        const __m256i texels0 = _mm256_unpacklo_epi16(low, high);
+        const __m256i texels1 = _mm256_unpackhi_epi16(low, high);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_permute2x128_si256(texels0, texels1, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 2) * width + x),
+                            _mm256_permute2x128_si256(texels0, texels1, 0x31));
+      }
+    }
+
+    // A single block is left over if the width is an odd number of blocks
+    if (x < width)
+    {
+      const __m256i* block = (const __m256i*)(src + 32 * yStep);
+      __m256i low, high;
+      DecodeTexels(_mm256_shuffle_epi8(_mm256_loadu_si256(block), kSwap16), &low, &high);
+      // (row 2 | row 0) and (row 3 | row 1)
+      const __m256i rows02 = _mm256_unpacklo_epi16(low, high);
+      const __m256i rows13 = _mm256_unpackhi_epi16(low, high);
+      _mm_storeu_si128((__m128i*)(dst + (y + 0) * width + x), _mm256_castsi256_si128(rows02));
+      _mm_storeu_si128((__m128i*)(dst + (y + 1) * width + x), _mm256_castsi256_si128(rows13));
+      _mm_storeu_si128((__m128i*)(dst + (y + 2) * width + x), _mm256_extracti128_si256(rows02, 1));
+      _mm_storeu_si128((__m128i*)(dst + (y + 3) * width + x), _mm256_extracti128_si256(rows13, 1));
+    }
+  }
+}
+
 #ifdef CHECK
 static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 {
@@ -254,6 +394,83 @@ static void TexDecoder_DecodeImpl_C4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  if (!DecodePalette(palette, tlut, tlutfmt, 16))
+    return;
+
+  // The 16 colors fit in two registers, so no memory lookups are needed
+  const __m256i palette0 = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette1 = _mm256_load_si256((const __m256i*)palette + 1);
+  const __m128i kMask_x0f = _mm_set1_epi8(0x0f);
+  const __m256i kIndex7 = _mm256_set1_epi32(7);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        u32 row;
+        std::memcpy(&row, src + 4 * xStep, sizeof(row));
+        // Split the 4 bytes into the 8 indices, high nibble first: (0000 0000 0000 dcba) ->
+        // (0000 0000 DdCc BbAa)
+        const __m128i r0 = _mm_cvtsi32_si128(row);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(r0, 4), kMask_x0f);
+        const __m128i lo = _mm_and_si128(r0, kMask_x0f);
+        const __m256i indices = _mm256_cvtepu8_epi32(_mm_unpacklo_epi8(hi, lo));
+
+        // The permutes only use the low 3 bits of the indices
+        const __m256i colors0 = _mm256_permutevar8x32_epi32(palette0, indices);
+        const __m256i colors1 = _mm256_permutevar8x32_epi32(palette1, indices);
+        const __m256i colors =
+            _mm256_blendv_epi8(colors0, colors1, _mm256_cmpgt_epi32(indices, kIndex7));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), colors);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i kMask_x0f = _mm_set1_epi32(0x0f0f0f0fL);
+  const __m128i kMask_xf0 = _mm_set1_epi32(0xf0f0f0f0L);
+
+  // Same as the SSSE3 version, but a whole row of 8 texels is written by each shuffle
+  const __m256i maskRow0 = _mm256_setr_epi8(0, 0, 0, 0, 8, 8, 8, 8, 1, 1, 1, 1, 9, 9, 9, 9, 2, 2,
+                                            2, 2, 10, 10, 10, 10, 3, 3, 3, 3, 11, 11, 11, 11);
+  const __m256i maskRow1 = _mm256_setr_epi8(4, 4, 4, 4, 12, 12, 12, 12, 5, 5, 5, 5, 13, 13, 13, 13,
+                                            6, 6, 6, 6, 14, 14, 14, 14, 7, 7, 7, 7, 15, 15, 15, 15);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 8; iy += 2, xStep++)
+      {
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        // Replicate the high and low 4 bits of each byte:
+        // (00000000 00000000 HhGgFfEe DdCcBbAa) -> (hhggffee ddccbbaa HHGGFFEE DDCCBBAA)
+        const __m128i i1 = _mm_and_si128(r0, kMask_xf0);
+        const __m128i i11 = _mm_or_si128(i1, _mm_srli_epi16(i1, 4));
+        const __m128i i2 = _mm_and_si128(r0, kMask_x0f);
+        const __m128i i22 = _mm_or_si128(i2, _mm_slli_epi16(i2, 4));
+        const __m256i base = _mm256_broadcastsi128_si256(_mm_unpacklo_epi64(i11, i22));
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_shuffle_epi8(base, maskRow0));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 1) * width + x),
+                            _mm256_shuffle_epi8(base, maskRow1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I4_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -394,6 +611,30 @@ static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4,
+                                        5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; ++iy, xStep++)
+      {
+        // Broadcast the 8 bytes of the row to both lanes: (hgfedcba hgfedcba | ...), since
+        // shuffles can't move bytes between lanes
+        const __m256i r =
+            _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        // (hhhh gggg ffff eeee | dddd cccc bbbb aaaa)
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_shuffle_epi8(r, mask));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -563,6 +804,32 @@ static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Decoding the whole palette up front is cheaper than decoding each texel's color, except for
+  // the smallest textures
+  alignas(32) u32 palette[256];
+  if (!DecodePalette(palette, tlut, tlutfmt, 256))
+    return;
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i indices =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i colors = _mm256_i32gather_epi32((const int*)palette, indices, 4);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), colors);
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int height,
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
@@ -579,6 +846,89 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i kMask_x0f = _mm256_set1_epi16(0x0f);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        // Two rows of 8 texels, one per lane, with each texel in a 16-bit word
+        const __m256i val =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(src + 8 * xStep)));
+        // Swizzle bits: 00001234 -> 12341234
+        const __m256i l4 = _mm256_and_si256(val, kMask_x0f);
+        const __m256i a4 = _mm256_srli_epi16(val, 4);
+        const __m256i l = _mm256_or_si256(_mm256_slli_epi16(l4, 4), l4);
+        const __m256i a = _mm256_or_si256(_mm256_slli_epi16(a4, 4), a4);
+
+        // Interleave (ll) and (al) to (alll)
+        const __m256i low = _mm256_or_si256(l, _mm256_slli_epi16(l, 8));
+        const __m256i high = _mm256_or_si256(l, _mm256_slli_epi16(a, 8));
+        const __m256i texels0 = _mm256_unpacklo_epi16(low, high);
+        const __m256i texels1 = _mm256_unpackhi_epi16(low, high);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_permute2x128_si256(texels0, texels1, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 1) * width + x),
+                            _mm256_permute2x128_si256(texels0, texels1, 0x31));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same shuffle as the SSSE3 version, for the first or second row in each lane
+  const __m256i maskRow0 = _mm256_setr_epi8(1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6, 1, 1,
+                                            1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6);
+  const __m256i maskRow1 =
+      _mm256_setr_epi8(9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14, 9, 9, 9, 8, 11,
+                       11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      // Two horizontally adjacent blocks: (row 3 | row 2 | row 1 | row 0) each
+      const __m256i* block = (const __m256i*)(src + 32 * yStep);
+      const __m256i a = _mm256_loadu_si256(block);
+      const __m256i b = _mm256_loadu_si256(block + 1);
+      // (b1 b0 | a1 a0) and (b3 b2 | a3 a2)
+      const __m256i rows01 = _mm256_permute2x128_si256(a, b, 0x20);
+      const __m256i rows23 = _mm256_permute2x128_si256(a, b, 0x31);
+
+      _mm256_storeu_si256((__m256i*)(dst + (y + 0) * width + x),
+                          _mm256_shuffle_epi8(rows01, maskRow0));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 1) * width + x),
+                          _mm256_shuffle_epi8(rows01, maskRow1));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 2) * width + x),
+                          _mm256_shuffle_epi8(rows23, maskRow0));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 3) * width + x),
+                          _mm256_shuffle_epi8(rows23, maskRow1));
+    }
+
+    // A single block is left over if the width is an odd number of blocks
+    if (x < width)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x),
+                         _mm_shuffle_epi8(r0, _mm256_castsi256_si128(maskRow0)));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -774,6 +1124,22 @@ static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  DecodeImpl_Texel16_AVX2<DecodeTexels_RGB565_AVX2>(dst, src, width, height, Wsteps4);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  DecodeImpl_Texel16_AVX2<DecodeTexels_RGB5A3_AVX2>(dst, src, width, height, Wsteps4);
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int width, int height,
                                                TextureFormat texformat, const u8* tlut,
@@ -1001,6 +1367,60 @@ static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask0312 = _mm256_setr_epi8(2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12,
+                                            2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      // Two horizontally adjacent blocks, each made of 32 bytes of AR and 32 bytes of GB
+      const __m256i* src256 = (const __m256i*)(src + 64 * yStep);
+      const __m256i ar_a = _mm256_loadu_si256(src256);
+      const __m256i gb_a = _mm256_loadu_si256(src256 + 1);
+      const __m256i ar_b = _mm256_loadu_si256(src256 + 2);
+      const __m256i gb_b = _mm256_loadu_si256(src256 + 3);
+
+      // Rows 0 and 1, then rows 2 and 3, of the left block in the low lane and of the right block
+      // in the high lane
+      const __m256i ar01 = _mm256_permute2x128_si256(ar_a, ar_b, 0x20);
+      const __m256i ar23 = _mm256_permute2x128_si256(ar_a, ar_b, 0x31);
+      const __m256i gb01 = _mm256_permute2x128_si256(gb_a, gb_b, 0x20);
+      const __m256i gb23 = _mm256_permute2x128_si256(gb_a, gb_b, 0x31);
+
+      _mm256_storeu_si256((__m256i*)(dst + (y + 0) * width + x),
+                          _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar01, gb01), mask0312));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 1) * width + x),
+                          _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar01, gb01), mask0312));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 2) * width + x),
+                          _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar23, gb23), mask0312));
+      _mm256_storeu_si256((__m256i*)(dst + (y + 3) * width + x),
+                          _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar23, gb23), mask0312));
+    }
+
+    // A single block is left over if the width is an odd number of blocks
+    if (x < width)
+    {
+      const __m256i* src256 = (const __m256i*)(src + 64 * yStep);
+      const __m256i ar = _mm256_loadu_si256(src256);
+      const __m256i gb = _mm256_loadu_si256(src256 + 1);
+      // (row 2 | row 0) and (row 3 | row 1)
+      const __m256i rows02 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar, gb), mask0312);
+      const __m256i rows13 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar, gb), mask0312);
+      _mm_storeu_si128((__m128i*)(dst + (y + 0) * width + x), _mm256_castsi256_si128(rows02));
+      _mm_storeu_si128((__m128i*)(dst + (y + 1) * width + x), _mm256_castsi256_si128(rows13));
+      _mm_storeu_si128((__m128i*)(dst + (y + 2) * width + x), _mm256_extracti128_si256(rows02, 1));
+      _mm_storeu_si128((__m128i*)(dst + (y + 3) * width + x), _mm256_extracti128_si256(rows13, 1));
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGBA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                               TextureFormat texformat, const u8* tlut,
@@ -1422,11 +1842,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1434,7 +1861,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1442,15 +1872,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1464,12 +1906,19 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1478,7 +1927,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
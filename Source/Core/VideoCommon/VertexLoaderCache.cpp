@@ -0,0 +1,225 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexLoaderCache.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include <xxhash.h>
+
+#include "Common/Swap.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoader_Color.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
+
+namespace
+{
+// Hashing and looking up very small draws costs more than converting them again
+constexpr int MIN_CACHED_VERTICES = 32;
+// The whole cache is thrown away once the converted vertices take up more memory than this
+constexpr size_t MAX_CACHE_SIZE = 32 * 1024 * 1024;
+constexpr size_t MAX_SEEN_KEYS = 64 * 1024;
+
+struct IndexedAttribute
+{
+  // Offset of the first index in a raw vertex
+  u32 offset;
+  u32 num_indices;
+  bool index16;
+  CPArray array;
+  // Size of one element in the array
+  u32 element_size;
+};
+
+bool IsInMemory(const u8* ptr, u32 size, const u8* base, u32 base_size)
+{
+  if (!base || ptr < base || ptr >= base + base_size)
+    return false;
+  return size <= static_cast<u32>(base + base_size - ptr);
+}
+}  // namespace
+
+bool VertexLoaderCache::GetKey(VertexLoaderBase* loader, const TVtxDesc& vtx_desc,
+                               const VAT& vtx_attr, const u8* src, int count, u64* key) const
+{
+  // An NBT normal with three indices reads from three separate elements
+  if (IsIndexed(vtx_desc.low.Normal) && vtx_attr.g0.NormalIndex3 &&
+      vtx_attr.g0.NormalElements == NormalComponentCount::NTB)
+  {
+    return false;
+  }
+
+  std::array<IndexedAttribute, 12> attributes;
+  size_t num_attributes = 0;
+
+  // Each enabled TexMatIdx adds one byte, as does PosMatIdx
+  u32 offset = std::popcount(vtx_desc.low.Hex & 0x1FF);
+
+  const auto add_attribute = [&](VertexComponentFormat type, u32 size, CPArray array,
+                                 u32 element_size) {
+    if (IsIndexed(type))
+    {
+      const bool index16 = type == VertexComponentFormat::Index16;
+      attributes[num_attributes++] = {offset, size / (index16 ? 2 : 1), index16, array,
+                                      element_size};
+    }
+    offset += size;
+  };
+
+  add_attribute(vtx_desc.low.Position,
+                VertexLoader_Position::GetSize(vtx_desc.low.Position, vtx_attr.g0.PosFormat,
+                                               vtx_attr.g0.PosElements),
+                CPArray::Position,
+                VertexLoader_Position::GetSize(VertexComponentFormat::Direct,
+                                               vtx_attr.g0.PosFormat, vtx_attr.g0.PosElements));
+  add_attribute(vtx_desc.low.Normal,
+                VertexLoader_Normal::GetSize(vtx_desc.low.Normal, vtx_attr.g0.NormalFormat,
+                                             vtx_attr.g0.NormalElements, vtx_attr.g0.NormalIndex3),
+                CPArray::Normal,
+                VertexLoader_Normal::GetSize(VertexComponentFormat::Direct,
+                                             vtx_attr.g0.NormalFormat, vtx_attr.g0.NormalElements,
+                                             vtx_attr.g0.NormalIndex3));
+  for (u8 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    add_attribute(vtx_desc.low.Color[i],
+                  VertexLoader_Color::GetSize(vtx_desc.low.Color[i], vtx_attr.GetColorFormat(i)),
+                  CPArray::Color0 + i,
+                  VertexLoader_Color::GetSize(VertexComponentFormat::Direct,
+                                              vtx_attr.GetColorFormat(i)));
+  }
+  for (u8 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    add_attribute(vtx_desc.high.TexCoord[i],
+                  VertexLoader_TextCoord::GetSize(vtx_desc.high.TexCoord[i],
+                                                  vtx_attr.GetTexFormat(i),
+                                                  vtx_attr.GetTexElements(i)),
+                  CPArray::TexCoord0 + i,
+                  VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct,
+                                                  vtx_attr.GetTexFormat(i),
+                                                  vtx_attr.GetTexElements(i)));
+  }
+
+  const u32 vertex_size = loader->m_vertex_size;
+
+  // Each part is hashed with the hash of the previous parts as the seed
+  u64 hash = XXH64(&loader, sizeof(loader), 0);
+  hash = XXH64(src, count * vertex_size, hash);
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  for (size_t i = 0; i < num_attributes; i++)
+  {
+    const IndexedAttribute& attribute = attributes[i];
+
+    // A position index of all ones skips the vertex, so it doesn't read from the array
+    const u32 skip_index = attribute.index16 ? 0xFFFF : 0xFF;
+    const bool is_position = attribute.array == CPArray::Position;
+
+    u32 max_index = 0;
+    bool any_index = false;
+    for (int vertex = 0; vertex < count; vertex++)
+    {
+      const u8* index_ptr = src + vertex * vertex_size + attribute.offset;
+      for (u32 j = 0; j < attribute.num_indices; j++)
+      {
+        u32 index;
+        if (attribute.index16)
+        {
+          u16 value;
+          std::memcpy(&value, index_ptr + j * 2, sizeof(value));
+          index = Common::swap16(value);
+        }
+        else
+        {
+          index = index_ptr[j];
+        }
+        if (is_position && index == skip_index)
+          continue;
+        max_index = std::max(max_index, index);
+        any_index = true;
+      }
+    }
+    if (!any_index)
+      continue;
+
+    const u32 stride = g_main_cp_state.array_strides[attribute.array];
+    const u8* array = VertexLoaderManager::cached_arraybases[attribute.array];
+    const u32 array_size = max_index * stride + attribute.element_size;
+    if (!IsInMemory(array, array_size, memory.GetRAM(), memory.GetRamSizeReal()) &&
+        !IsInMemory(array, array_size, memory.GetEXRAM(), memory.GetExRamSizeReal()))
+    {
+      return false;
+    }
+
+    hash = XXH64(&stride, sizeof(stride), hash);
+    hash = XXH64(array, array_size, hash);
+  }
+
+  *key = hash;
+  return true;
+}
+
+int VertexLoaderCache::RunVertices(VertexLoaderBase* loader, const TVtxDesc& vtx_desc,
+                                   const VAT& vtx_attr, const u8* src, u8* dst, int count)
+{
+  u64 key;
+  if (count < MIN_CACHED_VERTICES || !GetKey(loader, vtx_desc, vtx_attr, src, count, &key))
+    return loader->RunVertices(src, dst, count);
+
+  const u32 stride = loader->m_native_vtx_decl.stride;
+
+  if (auto iter = m_entries.find(key); iter != m_entries.end())
+  {
+    const Entry& entry = iter->second;
+    std::memcpy(dst, entry.vertices.data(), entry.vertices.size());
+    VertexLoaderManager::position_cache = entry.position_cache;
+    VertexLoaderManager::position_matrix_index_cache = entry.position_matrix_index_cache;
+    VertexLoaderManager::tangent_cache = entry.tangent_cache;
+    VertexLoaderManager::binormal_cache = entry.binormal_cache;
+    loader->m_numLoadedVertices += count;
+
+    INCSTAT(g_stats.this_frame.num_vertex_loader_cache_hits);
+    ADDSTAT(g_stats.this_frame.bytes_vertex_loader_cache_saved, entry.vertices.size());
+    return entry.count;
+  }
+
+  INCSTAT(g_stats.this_frame.num_vertex_loader_cache_misses);
+
+  const int converted = loader->RunVertices(src, dst, count);
+
+  if (m_seen_keys.size() >= MAX_SEEN_KEYS)
+    m_seen_keys.clear();
+  if (m_seen_keys.insert(key).second)
+    return converted;
+
+  const size_t size = static_cast<size_t>(converted) * stride;
+  if (m_size + size > MAX_CACHE_SIZE)
+    Clear();
+
+  Entry& entry = m_entries[key];
+  entry.vertices.assign(dst, dst + size);
+  entry.count = converted;
+  entry.position_cache = VertexLoaderManager::position_cache;
+  entry.position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  entry.tangent_cache = VertexLoaderManager::tangent_cache;
+  entry.binormal_cache = VertexLoaderManager::binormal_cache;
+  m_size += size;
+
+  return converted;
+}
+
+void VertexLoaderCache::Clear()
+{
+  m_entries.clear();
+  m_seen_keys.clear();
+  m_size = 0;
+}
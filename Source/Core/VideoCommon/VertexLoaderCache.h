@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class VertexLoaderBase;
+struct TVtxDesc;
+struct VAT;
+
+// Remembers the output of the vertex loaders, so that geometry which a game sends again every frame
+// doesn't have to be converted again. Entries are keyed on a hash of the vertex loader, the raw
+// vertex data and the parts of the vertex arrays that the vertices index, so writes to any of them
+// simply lead to a different key.
+class VertexLoaderCache
+{
+public:
+  // Converts count vertices from src to dst, like VertexLoaderBase::RunVertices.
+  int RunVertices(VertexLoaderBase* loader, const TVtxDesc& vtx_desc, const VAT& vtx_attr,
+                  const u8* src, u8* dst, int count);
+
+  // Must be called whenever vertex loaders are destroyed, as they are part of the keys.
+  void Clear();
+
+private:
+  struct Entry
+  {
+    std::vector<u8> vertices;
+    int count = 0;
+
+    // Side effects of the vertex loader, which are used by zfreeze and emboss texgens
+    std::array<std::array<float, 4>, 3> position_cache;
+    std::array<u32, 3> position_matrix_index_cache;
+    std::array<float, 4> tangent_cache;
+    std::array<float, 4> binormal_cache;
+  };
+
+  bool GetKey(VertexLoaderBase* loader, const TVtxDesc& vtx_desc, const VAT& vtx_attr,
+              const u8* src, int count, u64* key) const;
+
+  std::unordered_map<u64, Entry> m_entries;
+  // Keys that have been seen once. Only data that is sent at least twice is cached, so that
+  // dynamic geometry doesn't push out static geometry.
+  std::unordered_set<u64> m_seen_keys;
+  size_t m_size = 0;
+};
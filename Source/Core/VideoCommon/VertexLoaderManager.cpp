@@ -29,6 +29,7 @@
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderCache.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -50,6 +51,7 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
+static VertexLoaderCache s_vertex_loader_cache;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
@@ -76,6 +78,7 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+  s_vertex_loader_cache.Clear();
 }
 
 void UpdateVertexArrayPointers()
@@ -369,11 +372,12 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                                             loader->m_native_vertex_format->GetVertexDeclaration());
     }
 
-    // CPUCull's performance increase comes from encoding fewer GPU commands, not sending less data
-    // Therefore it's only useful to check if culling could remove a flush
-    const bool can_cpu_cull = g_ActiveConfig.bCPUCull &&
-                              primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
-                              !g_vertex_manager->HasSendableVertices();
+    // CPUCull removes the triangles that can't be seen from the index buffer. If nothing is waiting
+    // to be sent yet, the vertices are loaded into a CPU buffer first, so that a draw without any
+    // visible triangles doesn't need a flush at all.
+    const bool can_cpu_cull =
+        g_ActiveConfig.bCPUCull && primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES;
+    const bool cpu_cull_to_cpu_buffer = can_cpu_cull && !g_vertex_manager->HasSendableVertices();
 
     // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
     // They still need to go through vertex loading, because we need to calculate a zfreeze
@@ -383,20 +387,36 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
     const int stride = loader->m_native_vtx_decl.stride;
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
-                                                                cullall || can_cpu_cull);
+                                                                cullall || cpu_cull_to_cpu_buffer);
 
-    count = loader->RunVertices(src, dst.GetPointer(), count);
+    if (g_ActiveConfig.bVertexLoaderCache)
+    {
+      count = s_vertex_loader_cache.RunVertices(loader, g_main_cp_state.vtx_desc,
+                                                g_main_cp_state.vtx_attr[vtx_attr_group], src,
+                                                dst.GetPointer(), count);
+    }
+    else
+    {
+      count = loader->RunVertices(src, dst.GetPointer(), count);
+    }
 
     if (can_cpu_cull && !cullall)
     {
-      if (!g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), count))
+      // Only the triangles that survive culling are added to the index buffer, but all vertices
+      // are kept so that the indices of the following primitives don't change.
+      const u32 num_triangles =
+          g_vertex_manager->CullTriangles(loader, primitive, dst.GetPointer(), count);
+      if (num_triangles != 0 && cpu_cull_to_cpu_buffer)
       {
         DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
         memmove(new_dst.GetPointer(), dst.GetPointer(), count * stride);
       }
+      g_vertex_manager->AddVisibleTriangles(primitive, count, num_triangles);
+    }
+    else
+    {
+      g_vertex_manager->AddIndices(primitive, count);
     }
-
-    g_vertex_manager->AddIndices(primitive, count);
     g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
 
     ADDSTAT(g_stats.this_frame.num_prims, count);
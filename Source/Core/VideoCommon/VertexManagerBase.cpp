@@ -134,11 +134,17 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
-bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
-                                             OpcodeDecoder::Primitive primitive, const u8* src,
-                                             u32 count)
+u32 VertexManagerBase::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                     const u8* src, u32 count)
 {
-  return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
+  return m_cpu_cull.CullTriangles(loader, primitive, src, count);
+}
+
+void VertexManagerBase::AddVisibleTriangles(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                            u32 num_triangles)
+{
+  m_index_generator.AddTriangles(primitive, m_cpu_cull.GetVisibleTriangles(), num_triangles,
+                                 num_vertices);
 }
 
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
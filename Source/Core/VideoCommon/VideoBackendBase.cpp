@@ -429,5 +429,6 @@ void VideoBackendBase::ShutdownShared()
 
   auto& system = Core::System::GetInstance();
   VertexLoaderManager::Clear();
+  OpcodeDecoder::ClearDisplayListCache();
   system.GetFifo().Shutdown();
 }
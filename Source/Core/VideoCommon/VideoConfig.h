@@ -198,6 +198,8 @@ struct VideoConfig final
   bool bBBoxEnable = false;
   bool bForceProgressive = false;
   bool bCPUCull = false;
+  bool bVertexLoaderCache = false;
+  bool bDisplayListCache = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -208,6 +210,8 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  // 1: sampled hash of older versions, 2: XXH3 of all texture data
+  int iTextureHashVersion = 0;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -244,6 +248,10 @@ struct VideoConfig final
   // Multithreaded submission, currently only supported with Vulkan.
   bool bBackendMultithreading = true;
 
+  // Record draw commands on a separate thread, currently only supported with Vulkan.
+  // Only used together with bBackendMultithreading.
+  bool bBackendRecordingThread = false;
+
   // Early command buffer execution interval in number of draws.
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval = 0;
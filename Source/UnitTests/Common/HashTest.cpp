@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+std::vector<u8> TestData(size_t size)
+{
+  std::vector<u8> data(size);
+  for (size_t i = 0; i < size; i++)
+    data[i] = static_cast<u8>(i * 7 + 3);
+  return data;
+}
+
+// Runs the check with each of the XXH3 loops that are selected at runtime on this host
+template <typename Function>
+void ForEachXXH3Loop(Function check)
+{
+  const bool has_avx2 = cpu_info.bAVX2;
+  for (const bool use_avx2 : {false, true})
+  {
+    if (use_avx2 && !has_avx2)
+      continue;
+    cpu_info.bAVX2 = use_avx2;
+    check();
+  }
+  cpu_info.bAVX2 = has_avx2;
+}
+}  // namespace
+
+TEST(Hash, XXH3KnownValues)
+{
+  // The values of the reference XXH3_64bits. The lengths cover each of the short input paths of
+  // XXH3 and the long input loop that is picked at runtime, with and without a partial block.
+  static constexpr std::array<std::pair<size_t, u64>, 10> KNOWN_VALUES = {{
+      {0, 0x2d06800538d394c2},
+      {1, 0x13e608bc156defed},
+      {16, 0xb8c859b0f030b585},
+      {17, 0x714a04408e79b80f},
+      {128, 0x67425a03650261bf},
+      {129, 0xc664bf3311c6abc4},
+      {240, 0x64556dc6b462a6cf},
+      {241, 0x8beadd3a8874fe17},
+      {1024, 0x9b81661c641c72b1},
+      {5000, 0x799aaddd7339581d},
+  }};
+
+  const std::vector<u8> data = TestData(5000);
+  ForEachXXH3Loop([&] {
+    for (const auto& [length, hash] : KNOWN_VALUES)
+    {
+      EXPECT_EQ(hash, Common::GetXXH3Hash64(data.data(), length))
+          << "length " << length << ", AVX2 " << cpu_info.bAVX2;
+    }
+  });
+}
+
+TEST(Hash, XXH3SeesEveryByte)
+{
+  // Unlike the sampled texture hash, a change to any byte must change the hash
+  std::vector<u8> data = TestData(4096 + 17);
+  ForEachXXH3Loop([&] {
+    const u64 hash = Common::GetXXH3Hash64(data.data(), data.size());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+      data[i] ^= 0x10;
+      EXPECT_NE(hash, Common::GetXXH3Hash64(data.data(), data.size()))
+          << "byte " << i << ", AVX2 " << cpu_info.bAVX2;
+      data[i] ^= 0x10;
+    }
+  });
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32, 1024> q;
+
+  EXPECT_TRUE(q.Empty());
+
+  EXPECT_TRUE(q.TryPush(1));
+  EXPECT_FALSE(q.Empty());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+
+  // Test the FIFO order.
+  for (u32 i = 0; i < 1000; ++i)
+    EXPECT_TRUE(q.TryPush(i));
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    u32 v2;
+    EXPECT_TRUE(q.Pop(v2));
+    EXPECT_EQ(i, v2);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (u32 i = 0; i < 1000; ++i)
+    EXPECT_TRUE(q.TryPush(i));
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, Full)
+{
+  Common::MPSCQueue<u32, 4> q;
+
+  // Go around the ring a few times, filling it up each time
+  u32 next_push = 0;
+  u32 next_pop = 0;
+  for (u32 round = 0; round < 3; ++round)
+  {
+    while (q.TryPush(next_push))
+      ++next_push;
+    EXPECT_EQ(4u, next_push - next_pop);
+
+    for (u32 i = 0; i < 3; ++i)
+    {
+      u32 v;
+      EXPECT_TRUE(q.Pop(v));
+      EXPECT_EQ(next_pop++, v);
+    }
+    EXPECT_FALSE(q.Empty());
+  }
+
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  static constexpr u32 THREAD_COUNT = 4;
+  static constexpr u32 ITEM_COUNT = 100000;
+
+  // Small enough to be full often
+  Common::MPSCQueue<u32, 64> q;
+
+  auto inserter = [&q](u32 thread_id) {
+    for (u32 i = 0; i < ITEM_COUNT; ++i)
+    {
+      while (!q.TryPush(thread_id << 24 | i))
+        std::this_thread::yield();
+    }
+  };
+
+  auto popper = [&q]() {
+    // Items from different threads can interleave arbitrarily, but the items of each thread must
+    // come out in the order they were pushed in.
+    std::array<u32, THREAD_COUNT> next{};
+    for (u32 i = 0; i < THREAD_COUNT * ITEM_COUNT; ++i)
+    {
+      u32 v;
+      while (!q.Pop(v))
+        std::this_thread::yield();
+      const u32 thread_id = v >> 24;
+      ASSERT_LT(thread_id, THREAD_COUNT);
+      EXPECT_EQ(next[thread_id], v & 0xFFFFFF);
+      ++next[thread_id];
+    }
+    EXPECT_TRUE(q.Empty());
+  };
+
+  std::thread popper_thread(popper);
+  std::vector<std::thread> inserter_threads;
+  for (u32 i = 0; i < THREAD_COUNT; ++i)
+    inserter_threads.emplace_back(inserter, i);
+
+  for (std::thread& thread : inserter_threads)
+    thread.join();
+  popper_thread.join();
+}
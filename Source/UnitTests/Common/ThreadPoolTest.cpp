@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
+
+TEST(ThreadPool, RunOnAllThreads)
+{
+  Common::ThreadPool pool(4, "Test");
+  ASSERT_EQ(4u, pool.GetThreadCount());
+
+  for (u32 i = 0; i < 100; i++)
+  {
+    std::vector<std::atomic<u32>> runs(pool.GetThreadCount());
+    pool.RunOnAllThreads([&](u32 thread) { runs[thread]++; });
+
+    for (u32 thread = 0; thread < pool.GetThreadCount(); thread++)
+      EXPECT_EQ(1u, runs[thread].load()) << "thread " << thread;
+  }
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+  for (const u32 thread_count : {1u, 4u})
+  {
+    Common::ThreadPool pool(thread_count, "Test");
+    ASSERT_EQ(thread_count, pool.GetThreadCount());
+
+    for (const u32 job_count : {0u, 1u, 3u, 1000u})
+    {
+      std::vector<std::atomic<u32>> runs(job_count);
+      pool.ParallelFor(job_count, [&](u32 job) { runs[job]++; });
+
+      for (u32 i = 0; i < job_count; i++)
+        EXPECT_EQ(1u, runs[i].load()) << "job " << i << " of " << job_count;
+    }
+  }
+}
@@ -0,0 +1,243 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/CheatSearch.h"
+
+TEST(CheatSearch, SlotBitmapRankAndSelect)
+{
+  constexpr u64 slot_count = 5000;
+  Cheats::SlotBitmap bitmap(slot_count);
+  std::vector<u64> slots;
+  for (u64 slot = 3; slot < slot_count; slot += slot % 7 + 1)
+  {
+    bitmap.Set(slot);
+    slots.push_back(slot);
+  }
+  // Leave a run of empty blocks in the middle
+  bitmap.SetWord(20, 0);
+  bitmap.SetWord(21, 0);
+  bitmap.SetWord(22, 0);
+  std::erase_if(slots, [](u64 slot) { return slot >= 20 * 64 && slot < 23 * 64; });
+  bitmap.UpdateIndex();
+
+  ASSERT_EQ(bitmap.Count(), slots.size());
+  for (size_t i = 0; i < slots.size(); ++i)
+  {
+    EXPECT_TRUE(bitmap.Test(slots[i]));
+    EXPECT_EQ(bitmap.Select(i), slots[i]);
+    EXPECT_EQ(bitmap.Rank(slots[i]), i);
+  }
+  EXPECT_FALSE(bitmap.Test(0));
+  EXPECT_FALSE(bitmap.Test(slot_count + 1000));
+  EXPECT_EQ(bitmap.Rank(slot_count + 1000), slots.size());
+}
+
+TEST(CheatSearch, SlotBitmapEmpty)
+{
+  Cheats::SlotBitmap bitmap;
+  bitmap.UpdateIndex();
+  EXPECT_EQ(bitmap.Count(), 0u);
+  EXPECT_FALSE(bitmap.Test(0));
+}
+
+TEST(CheatSearch, ResultAddresses)
+{
+  Cheats::SearchResults<u32> results;
+  results.m_slot_ranges = {{0x80000000, 4, 100, 0}, {0x90000000, 4, 10, 128}};
+  results.m_candidates = Cheats::SlotBitmap(138);
+  results.m_candidates.Set(0);
+  results.m_candidates.Set(99);
+  results.m_candidates.Set(128);
+  results.m_candidates.Set(137);
+  results.m_candidates.UpdateIndex();
+  results.m_inaccessible = Cheats::SlotBitmap(138);
+  results.m_inaccessible.Set(128);
+  results.m_inaccessible.UpdateIndex();
+  results.m_values = {1, 2, 0, 4};
+  results.m_values_translated = true;
+
+  ASSERT_EQ(results.GetCount(), 4u);
+  EXPECT_EQ(results.GetAddress(0), 0x80000000u);
+  EXPECT_EQ(results.GetAddress(1), 0x8000018Cu);
+  EXPECT_EQ(results.GetAddress(2), 0x90000000u);
+  EXPECT_EQ(results.GetAddress(3), 0x90000024u);
+  EXPECT_EQ(results.GetValueState(1), Cheats::SearchResultValueState::ValueFromVirtualMemory);
+  EXPECT_EQ(results.GetValueState(2), Cheats::SearchResultValueState::AddressNotAccessible);
+}
+
+namespace
+{
+// A few pages of fake emulated memory at 0x80000000. The third page is unmapped unless
+// m_page_2_mapped is set, and the last two pages are swapped in host memory, so values that cross
+// between them aren't contiguous.
+class FakeMemory
+{
+public:
+  static constexpr u32 BASE = 0x80000000;
+  static constexpr u32 PAGE_SIZE = 0x1000;
+  static constexpr u32 PAGE_COUNT = 5;
+
+  FakeMemory() : m_ram(PAGE_SIZE * PAGE_COUNT) {}
+
+  u8* GetPage(u32 address)
+  {
+    const u32 page = (address - BASE) / PAGE_SIZE;
+    if (address < BASE || page >= PAGE_COUNT || (page == 2 && !m_page_2_mapped))
+      return nullptr;
+    constexpr u32 host_pages[PAGE_COUNT] = {0, 1, 2, 4, 3};
+    return m_ram.data() + host_pages[page] * PAGE_SIZE;
+  }
+
+  void Write8(u32 address, u8 value) { GetPage(address)[(address - BASE) % PAGE_SIZE] = value; }
+
+  void Write32(u32 address, u32 value)
+  {
+    for (u32 i = 0; i < 4; ++i)
+      Write8(address + i, static_cast<u8>(value >> (24 - i * 8)));
+  }
+
+  Cheats::HostPageLookup GetLookup()
+  {
+    return [this](u32 page_address) -> const u8* { return GetPage(page_address); };
+  }
+
+  bool m_page_2_mapped = false;
+
+private:
+  std::vector<u8> m_ram;
+};
+
+template <typename T>
+std::vector<u32> GetAddresses(const Cheats::SearchResults<T>& results)
+{
+  std::vector<u32> addresses;
+  for (size_t i = 0; i < results.GetCount(); ++i)
+    addresses.push_back(results.GetAddress(i));
+  return addresses;
+}
+}  // namespace
+
+TEST(CheatSearch, NewSearchSpecificValue)
+{
+  FakeMemory memory;
+  memory.Write32(0x80000010, 0x12345678);
+  memory.Write32(0x80001FFC, 0x12345678);
+  memory.Write32(0x80003000, 0x12345678);
+  memory.Write32(0x80004002, 0x12345678);
+
+  const std::vector<Cheats::MemoryRange> ranges = {{FakeMemory::BASE, 0x5000}};
+  const Cheats::SearchFilter<u32> filter{Cheats::FilterType::CompareAgainstSpecificValue,
+                                         Cheats::CompareType::Equal, 0x12345678};
+
+  const auto aligned = Cheats::NewSearchInHostMemory(memory.GetLookup(), ranges, true, filter);
+  EXPECT_EQ(GetAddresses(aligned), (std::vector<u32>{0x80000010, 0x80001FFC, 0x80003000}));
+  EXPECT_EQ(aligned.m_values, (std::vector<u32>(3, 0x12345678)));
+
+  const auto unaligned = Cheats::NewSearchInHostMemory(memory.GetLookup(), ranges, false, filter);
+  EXPECT_EQ(GetAddresses(unaligned),
+            (std::vector<u32>{0x80000010, 0x80001FFC, 0x80003000, 0x80004002}));
+}
+
+TEST(CheatSearch, NewSearchAcrossPages)
+{
+  FakeMemory memory;
+  // Crosses between two contiguous pages
+  memory.Write8(0x80000FFF, 0xAB);
+  memory.Write8(0x80001000, 0xCD);
+  // Crosses into the unmapped page
+  memory.Write8(0x80001FFF, 0xAB);
+  // Crosses between two pages that aren't contiguous in host memory
+  memory.Write8(0x80003FFF, 0xAB);
+  memory.Write8(0x80004000, 0xCD);
+
+  const std::vector<Cheats::MemoryRange> ranges = {{FakeMemory::BASE, 0x5000}};
+  const auto results = Cheats::NewSearchInHostMemory<u16>(
+      memory.GetLookup(), ranges, false,
+      {Cheats::FilterType::CompareAgainstSpecificValue, Cheats::CompareType::Equal, 0xABCD});
+  EXPECT_EQ(GetAddresses(results), (std::vector<u32>{0x80000FFF, 0x80003FFF}));
+
+  // The unreadable byte must not be treated as zero
+  const auto partial = Cheats::NewSearchInHostMemory<u16>(
+      memory.GetLookup(), ranges, false,
+      {Cheats::FilterType::CompareAgainstSpecificValue, Cheats::CompareType::Equal, 0xAB00});
+  EXPECT_EQ(partial.GetCount(), 0u);
+
+  // Every value that starts in the last bytes of the page before the unmapped one is skipped
+  const auto all = Cheats::NewSearchInHostMemory<u32>(
+      memory.GetLookup(), {{0x80001FF0, 0x20}}, false,
+      {Cheats::FilterType::DoNotFilter, Cheats::CompareType::Equal, 0});
+  ASSERT_EQ(all.GetCount(), 13u);
+  EXPECT_EQ(all.GetAddress(12), 0x80001FFCu);
+}
+
+TEST(CheatSearch, NextSearch)
+{
+  FakeMemory memory;
+  memory.m_page_2_mapped = true;
+  for (u32 address = 0x80001FF0; address < 0x80002010; address += 4)
+    memory.Write32(address, address);
+
+  const Cheats::HostPageLookup lookup = memory.GetLookup();
+  const auto first = Cheats::NewSearchInHostMemory<u32>(
+      lookup, {{0x80001FF0, 0x20}}, true,
+      {Cheats::FilterType::DoNotFilter, Cheats::CompareType::Equal, 0});
+  ASSERT_EQ(first.GetCount(), 8u);
+
+  memory.Write32(0x80001FF8, 1);
+  memory.Write32(0x80002008, 2);
+  const Cheats::SearchFilter<u32> changed{Cheats::FilterType::CompareAgainstLastValue,
+                                          Cheats::CompareType::NotEqual, 0};
+  const auto second = Cheats::NextSearchInHostMemory(lookup, first, changed);
+  EXPECT_EQ(GetAddresses(second), (std::vector<u32>{0x80001FF8, 0x80002008}));
+  EXPECT_EQ(second.m_values, (std::vector<u32>{1, 2}));
+  EXPECT_EQ(second.m_inaccessible.Count(), 0u);
+
+  // Candidates that can't be read are kept, but marked as inaccessible
+  memory.m_page_2_mapped = false;
+  const auto third = Cheats::NextSearchInHostMemory<u32>(
+      lookup, second, {Cheats::FilterType::CompareAgainstSpecificValue,
+                       Cheats::CompareType::Equal, 1});
+  ASSERT_EQ(third.GetCount(), 2u);
+  EXPECT_EQ(third.m_values, (std::vector<u32>{1, 0}));
+  EXPECT_EQ(third.GetValueState(0), Cheats::SearchResultValueState::ValueFromPhysicalMemory);
+  EXPECT_EQ(third.GetValueState(1), Cheats::SearchResultValueState::AddressNotAccessible);
+
+  // Once the memory is accessible again, the value is updated without being filtered
+  memory.m_page_2_mapped = true;
+  const auto fourth = Cheats::NextSearchInHostMemory(lookup, third, changed);
+  EXPECT_EQ(GetAddresses(fourth), (std::vector<u32>{0x80002008}));
+  EXPECT_EQ(fourth.m_values, (std::vector<u32>{2}));
+}
+
+TEST(CheatSearch, SearchManyChunks)
+{
+  // Enough slots for the search to be split into several chunks
+  constexpr u32 size = 0x40000;
+  std::vector<u8> ram(size);
+  for (u32 i = 0; i < size; ++i)
+    ram[i] = static_cast<u8>(i % 251);
+  const Cheats::HostPageLookup lookup = [&](u32 page_address) -> const u8* {
+    return ram.data() + (page_address - 0x80000000);
+  };
+
+  const auto results = Cheats::NewSearchInHostMemory<u8>(
+      lookup, {{0x80000000, size}}, false,
+      {Cheats::FilterType::CompareAgainstSpecificValue, Cheats::CompareType::Equal, 7});
+  ASSERT_EQ(results.GetCount(), (size - 7 + 250) / 251);
+  for (size_t i = 0; i < results.GetCount(); ++i)
+    EXPECT_EQ(results.GetAddress(i), 0x80000000 + 7 + i * 251);
+
+  for (u32 i = 7; i < size; i += 251 * 2)
+    ram[i] = 8;
+  const auto next = Cheats::NextSearchInHostMemory<u8>(
+      lookup, results,
+      {Cheats::FilterType::CompareAgainstLastValue, Cheats::CompareType::Equal, 0});
+  EXPECT_EQ(next.GetCount(), results.GetCount() / 2);
+  for (size_t i = 0; i < next.GetCount(); ++i)
+    EXPECT_EQ(next.GetAddress(i), 0x80000000 + 7 + 251 + i * 251 * 2);
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Schedules events from several threads at once, the way the GPU, DSP and IOS threads do, while
+// the CPU thread keeps moving them into its event queue and running them.
+
+namespace
+{
+constexpr u32 EVENTS_PER_THREAD = 10000;
+
+std::atomic<u32> s_events_ran = 0;
+
+void CountingCallback(Core::System&, u64, s64)
+{
+  s_events_ran.fetch_add(1, std::memory_order_relaxed);
+}
+
+void BM_ScheduleEventFromThreads(benchmark::State& state)
+{
+  const u32 thread_count = static_cast<u32>(state.range(0));
+  const u32 total_events = thread_count * EVENTS_PER_THREAD;
+
+  auto& system = Core::System::GetInstance();
+  const std::string profile_path = File::CreateTempDir();
+  Core::DeclareAsCPUThread();
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  // Advancing must never wait for the throttle
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  system.GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.Init();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* event_type = core_timing.RegisterEvent("Counting", CountingCallback);
+  core_timing.Advance();
+
+  for (auto _ : state)
+  {
+    s_events_ran = 0;
+
+    std::vector<std::thread> threads;
+    for (u32 thread_id = 0; thread_id < thread_count; ++thread_id)
+    {
+      threads.emplace_back([&core_timing, event_type] {
+        for (u32 i = 0; i < EVENTS_PER_THREAD; ++i)
+          core_timing.ScheduleEvent(0, event_type, i, CoreTiming::FromThread::NON_CPU);
+      });
+    }
+
+    while (s_events_ran.load(std::memory_order_relaxed) < total_events)
+    {
+      ppc_state.downcount = 0;
+      core_timing.Advance();
+    }
+
+    for (std::thread& thread : threads)
+      thread.join();
+  }
+  state.SetItemsProcessed(state.iterations() * total_events);
+
+  core_timing.Shutdown();
+  system.GetPowerPC().Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+  File::DeleteDirRecursively(profile_path);
+}
+}  // namespace
+
+BENCHMARK(BM_ScheduleEventFromThreads)->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
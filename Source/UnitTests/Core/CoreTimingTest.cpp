@@ -6,6 +6,8 @@
 #include <array>
 #include <bitset>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
@@ -327,6 +329,68 @@ TEST(CoreTiming, ScheduleIntoPast)
   AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH, 1000);
 }
 
+namespace ScheduleFromThreadsTest
+{
+static constexpr u32 THREAD_COUNT = 4;
+static constexpr u32 EVENTS_PER_THREAD = 10000;
+
+static std::array<u32, THREAD_COUNT> s_next_event;
+static u32 s_events_ran = 0;
+
+static void CountingCallback(Core::System& system, u64 userdata, s64 lateness)
+{
+  // All events have the same time, so they must run in the order they were scheduled in, at least
+  // relative to the other events of the same thread.
+  const u32 thread_id = static_cast<u32>(userdata >> 32);
+  ASSERT_LT(thread_id, THREAD_COUNT);
+  EXPECT_EQ(s_next_event[thread_id], static_cast<u32>(userdata));
+  ++s_next_event[thread_id];
+  ++s_events_ran;
+}
+}  // namespace ScheduleFromThreadsTest
+
+TEST(CoreTiming, ScheduleFromThreads)
+{
+  using namespace ScheduleFromThreadsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* cb_count = core_timing.RegisterEvent("callbackCount", CountingCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  s_next_event = {};
+  s_events_ran = 0;
+
+  std::vector<std::thread> threads;
+  for (u32 thread_id = 0; thread_id < THREAD_COUNT; ++thread_id)
+  {
+    threads.emplace_back([&core_timing, cb_count, thread_id] {
+      for (u32 i = 0; i < EVENTS_PER_THREAD; ++i)
+      {
+        core_timing.ScheduleEvent(1000, cb_count, u64{thread_id} << 32 | i,
+                                  CoreTiming::FromThread::NON_CPU);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(THREAD_COUNT * EVENTS_PER_THREAD, s_events_ran);
+  for (u32 next_event : s_next_event)
+    EXPECT_EQ(EVENTS_PER_THREAD, next_event);
+}
+
 TEST(CoreTiming, Overclocking)
 {
   auto& system = Core::System::GetInstance();
@@ -0,0 +1,216 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/MemoryWatcher.h"
+#include "Core/System.h"
+
+// The watched addresses are physical, since the tests run with address translation off.
+class MemoryWatcherTest : public testing::Test
+{
+protected:
+  MemoryWatcherTest()
+      : m_system(Core::System::GetInstance()), m_directory(File::CreateTempDir()),
+        m_locations_path(m_directory + "/Locations.txt"), m_socket_path(m_directory + "/socket")
+  {
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_directory.empty());
+
+    Core::DeclareAsCPUThread();
+    Config::Init();
+    SConfig::Init();
+    m_system.GetMemory().Init();
+
+    m_socket = socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_GE(m_socket, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, m_socket_path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(0, bind(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+  }
+
+  void TearDown() override
+  {
+    if (m_socket >= 0)
+      close(m_socket);
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_directory);
+  }
+
+  MemoryWatcher CreateWatcher(const std::string& locations)
+  {
+    File::IOFile file(m_locations_path, "wb");
+    file.WriteString(locations);
+    file.Close();
+    return MemoryWatcher(m_locations_path, m_socket_path);
+  }
+
+  void Step(MemoryWatcher& watcher)
+  {
+    Core::CPUThreadGuard guard(m_system);
+    watcher.Step(guard);
+  }
+
+  // Returns the next datagram that was sent to the socket, if there is one
+  std::optional<std::vector<u8>> Receive()
+  {
+    std::vector<u8> datagram(MemoryWatcher::MAX_DATAGRAM_SIZE + 1);
+    const ssize_t size = recv(m_socket, datagram.data(), datagram.size(), MSG_DONTWAIT);
+    if (size < 0)
+      return std::nullopt;
+    datagram.resize(size);
+    return datagram;
+  }
+
+  std::optional<std::vector<u32>> ReceiveBinary()
+  {
+    const std::optional<std::vector<u8>> datagram = Receive();
+    if (!datagram)
+      return std::nullopt;
+    EXPECT_EQ(0u, datagram->size() % sizeof(u32));
+    std::vector<u32> words(datagram->size() / sizeof(u32));
+    std::memcpy(words.data(), datagram->data(), words.size() * sizeof(u32));
+    return words;
+  }
+
+  Core::System& m_system;
+  const std::string m_directory;
+  const std::string m_locations_path;
+  const std::string m_socket_path;
+  int m_socket = -1;
+};
+
+TEST_F(MemoryWatcherTest, GroupsNearbyAddresses)
+{
+  const MemoryWatcher watcher = CreateWatcher("3140\n"
+                                              "3104\n"
+                                              "3200\n"
+                                              "3100 8\n"
+                                              "3100\n"
+                                              "3104\n"
+                                              "3108\n");
+  ASSERT_TRUE(watcher.IsRunning());
+
+  // The duplicate line is skipped, and the pointer isn't part of any range. 0x3140 is within 64
+  // bytes of the end of 0x3108, but 0x3200 isn't.
+  const std::vector<MemoryWatcher::ReadRange>& ranges = watcher.GetReadRanges();
+  ASSERT_EQ(2u, ranges.size());
+  EXPECT_EQ(0x3100u, ranges[0].address);
+  EXPECT_EQ(0x44u, ranges[0].size);
+  EXPECT_EQ((std::vector<size_t>{4, 1, 5, 0}), ranges[0].watches);
+  EXPECT_EQ(0x3200u, ranges[1].address);
+  EXPECT_EQ(4u, ranges[1].size);
+  EXPECT_EQ(std::vector<size_t>{2}, ranges[1].watches);
+}
+
+TEST_F(MemoryWatcherTest, TextOutputInFileOrder)
+{
+  auto& memory = m_system.GetMemory();
+  memory.Write_U32(0x11, 0x3100);
+  memory.Write_U32(0x3200, 0x3180);
+  memory.Write_U32(0x22, 0x3200);
+  memory.Write_U32(0x33, 0x3208);
+
+  MemoryWatcher watcher = CreateWatcher("3200\n3180 8\n3100\n");
+  ASSERT_TRUE(watcher.IsRunning());
+
+  Step(watcher);
+  const std::string expected = "3200\n22\n3180 8\n33\n3100\n11\n";
+  EXPECT_EQ(std::vector<u8>(expected.c_str(), expected.c_str() + expected.size() + 1), Receive());
+
+  memory.Write_U32(0x44, 0x3100);
+  Step(watcher);
+  const std::string expected_change = "3100\n44\n";
+  EXPECT_EQ(std::vector<u8>(expected_change.c_str(),
+                            expected_change.c_str() + expected_change.size() + 1),
+            Receive());
+}
+
+TEST_F(MemoryWatcherTest, BinaryDatagrams)
+{
+  Config::SetCurrent(Config::MAIN_MEMORY_WATCHER_BINARY_OUTPUT, true);
+
+  auto& memory = m_system.GetMemory();
+  memory.Write_U32(1, 0x3100);
+  memory.Write_U32(2, 0x3104);
+  memory.Write_U32(3, 0x3108);
+
+  // Line numbers count the duplicate line
+  MemoryWatcher watcher = CreateWatcher("3104\n3100\n3100\n3108\n310C\n");
+  ASSERT_TRUE(watcher.IsRunning());
+
+  Step(watcher);
+  EXPECT_EQ((std::vector<u32>{MemoryWatcher::BINARY_MAGIC, 3, 0, 2, 1, 1, 3, 3}),
+            ReceiveBinary());
+
+  memory.Write_U32(4, 0x310C);
+  Step(watcher);
+  EXPECT_EQ((std::vector<u32>{MemoryWatcher::BINARY_MAGIC, 1, 4, 4}), ReceiveBinary());
+
+  // Nothing is sent for a sample without changes
+  Step(watcher);
+  EXPECT_EQ(std::nullopt, ReceiveBinary());
+}
+
+TEST_F(MemoryWatcherTest, BinaryDatagramsAreSplit)
+{
+  Config::SetCurrent(Config::MAIN_MEMORY_WATCHER_BINARY_OUTPUT, true);
+
+  constexpr u32 max_changes_per_datagram = (MemoryWatcher::MAX_DATAGRAM_SIZE - 8) / 8;
+  constexpr u32 watch_count = max_changes_per_datagram + 10;
+
+  auto& memory = m_system.GetMemory();
+  std::string locations;
+  for (u32 i = 0; i < watch_count; ++i)
+  {
+    const u32 address = 0x10000 + i * 4;
+    memory.Write_U32(i + 1, address);
+    locations += fmt::format("{:x}\n", address);
+  }
+
+  MemoryWatcher watcher = CreateWatcher(locations);
+  ASSERT_TRUE(watcher.IsRunning());
+  Step(watcher);
+
+  u32 next_line = 0;
+  for (const u32 expected_count :
+       {max_changes_per_datagram, watch_count - max_changes_per_datagram})
+  {
+    const std::optional<std::vector<u32>> words = ReceiveBinary();
+    ASSERT_TRUE(words);
+    ASSERT_EQ(2 + expected_count * 2, words->size());
+    EXPECT_EQ(MemoryWatcher::BINARY_MAGIC, (*words)[0]);
+    EXPECT_EQ(expected_count, (*words)[1]);
+    for (u32 i = 0; i < expected_count; ++i, ++next_line)
+    {
+      EXPECT_EQ(next_line, (*words)[2 + i * 2]);
+      EXPECT_EQ(next_line + 1, (*words)[3 + i * 2]);
+    }
+  }
+  EXPECT_EQ(std::nullopt, ReceiveBinary());
+}
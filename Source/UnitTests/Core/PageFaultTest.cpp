@@ -1,17 +1,28 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/ScopeGuard.h"
 #include "Common/Timer.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/MemTools.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
+#include "UICommon/UICommon.h"
 
 // include order is important
 #include <gtest/gtest.h>  // NOLINT
@@ -105,3 +116,73 @@ TEST(PageFault, PageFault)
 
   system.GetJitInterface().SetJit(nullptr);
 }
+
+TEST(PageFault, DirtyPageTracking)
+{
+  if (!EMM::IsExceptionHandlerProcessWide())
+    GTEST_SKIP() << "Skipping DirtyPageTracking test because exception handler is unsupported.";
+
+  const std::string profile_path = File::CreateTempDir();
+  ASSERT_FALSE(profile_path.empty());
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  Common::ScopeGuard config_guard([&profile_path] {
+    SConfig::Shutdown();
+    Config::Shutdown();
+    File::DeleteDirRecursively(profile_path);
+  });
+
+  EMM::InstallExceptionHandler();
+  Common::ScopeGuard handler_guard([] { EMM::UninstallExceptionHandler(); });
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  memory.Init();
+  Common::ScopeGuard memory_guard([&memory] { memory.Shutdown(); });
+
+  constexpr u32 page_size = Memory::MemoryManager::DIRTY_PAGE_SIZE;
+  ASSERT_TRUE(memory.EnableDirtyTracking());
+
+  perform_invalid_access(memory.GetRAM() + 3 * page_size + 8);
+  memory.Write_U32(0x12345678, 7 * page_size);
+
+  std::vector<u64> dirty_pages =
+      memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1);
+  ASSERT_FALSE(dirty_pages.empty());
+  EXPECT_EQ((u64{1} << 3) | (u64{1} << 7), dirty_pages[0]);
+  for (size_t i = 1; i < dirty_pages.size(); ++i)
+    EXPECT_EQ(0u, dirty_pages[i]);
+
+  // Fetching the dirty pages protects them again.
+  perform_invalid_access(memory.GetRAM() + 3 * page_size);
+  dirty_pages = memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1);
+  ASSERT_FALSE(dirty_pages.empty());
+  EXPECT_EQ(u64{1} << 3, dirty_pages[0]);
+  EXPECT_EQ(0x12345678u, memory.Read_U32(7 * page_size));
+
+  // Writes from other threads, like the GPU thread writing EFB copies, are caught as well.
+  std::thread writer([&memory] { perform_invalid_access(memory.GetRAM() + 9 * page_size); });
+  writer.join();
+  dirty_pages = memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1);
+  ASSERT_FALSE(dirty_pages.empty());
+  EXPECT_EQ(u64{1} << 9, dirty_pages[0]);
+
+  // System calls fail instead of faulting when they write to a protected page, so host I/O has to
+  // prepare the pages first.
+  const std::vector<u8> file_data(page_size * 2, 0xAB);
+  u8* const target = memory.GetRAM() + 11 * page_size + page_size / 2;
+  {
+    File::IOFile file(profile_path + "/host_write.bin", "w+b");
+    ASSERT_TRUE(file.WriteBytes(file_data.data(), file_data.size()));
+    ASSERT_TRUE(file.Seek(0, File::SeekOrigin::Begin));
+    memory.PrepareForHostWrite(target, file_data.size());
+    ASSERT_TRUE(file.ReadBytes(target, file_data.size()));
+  }
+  EXPECT_TRUE(std::equal(file_data.begin(), file_data.end(), target));
+  dirty_pages = memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1);
+  ASSERT_FALSE(dirty_pages.empty());
+  EXPECT_EQ(u64{7} << 11, dirty_pages[0]);
+
+  memory.DisableDirtyTracking();
+  EXPECT_TRUE(memory.FetchAndClearDirtyPages(Memory::DirtyTrackedRegion::MEM1).empty());
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/CPUCoreBase.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include <benchmark/benchmark.h>
+
+// Runs a CPU-bound loop whose body is split by a conditional branch that is almost always taken,
+// with and without hot branch following. There is no FIFO or other hardware involved, so this
+// only measures the code that the JIT emits.
+
+namespace
+{
+constexpr u32 LOOP_ADDRESS = 0x3000;
+constexpr u32 ITERATIONS = 1'000'000;
+
+// LR points at loop, so every iteration is a single block:
+// loop:  addi r3, r3, 1
+//        add r8, r8, r3
+//        cmpw r3, r4
+//        bne taken
+//        addi r5, r5, 1
+//        b join
+// taken: xor r9, r9, r8
+//        add r10, r10, r9
+//        mr r7, r3
+// join:  blr
+constexpr std::array<u32, 10> LOOP_CODE = {
+    0x38630001, 0x7D081A14, 0x7C032000, 0x4082000C, 0x38A50001,
+    0x48000010, 0x7D294278, 0x7D4A4A14, 0x7C671B78, 0x4E800020,
+};
+
+void BM_ConditionalBranchLoop(benchmark::State& state)
+{
+  auto& system = Core::System::GetInstance();
+  Core::DeclareAsCPUThread();
+  Config::Init();
+  SConfig::Init();
+  Config::SetCurrent(Config::MAIN_FASTMEM, false);
+  Config::SetCurrent(Config::MAIN_JIT_FOLLOW_HOT_BRANCHES, state.range(0) != 0);
+  system.GetMemory().Init();
+  system.GetCoreTiming().Init();
+  system.GetPowerPC().Init(PowerPC::CPUCore::JIT64);
+
+  auto& memory = system.GetMemory();
+  for (size_t i = 0; i < LOOP_CODE.size(); ++i)
+    memory.Write_U32(LOOP_CODE[i], LOOP_ADDRESS + static_cast<u32>(i * 4));
+
+  auto& ppc_state = system.GetPPCState();
+  CPUCoreBase& jit = *system.GetJitInterface().GetCore();
+  const auto run = [&] {
+    ppc_state.pc = LOOP_ADDRESS;
+    LR(ppc_state) = LOOP_ADDRESS;
+    ppc_state.gpr[3] = 0;
+    ppc_state.gpr[4] = ITERATIONS / 2;
+    while (ppc_state.gpr[3] < ITERATIONS)
+      jit.SingleStep();
+  };
+
+  // Gives the branch a chance to become hot before measuring
+  run();
+  for (auto _ : state)
+    run();
+  state.SetItemsProcessed(state.iterations() * ITERATIONS);
+
+  system.GetPowerPC().Shutdown();
+  system.GetCoreTiming().Shutdown();
+  system.GetMemory().Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+}
+}  // namespace
+
+BENCHMARK(BM_ConditionalBranchLoop)->ArgName("follow_hot_branches")->Arg(0)->Arg(1);
@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Address translation is off, so these are physical addresses
+constexpr u32 LOOP_ADDRESS = 0x3000;
+constexpr u32 FALL_THROUGH_ADDRESS = LOOP_ADDRESS + 12;
+
+// LR points at loop, so every iteration is a single block:
+// loop:  addi r3, r3, 1
+//        cmpw r3, r4
+//        bne taken
+//        addi r5, r5, 1
+//        b join
+// taken: addi r6, r6, 1
+//        mr r7, r3
+// join:  blr
+// Since r3 is still used on the taken side, it is kept in a host register across the branch.
+constexpr std::array<u32, 8> LOOP_CODE = {
+    0x38630001, 0x7C032000, 0x4082000C, 0x38A50001,
+    0x4800000C, 0x38C60001, 0x7C671B78, 0x4E800020,
+};
+}  // namespace
+
+class Jit64HotBranchFollowingTest : public testing::Test
+{
+protected:
+  Jit64HotBranchFollowingTest() : m_system(Core::System::GetInstance()) {}
+
+  void SetUp() override
+  {
+    Core::DeclareAsCPUThread();
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_FASTMEM, false);
+    Config::SetCurrent(Config::MAIN_JIT_FOLLOW_HOT_BRANCHES, true);
+    m_system.GetMemory().Init();
+    m_system.GetCoreTiming().Init();
+    m_system.GetPowerPC().Init(PowerPC::CPUCore::JIT64);
+    m_jit = dynamic_cast<Jit64*>(m_system.GetJitInterface().GetCore());
+    ASSERT_NE(nullptr, m_jit);
+
+    auto& memory = m_system.GetMemory();
+    for (size_t i = 0; i < LOOP_CODE.size(); ++i)
+      memory.Write_U32(LOOP_CODE[i], LOOP_ADDRESS + static_cast<u32>(i * 4));
+
+    auto& ppc_state = m_system.GetPPCState();
+    ppc_state.pc = LOOP_ADDRESS;
+    LR(ppc_state) = LOOP_ADDRESS;
+  }
+
+  void TearDown() override
+  {
+    m_system.GetPowerPC().Shutdown();
+    m_system.GetCoreTiming().Shutdown();
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+  }
+
+  // Runs the loop until r3 reaches the given count. Gives up after a number of time slices in case
+  // r3 got lost.
+  bool RunUntil(u32 iterations)
+  {
+    for (int i = 0; i < 1000; ++i)
+    {
+      if (m_system.GetPPCState().gpr[3] >= iterations)
+        return true;
+      m_jit->SingleStep();
+    }
+    return false;
+  }
+
+  // Whether the block of the loop contains the fall-through side of the conditional branch
+  bool LoopBlockContainsFallThrough()
+  {
+    const JitBlock* block = m_jit->GetBlockCache()->GetBlockFromStartAddress(
+        LOOP_ADDRESS, m_system.GetPPCState().msr.Hex);
+    EXPECT_NE(nullptr, block);
+    return block && std::ranges::find(block->physical_addresses, FALL_THROUGH_ADDRESS) !=
+                       block->physical_addresses.end();
+  }
+
+  Core::System& m_system;
+  Jit64* m_jit = nullptr;
+};
+
+TEST_F(Jit64HotBranchFollowingTest, SideExitKeepsRegisterState)
+{
+  auto& ppc_state = m_system.GetPPCState();
+
+  // The branch is always taken at first, and becomes hot
+  ppc_state.gpr[4] = 0xFFFFFFFF;
+  m_jit->Jit(LOOP_ADDRESS);
+  EXPECT_TRUE(LoopBlockContainsFallThrough());
+  ASSERT_TRUE(RunUntil(5000));
+  EXPECT_FALSE(LoopBlockContainsFallThrough());
+  EXPECT_EQ(0u, ppc_state.gpr[5]);
+
+  // Falling through once leaves the superblock. Everything the block did before the branch has
+  // to be written back for the block that continues at the fall-through side.
+  ppc_state.gpr[4] = ppc_state.gpr[3] + 100;
+  ASSERT_TRUE(RunUntil(ppc_state.gpr[4] + 100));
+  EXPECT_EQ(ppc_state.gpr[3], ppc_state.gpr[7]);
+  EXPECT_EQ(1u, ppc_state.gpr[5]);
+  EXPECT_EQ(ppc_state.gpr[3], ppc_state.gpr[5] + ppc_state.gpr[6]);
+  EXPECT_FALSE(LoopBlockContainsFallThrough());
+}
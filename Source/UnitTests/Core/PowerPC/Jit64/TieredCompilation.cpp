@@ -0,0 +1,164 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Address translation is off, so these are physical addresses
+constexpr u32 LOOP_ADDRESS = 0x3000;
+constexpr u32 OTHER_ADDRESS = 0x3100;
+
+constexpr u32 ADDI_R3_R3_1 = 0x38630001;
+constexpr u32 B_FORWARD_12 = 0x4800000C;
+constexpr u32 B_BACK_16 = 0x4BFFFFF0;
+}  // namespace
+
+class Jit64TieredCompilationTest : public testing::Test
+{
+protected:
+  Jit64TieredCompilationTest() : m_system(Core::System::GetInstance()) {}
+
+  void SetUp() override
+  {
+    Core::DeclareAsCPUThread();
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_FASTMEM, false);
+    Config::SetCurrent(Config::MAIN_JIT_TIERED_COMPILATION, true);
+    m_system.GetMemory().Init();
+    m_system.GetCoreTiming().Init();
+    m_system.GetPowerPC().Init(PowerPC::CPUCore::JIT64);
+    m_jit = dynamic_cast<Jit64*>(m_system.GetJitInterface().GetCore());
+    ASSERT_NE(nullptr, m_jit);
+
+    // A loop whose first block ends with a branch, which only the hot tier follows:
+    //   loop:  addi r3, r3, 1
+    //          b next
+    //   next:  b loop
+    auto& memory = m_system.GetMemory();
+    memory.Write_U32(ADDI_R3_R3_1, LOOP_ADDRESS);
+    memory.Write_U32(B_FORWARD_12, LOOP_ADDRESS + 4);
+    memory.Write_U32(B_BACK_16, LOOP_ADDRESS + 16);
+    memory.Write_U32(ADDI_R3_R3_1, OTHER_ADDRESS);
+    memory.Write_U32(B_FORWARD_12, OTHER_ADDRESS + 4);
+  }
+
+  void TearDown() override
+  {
+    m_system.GetPowerPC().Shutdown();
+    m_system.GetCoreTiming().Shutdown();
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+  }
+
+  JitBlock* GetBlock(u32 address)
+  {
+    return m_jit->GetBlockCache()->GetBlockFromStartAddress(address,
+                                                            m_system.GetPPCState().msr.Hex);
+  }
+
+  // Acts like the cold block at the given address reaching the end of its countdown
+  bool Promote(u32 address)
+  {
+    m_system.GetPPCState().pc = address;
+    return Jit64::PromoteHotBlock(*m_jit);
+  }
+
+  Core::System& m_system;
+  Jit64* m_jit = nullptr;
+};
+
+TEST_F(Jit64TieredCompilationTest, HotBlocksAreCompiledWhileIdle)
+{
+  m_jit->Jit(LOOP_ADDRESS);
+  const JitBlock* cold = GetBlock(LOOP_ADDRESS);
+  ASSERT_NE(nullptr, cold);
+  EXPECT_EQ(2u, cold->originalSize);
+  EXPECT_GT(cold->tier_countdown, 0u);
+
+  // Queued blocks keep running in the cold tier until there is time to compile them
+  EXPECT_FALSE(Promote(LOOP_ADDRESS));
+  EXPECT_EQ(cold, GetBlock(LOOP_ADDRESS));
+  m_jit->CompileHotBlocks(Clock::now() - std::chrono::seconds(1));
+  EXPECT_EQ(cold, GetBlock(LOOP_ADDRESS));
+
+  m_jit->CompileHotBlocks(Clock::now() + std::chrono::minutes(1));
+  const JitBlock* hot = GetBlock(LOOP_ADDRESS);
+  ASSERT_NE(nullptr, hot);
+  EXPECT_GT(hot->originalSize, 2u);
+
+  // The queue is empty now
+  m_jit->Jit(OTHER_ADDRESS);
+  const JitBlock* other = GetBlock(OTHER_ADDRESS);
+  m_jit->CompileHotBlocks(Clock::now() + std::chrono::minutes(1));
+  EXPECT_EQ(other, GetBlock(OTHER_ADDRESS));
+  EXPECT_EQ(hot, GetBlock(LOOP_ADDRESS));
+}
+
+TEST_F(Jit64TieredCompilationTest, PromotesRightAwayWithoutIdleTime)
+{
+  m_jit->Jit(LOOP_ADDRESS);
+  m_jit->Jit(OTHER_ADDRESS);
+  const JitBlock* other = GetBlock(OTHER_ADDRESS);
+
+  EXPECT_FALSE(Promote(LOOP_ADDRESS));
+  EXPECT_TRUE(Promote(LOOP_ADDRESS));
+  EXPECT_EQ(nullptr, GetBlock(LOOP_ADDRESS));
+  EXPECT_EQ(other, GetBlock(OTHER_ADDRESS));
+
+  // The dispatcher compiles the hot version, and the block was taken out of the queue
+  m_jit->Jit(LOOP_ADDRESS);
+  const JitBlock* hot = GetBlock(LOOP_ADDRESS);
+  ASSERT_NE(nullptr, hot);
+  EXPECT_GT(hot->originalSize, 2u);
+  m_jit->CompileHotBlocks(Clock::now() + std::chrono::minutes(1));
+  EXPECT_EQ(hot, GetBlock(LOOP_ADDRESS));
+}
+
+TEST_F(Jit64TieredCompilationTest, BlocksForOtherMSRBitsStayQueued)
+{
+  m_jit->Jit(LOOP_ADDRESS);
+  const JitBlock* cold = GetBlock(LOOP_ADDRESS);
+  EXPECT_FALSE(Promote(LOOP_ADDRESS));
+
+  // The hot block would have to be compiled for the MSR of the cold block
+  auto& ppc_state = m_system.GetPPCState();
+  ppc_state.msr.DR = 1;
+  m_jit->CompileHotBlocks(Clock::now() + std::chrono::minutes(1));
+  ppc_state.msr.DR = 0;
+  EXPECT_EQ(cold, GetBlock(LOOP_ADDRESS));
+
+  EXPECT_TRUE(Promote(LOOP_ADDRESS));
+  EXPECT_EQ(nullptr, GetBlock(LOOP_ADDRESS));
+}
+
+TEST_F(Jit64TieredCompilationTest, CountsExecutions)
+{
+  // Runs one time slice of the loop. Without any throttling, the loop block reaches the end of its
+  // countdown twice within it, and is recompiled in the hot tier on the spot the second time.
+  auto& ppc_state = m_system.GetPPCState();
+  ppc_state.pc = LOOP_ADDRESS;
+  m_jit->SingleStep();
+
+  const JitBlock* hot = GetBlock(LOOP_ADDRESS);
+  ASSERT_NE(nullptr, hot);
+  EXPECT_GT(hot->originalSize, 2u);
+  EXPECT_GT(ppc_state.gpr[3], 2000u);
+}
@@ -0,0 +1,158 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+using DiskKey = JitBlockDiskCache::DiskKey;
+using EntryMap = JitBlockDiskCache::EntryMap;
+
+namespace
+{
+DiskKey Key(u32 address)
+{
+  return DiskKey{address, 0, address, 0, u64(address) * 0x9e3779b97f4a7c15};
+}
+
+EntryMap Entries(std::initializer_list<u32> addresses)
+{
+  EntryMap entries;
+  for (const u32 address : addresses)
+    entries.emplace(Key(address), std::vector<u32>{address, address + 4});
+  return entries;
+}
+
+class NullReader final : public Common::LinearDiskCacheReader<DiskKey, u32>
+{
+public:
+  void Read(const DiskKey&, const u32*, u32) override {}
+};
+}  // namespace
+
+class JitBlockDiskCacheTest : public testing::Test
+{
+protected:
+  JitBlockDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_file_path(m_directory + "/blocks.cache")
+  {
+  }
+
+  ~JitBlockDiskCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  // Writes a file containing the given entries, in order and including duplicates
+  void WriteFile(const std::vector<u32>& addresses)
+  {
+    Common::LinearDiskCache<DiskKey, u32> disk_cache;
+    NullReader reader;
+    disk_cache.OpenAndRead(m_file_path, reader);
+    for (const u32 address : addresses)
+    {
+      const std::vector<u32> physical_addresses{address, address + 4};
+      disk_cache.Append(Key(address), physical_addresses.data(),
+                        static_cast<u32>(physical_addresses.size()));
+    }
+    disk_cache.Close();
+  }
+
+  const std::string m_directory;
+  const std::string m_file_path;
+  JitBlockDiskCache m_cache;
+};
+
+TEST_F(JitBlockDiskCacheTest, AppendsNewEntries)
+{
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(0u, m_cache.GetRecordsOnDisk());
+  m_cache.Close(Entries({0x80003100, 0x80003200}));
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(2u, m_cache.GetRecordsOnDisk());
+  EXPECT_EQ(Entries({0x80003100, 0x80003200}), m_cache.GetEntries());
+  m_cache.Close(Entries({0x80003200, 0x80003300}));
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(3u, m_cache.GetRecordsOnDisk());
+  EXPECT_EQ(Entries({0x80003100, 0x80003200, 0x80003300}), m_cache.GetEntries());
+  m_cache.Close({});
+}
+
+TEST_F(JitBlockDiskCacheTest, StaleEntryCompiledLaterIsNotAppendedAgain)
+{
+  // Like a block in an overlay which isn't loaded yet at boot
+  WriteFile({0x80003100, 0x80003200, 0x80003300, 0x80003400});
+
+  for (int session = 0; session < 3; ++session)
+  {
+    m_cache.Open(m_file_path);
+    EXPECT_EQ(4u, m_cache.GetRecordsOnDisk());
+    m_cache.MarkStale(Key(0x80003100));
+    m_cache.Close(Entries({0x80003100}));
+  }
+}
+
+TEST_F(JitBlockDiskCacheTest, RewritesWhenStaleEntriesPileUp)
+{
+  WriteFile({0x80003100, 0x80003200, 0x80003300, 0x80003400});
+
+  m_cache.Open(m_file_path);
+  m_cache.MarkStale(Key(0x80003100));
+  m_cache.MarkStale(Key(0x80003200));
+  m_cache.Close(Entries({0x80003500}));
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(3u, m_cache.GetRecordsOnDisk());
+  EXPECT_EQ(Entries({0x80003300, 0x80003400, 0x80003500}), m_cache.GetEntries());
+  m_cache.Close({});
+}
+
+TEST_F(JitBlockDiskCacheTest, RewritesWhenDuplicatesPileUp)
+{
+  WriteFile({0x80003100, 0x80003100, 0x80003200, 0x80003200});
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(4u, m_cache.GetRecordsOnDisk());
+  EXPECT_EQ(Entries({0x80003100, 0x80003200}), m_cache.GetEntries());
+  m_cache.Close({});
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(2u, m_cache.GetRecordsOnDisk());
+  EXPECT_EQ(Entries({0x80003100, 0x80003200}), m_cache.GetEntries());
+  m_cache.Close({});
+}
+
+TEST_F(JitBlockDiskCacheTest, StaysBelowMaxEntries)
+{
+  EntryMap live_entries;
+  for (u32 i = 0; i < JitBlockDiskCache::MAX_ENTRIES + 16; ++i)
+    live_entries.emplace(Key(0x80003100 + i * 4), std::vector<u32>{0x3100 + i * 4});
+
+  m_cache.Open(m_file_path);
+  m_cache.Close(live_entries);
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(JitBlockDiskCache::MAX_ENTRIES, m_cache.GetRecordsOnDisk());
+  m_cache.Close(Entries({0x90000000}));
+
+  m_cache.Open(m_file_path);
+  EXPECT_EQ(JitBlockDiskCache::MAX_ENTRIES, m_cache.GetRecordsOnDisk());
+  EXPECT_TRUE(m_cache.GetEntries().contains(Key(0x90000000)));
+  m_cache.Close({});
+}
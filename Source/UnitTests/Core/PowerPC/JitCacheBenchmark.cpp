@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/System.h"
+
+#include "TestBlockCache.h"
+
+// Replays the invalidation patterns that games cause on a block cache that is filled like it would
+// be after playing for a while: 4 MiB of code split into blocks of 4 to 32 instructions, each
+// linked to the next block and to a random other one.
+
+namespace
+{
+constexpr u32 CODE_START = 0x3100;
+constexpr u32 CODE_END = 0x403100;
+
+struct BlockLayout
+{
+  u32 address;
+  std::set<u32> instructions;
+  std::vector<u32> exits;
+};
+
+const std::vector<BlockLayout>& GetLayout()
+{
+  static const std::vector<BlockLayout> layout = [] {
+    std::mt19937 rng(1234);
+    std::vector<BlockLayout> blocks;
+    for (u32 address = CODE_START; address < CODE_END;)
+    {
+      const u32 count = std::uniform_int_distribution<u32>(4, 32)(rng);
+      blocks.push_back({address, Instructions(address, count), {}});
+      address += count * 4;
+    }
+    std::uniform_int_distribution<size_t> random_block(0, blocks.size() - 1);
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+      blocks[i].exits.push_back(blocks[(i + 1) % blocks.size()].address);
+      blocks[i].exits.push_back(blocks[random_block(rng)].address);
+    }
+    return blocks;
+  }();
+  return layout;
+}
+
+void FillCache(TestBlockCache& cache)
+{
+  cache.record_links = false;
+  for (const BlockLayout& block : GetLayout())
+    cache.AddBlock(block.address, block.instructions, block.exits);
+}
+
+// Compiles the blocks of the given range again, like the game would cause after invalidating it
+void Recompile(TestBlockCache& cache, u32 address, u32 length)
+{
+  const std::vector<BlockLayout>& layout = GetLayout();
+  auto it = std::upper_bound(layout.begin(), layout.end(), address,
+                             [](u32 a, const BlockLayout& block) { return a < block.address; });
+  if (it != layout.begin())
+    --it;
+  for (; it != layout.end() && it->address < address + length; ++it)
+  {
+    if (!cache.GetBlockFromStartAddress(it->address, 0))
+      cache.AddBlock(it->address, it->instructions, it->exits);
+  }
+}
+
+// DMA or memcpy over code, as when a game loads an overlay: one big invalidation
+void BM_EraseRange(benchmark::State& state)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+  FillCache(cache);
+
+  const u32 length = static_cast<u32>(state.range(0));
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<u32> random_offset(0, (CODE_END - CODE_START - length) / 32);
+  for (auto _ : state)
+  {
+    const u32 address = CODE_START + random_offset(rng) * 32;
+    cache.ErasePhysicalRange(address, length);
+
+    state.PauseTiming();
+    Recompile(cache, address, length);
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_EraseRange)->Arg(0x20)->Arg(0x1000)->Arg(0x8000);
+
+// icbi over every cache line of a freshly loaded page, which is how most games flush the
+// instruction cache after loading code
+void BM_InvalidateICacheLines(benchmark::State& state)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+  FillCache(cache);
+
+  constexpr u32 PAGE_SIZE = 0x1000;
+  u32 page = CODE_START & ~(PAGE_SIZE - 1);
+  for (auto _ : state)
+  {
+    for (u32 line = 0; line < PAGE_SIZE; line += 32)
+      cache.InvalidateICacheLine(page + line);
+
+    state.PauseTiming();
+    Recompile(cache, page, PAGE_SIZE);
+    page += PAGE_SIZE;
+    if (page >= CODE_END)
+      page = CODE_START & ~(PAGE_SIZE - 1);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * (PAGE_SIZE / 32));
+}
+BENCHMARK(BM_InvalidateICacheLines);
+
+// Self-modifying code that patches single instructions: one block is destroyed and compiled
+// again, which unlinks and relinks everything that jumps to it
+void BM_RecompileSingleBlock(benchmark::State& state)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+  FillCache(cache);
+
+  const std::vector<BlockLayout>& layout = GetLayout();
+  std::mt19937 rng(9012);
+  std::uniform_int_distribution<size_t> random_block(0, layout.size() - 1);
+  for (auto _ : state)
+  {
+    const BlockLayout& block = layout[random_block(rng)];
+    cache.ErasePhysicalRange(block.address, 4);
+    cache.AddBlock(block.address, block.instructions, block.exits);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecompileSingleBlock);
+}  // namespace
@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/System.h"
+
+#include "TestBlockCache.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using Link = std::pair<const JitBlock::LinkData*, const JitBlock*>;
+
+size_t CountBlocks(TestBlockCache& cache)
+{
+  size_t count = 0;
+  cache.RunOnBlocks([&](const JitBlock&) { ++count; });
+  return count;
+}
+}  // namespace
+
+TEST(JitCache, OverlapsPhysicalRange)
+{
+  JitBlock block;
+  block.physical_addresses = {0x3000, 0x3004, 0x3100};
+  EXPECT_TRUE(block.OverlapsPhysicalRange(0x3000, 4));
+  EXPECT_TRUE(block.OverlapsPhysicalRange(0x2ffc, 8));
+  EXPECT_TRUE(block.OverlapsPhysicalRange(0x3008, 0x100));
+  EXPECT_FALSE(block.OverlapsPhysicalRange(0x2ffc, 4));
+  EXPECT_FALSE(block.OverlapsPhysicalRange(0x3008, 0xf8));
+  EXPECT_FALSE(block.OverlapsPhysicalRange(0x3104, 0x100));
+}
+
+TEST(JitCache, EraseDestroysOnlyOverlappingBlocks)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+
+  // The second block crosses from the 0x3000 macro block into the 0x3100 one
+  JitBlock* first = cache.AddBlock(0x3000, Instructions(0x3000, 16));
+  cache.AddBlock(0x30f0, Instructions(0x30f0, 16));
+  JitBlock* third = cache.AddBlock(0x3140, Instructions(0x3140, 4));
+  EXPECT_EQ(3u, CountBlocks(cache));
+
+  cache.ErasePhysicalRange(0x3120, 4);
+  EXPECT_EQ(1u, cache.destroyed_blocks);
+  EXPECT_EQ(first, cache.GetBlockFromStartAddress(0x3000, 0));
+  EXPECT_EQ(nullptr, cache.GetBlockFromStartAddress(0x30f0, 0));
+  EXPECT_EQ(third, cache.GetBlockFromStartAddress(0x3140, 0));
+
+  // The destroyed block must be gone from the other macro block too
+  cache.ErasePhysicalRange(0x30f0, 4);
+  EXPECT_EQ(1u, cache.destroyed_blocks);
+  EXPECT_EQ(2u, CountBlocks(cache));
+
+  cache.ErasePhysicalRange(0x3000, 0x200);
+  EXPECT_EQ(3u, cache.destroyed_blocks);
+  EXPECT_EQ(0u, CountBlocks(cache));
+}
+
+TEST(JitCache, BlockInSeveralMacroBlocksIsDestroyedOnce)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+
+  // 0x3080 to 0x327c, so the block is in three macro blocks. The instructions don't have to be
+  // contiguous, as with blocks that follow branches.
+  std::set<u32> instructions = Instructions(0x3080, 16);
+  instructions.merge(Instructions(0x3200, 32));
+  cache.AddBlock(0x3080, instructions);
+  cache.AddBlock(0x3400, Instructions(0x3400, 8));
+
+  cache.ErasePhysicalRange(0x3000, 0x400);
+  EXPECT_EQ(1u, cache.destroyed_blocks);
+  EXPECT_EQ(1u, CountBlocks(cache));
+
+  // Invalidating the gap between the instructions doesn't destroy a block
+  cache.AddBlock(0x3080, instructions);
+  cache.ErasePhysicalRange(0x3100, 0x100);
+  EXPECT_EQ(1u, cache.destroyed_blocks);
+  EXPECT_EQ(2u, CountBlocks(cache));
+}
+
+TEST(JitCache, LinksFollowTheDestination)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+
+  JitBlock* source = cache.AddBlock(0x3000, Instructions(0x3000, 4), {0x4000});
+  EXPECT_FALSE(source->linkData[0].linkStatus);
+
+  JitBlock* destination = cache.AddBlock(0x4000, Instructions(0x4000, 4));
+  EXPECT_TRUE(source->linkData[0].linkStatus);
+  ASSERT_FALSE(cache.written_links.empty());
+  EXPECT_EQ(Link(&source->linkData[0], destination), cache.written_links.back());
+
+  cache.written_links.clear();
+  cache.ErasePhysicalRange(0x4000, 4);
+  EXPECT_FALSE(source->linkData[0].linkStatus);
+  EXPECT_NE(cache.written_links.end(), std::find(cache.written_links.begin(),
+                                                 cache.written_links.end(),
+                                                 Link(&source->linkData[0], nullptr)));
+
+  destination = cache.AddBlock(0x4000, Instructions(0x4000, 4));
+  EXPECT_TRUE(source->linkData[0].linkStatus);
+  EXPECT_EQ(destination, cache.written_links.back().second);
+}
+
+TEST(JitCache, DestroyedSourceIsForgotten)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+
+  cache.AddBlock(0x3000, Instructions(0x3000, 4), {0x4000});
+  cache.AddBlock(0x3100, Instructions(0x3100, 4), {0x4000});
+  cache.AddBlock(0x4000, Instructions(0x4000, 4));
+  cache.ErasePhysicalRange(0x3000, 4);
+
+  // Only the remaining source gets unlinked
+  cache.written_links.clear();
+  cache.ErasePhysicalRange(0x4000, 4);
+  ASSERT_EQ(1u, cache.written_links.size());
+  EXPECT_EQ(0x4000u, cache.written_links[0].first->exitAddress);
+  EXPECT_EQ(nullptr, cache.written_links[0].second);
+  EXPECT_EQ(cache.GetBlockFromStartAddress(0x3100, 0)->linkData.data(),
+            cache.written_links[0].first);
+}
+
+TEST(JitCache, InvalidateICacheLine)
+{
+  TestJit jit(Core::System::GetInstance());
+  TestBlockCache& cache = *jit.GetBlockCache();
+
+  cache.AddBlock(0x3000, Instructions(0x3000, 16));
+
+  // The line after the block
+  cache.InvalidateICacheLine(0x3040);
+  EXPECT_EQ(0u, cache.destroyed_blocks);
+
+  cache.InvalidateICacheLine(0x3024);
+  EXPECT_EQ(1u, cache.destroyed_blocks);
+  EXPECT_EQ(0u, CountBlocks(cache));
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/System.h"
+
+namespace
+{
+// Address translation is off, so this is a physical address
+constexpr u32 CODE_ADDRESS = 0x3000;
+constexpr u32 BNE_ADDRESS = CODE_ADDRESS + 8;
+
+//        addi r3, r3, 1
+//        cmpw r3, r4
+//        bne taken
+//        addi r5, r5, 1
+//        b join
+// taken: addi r6, r6, 1
+// join:  blr
+constexpr std::array<u32, 7> CODE = {
+    0x38630001, 0x7C032000, 0x4082000C, 0x38A50001, 0x48000008, 0x38C60001, 0x4E800020,
+};
+}  // namespace
+
+class PPCAnalystTest : public testing::Test
+{
+protected:
+  PPCAnalystTest() : m_system(Core::System::GetInstance()) {}
+
+  void SetUp() override
+  {
+    Core::DeclareAsCPUThread();
+    Config::Init();
+    SConfig::Init();
+    m_system.GetMemory().Init();
+
+    auto& memory = m_system.GetMemory();
+    for (size_t i = 0; i < CODE.size(); ++i)
+      memory.Write_U32(CODE[i], CODE_ADDRESS + static_cast<u32>(i * 4));
+
+    m_block.m_stats = &m_stats;
+    m_block.m_gpa = &m_gpa;
+    m_block.m_fpa = &m_fpa;
+
+    m_analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
+    m_analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    m_analyzer.SetBranchFollowingEnabled(true);
+    m_analyzer.SetHotBranches(&m_hot_branches);
+  }
+
+  void TearDown() override
+  {
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+  }
+
+  // Returns the addresses of the instructions in the block, in the order they were analyzed
+  std::vector<u32> Analyze()
+  {
+    m_analyzer.Analyze(CODE_ADDRESS, &m_block, &m_buffer, m_buffer.size());
+    std::vector<u32> addresses;
+    for (u32 i = 0; i < m_block.m_num_instructions; ++i)
+      addresses.push_back(m_buffer[i].address);
+    return addresses;
+  }
+
+  const PPCAnalyst::CodeOp* FindOp(u32 address) const
+  {
+    for (u32 i = 0; i < m_block.m_num_instructions; ++i)
+    {
+      if (m_buffer[i].address == address)
+        return &m_buffer[i];
+    }
+    return nullptr;
+  }
+
+  Core::System& m_system;
+  PPCAnalyst::PPCAnalyzer m_analyzer;
+  PPCAnalyst::CodeBlock m_block;
+  PPCAnalyst::BlockStats m_stats;
+  PPCAnalyst::BlockRegStats m_gpa;
+  PPCAnalyst::BlockRegStats m_fpa;
+  PPCAnalyst::CodeBuffer m_buffer = PPCAnalyst::CodeBuffer(32);
+  std::unordered_set<u32> m_hot_branches;
+};
+
+TEST_F(PPCAnalystTest, ConditionalBranchContinuesOnFallThrough)
+{
+  const std::vector<u32> addresses = Analyze();
+  EXPECT_EQ((std::vector<u32>{0x3000, 0x3004, 0x3008, 0x300C, 0x3010, 0x3018}), addresses);
+
+  const PPCAnalyst::CodeOp* bne = FindOp(BNE_ADDRESS);
+  ASSERT_NE(nullptr, bne);
+  EXPECT_FALSE(bne->conditionalBranchFollowed);
+  EXPECT_EQ(0x3014u, bne->branchTo);
+}
+
+TEST_F(PPCAnalystTest, HotBranchIsFollowed)
+{
+  m_hot_branches.insert(BNE_ADDRESS);
+  const std::vector<u32> addresses = Analyze();
+
+  // The fall-through side is left out of the block, so not branching has to exit it
+  EXPECT_EQ((std::vector<u32>{0x3000, 0x3004, 0x3008, 0x3014, 0x3018}), addresses);
+  const PPCAnalyst::CodeOp* bne = FindOp(BNE_ADDRESS);
+  ASSERT_NE(nullptr, bne);
+  EXPECT_TRUE(bne->conditionalBranchFollowed);
+  EXPECT_EQ(0x3014u, bne->branchTo);
+  EXPECT_EQ(nullptr, FindOp(0x300C));
+}
+
+TEST_F(PPCAnalystTest, HotBranchNeedsBranchFollowing)
+{
+  m_hot_branches.insert(BNE_ADDRESS);
+  m_analyzer.SetBranchFollowingEnabled(false);
+  Analyze();
+
+  const PPCAnalyst::CodeOp* bne = FindOp(BNE_ADDRESS);
+  ASSERT_NE(nullptr, bne);
+  EXPECT_FALSE(bne->conditionalBranchFollowed);
+  EXPECT_NE(nullptr, FindOp(0x300C));
+}
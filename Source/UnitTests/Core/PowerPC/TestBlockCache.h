@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+// A block cache that doesn't emit any code. Instead, it records the links it would have written.
+class TestBlockCache final : public JitBaseBlockCache
+{
+public:
+  using JitBaseBlockCache::JitBaseBlockCache;
+
+  // Adds a block that starts at address, consists of the given instructions and exits to the given
+  // addresses. The MSR is left alone, so address translation is off and the addresses are physical.
+  JitBlock* AddBlock(u32 address, const std::set<u32>& instructions,
+                     const std::vector<u32>& exits = {})
+  {
+    JitBlock* block = AllocateBlock(address);
+    block->normalEntry = nullptr;
+    block->codeSize = 0;
+    block->originalSize = static_cast<u32>(instructions.size());
+    for (const u32 exit : exits)
+    {
+      JitBlock::LinkData link{};
+      link.exitAddress = exit;
+      block->linkData.push_back(link);
+    }
+    FinalizeBlock(*block, true, instructions);
+    return block;
+  }
+
+  // The source exit and the destination block of every WriteLinkBlock call, if record_links is set
+  std::vector<std::pair<const JitBlock::LinkData*, const JitBlock*>> written_links;
+  bool record_links = true;
+  size_t destroyed_blocks = 0;
+
+protected:
+  void DestroyBlock(JitBlock& block) override
+  {
+    JitBaseBlockCache::DestroyBlock(block);
+    ++destroyed_blocks;
+  }
+
+private:
+  void WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest) override
+  {
+    if (record_links)
+      written_links.emplace_back(&source, dest);
+  }
+};
+
+class TestJit final : public JitBase
+{
+public:
+  explicit TestJit(Core::System& system) : JitBase(system), m_block_cache(*this)
+  {
+    m_block_cache.Init();
+  }
+  ~TestJit() override { m_block_cache.Shutdown(); }
+
+  void Init() override {}
+  void Shutdown() override {}
+  void ClearCache() override { m_block_cache.Clear(); }
+  void Run() override {}
+  void SingleStep() override {}
+  const char* GetName() const override { return "TestJit"; }
+
+  TestBlockCache* GetBlockCache() override { return &m_block_cache; }
+  void Jit(u32 em_address) override {}
+  const CommonAsmRoutinesBase* GetAsmRoutines() override { return nullptr; }
+  bool HandleFault(uintptr_t access_address, SContext* ctx) override { return false; }
+
+private:
+  TestBlockCache m_block_cache;
+};
+
+// Returns the instruction addresses of a block with count instructions starting at address
+inline std::set<u32> Instructions(u32 address, u32 count)
+{
+  std::set<u32> instructions;
+  for (u32 i = 0; i < count; ++i)
+    instructions.insert(address + i * 4);
+  return instructions;
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+// Measures how long taking a rewind snapshot blocks the CPU thread, for a Wii-sized set of regions
+// (a small serialized state, MEM1 and MEM2) of which a game writes to a few pages per frame.
+
+namespace
+{
+constexpr size_t STATE_SIZE = 2 * 1024 * 1024;
+constexpr size_t MEM1_SIZE = 24 * 1024 * 1024;
+constexpr size_t MEM2_SIZE = 64 * 1024 * 1024;
+// The granularity of MEM1 and MEM2 dirty tracking
+constexpr size_t DIRTY_PAGE_SIZE = 0x4000;
+constexpr u32 KEYFRAME_INTERVAL = 30;
+constexpr u64 MEMORY_BUDGET = u64{1} << 30;
+
+enum class Capture
+{
+  // Copies all regions into a snapshot first, and compares all of them
+  CopyAll,
+  // Passes the regions as they are, and compares all of them
+  Compare,
+  // Passes the regions as they are, along with the pages that dirty tracking reports
+  DirtyTracked,
+};
+
+class GuestMemory
+{
+public:
+  GuestMemory() : m_regions{std::vector<u8>(STATE_SIZE), std::vector<u8>(MEM1_SIZE),
+                            std::vector<u8>(MEM2_SIZE)}
+  {
+  }
+
+  // Writes to dirty_pages pages of MEM1 and of MEM2, spread over the whole region
+  void RunFrame(u64 frame, u32 dirty_pages)
+  {
+    m_regions[0][frame % STATE_SIZE] = static_cast<u8>(frame);
+    m_changed_pages.assign(3, {});
+    for (size_t i = 1; i < m_regions.size(); ++i)
+    {
+      std::vector<u8>& region = m_regions[i];
+      const size_t page_count = region.size() / DIRTY_PAGE_SIZE;
+      State::RewindBuffer::ChangedPages& changes = m_changed_pages[i];
+      changes.page_size = DIRTY_PAGE_SIZE;
+      changes.bitmap.assign((page_count + 63) / 64, 0);
+      for (u32 j = 0; j < dirty_pages; ++j)
+      {
+        const size_t page = (frame * 7919 + j * 104729) % page_count;
+        region[page * DIRTY_PAGE_SIZE + frame % DIRTY_PAGE_SIZE] = static_cast<u8>(frame);
+        changes.bitmap[page / 64] |= u64{1} << (page % 64);
+      }
+    }
+  }
+
+  void Capture(State::RewindBuffer& buffer, u64 frame, Capture capture) const
+  {
+    switch (capture)
+    {
+    case Capture::CopyAll:
+    {
+      const State::RewindBuffer::Snapshot copy = m_regions;
+      buffer.Push(frame, {copy.begin(), copy.end()});
+      break;
+    }
+    case Capture::Compare:
+      buffer.Push(frame, {m_regions.begin(), m_regions.end()});
+      break;
+    case Capture::DirtyTracked:
+      buffer.Push(frame, {m_regions.begin(), m_regions.end()}, m_changed_pages);
+      break;
+    }
+  }
+
+private:
+  State::RewindBuffer::Snapshot m_regions;
+  std::vector<State::RewindBuffer::ChangedPages> m_changed_pages;
+};
+
+void BM_Capture(benchmark::State& state, Capture capture)
+{
+  const u32 dirty_pages = static_cast<u32>(state.range(0));
+  GuestMemory memory;
+  State::RewindBuffer buffer(MEMORY_BUDGET, KEYFRAME_INTERVAL);
+
+  u64 frame = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    memory.RunFrame(++frame, dirty_pages);
+    state.ResumeTiming();
+
+    memory.Capture(buffer, frame, capture);
+  }
+  state.counters["memory_mib"] = double(buffer.GetMemoryUsage()) / (1024 * 1024);
+}
+
+void BM_Rewind(benchmark::State& state)
+{
+  GuestMemory memory;
+  State::RewindBuffer buffer(MEMORY_BUDGET, KEYFRAME_INTERVAL);
+  for (u64 frame = 1; frame <= KEYFRAME_INTERVAL; ++frame)
+  {
+    memory.RunFrame(frame, 64);
+    memory.Capture(buffer, frame, Capture::DirtyTracked);
+  }
+
+  // Rewinding to the newest snapshot applies every delta since the keyframe and discards nothing
+  State::RewindBuffer::Snapshot snapshot;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(buffer.Rewind(KEYFRAME_INTERVAL, snapshot));
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Capture, CopyAll, Capture::CopyAll)
+    ->ArgName("dirty_pages")
+    ->Arg(64)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Capture, Compare, Capture::Compare)
+    ->ArgName("dirty_pages")
+    ->Arg(64)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Capture, DirtyTracked, Capture::DirtyTracked)
+    ->ArgName("dirty_pages")
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Rewind)->Unit(benchmark::kMillisecond);
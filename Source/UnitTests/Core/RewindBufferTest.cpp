@@ -0,0 +1,177 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+constexpr size_t PAGE_SIZE = State::RewindBuffer::DELTA_PAGE_SIZE;
+constexpr size_t TAIL_SIZE = 100;
+constexpr size_t MEMORY_SIZE = PAGE_SIZE * 16 + 100;
+constexpr size_t SNAPSHOT_SIZE = TAIL_SIZE + MEMORY_SIZE;
+
+// A small serialized part followed by a fixed-size memory region. Every frame changes one byte in
+// one page of the memory region, so that most of the snapshot stays the same.
+State::RewindBuffer::Snapshot MakeSnapshot(u64 frame, size_t tail_size = TAIL_SIZE)
+{
+  State::RewindBuffer::Snapshot snapshot{std::vector<u8>(tail_size, static_cast<u8>(frame)),
+                                         std::vector<u8>(MEMORY_SIZE)};
+  for (u64 i = 1; i <= frame; ++i)
+    snapshot[1][(i * PAGE_SIZE + i) % MEMORY_SIZE] = static_cast<u8>(i);
+  return snapshot;
+}
+
+State::RewindBuffer::SnapshotView View(const State::RewindBuffer::Snapshot& snapshot)
+{
+  return {snapshot.begin(), snapshot.end()};
+}
+}  // namespace
+
+TEST(RewindBuffer, Empty)
+{
+  State::RewindBuffer buffer(1 << 20, 4);
+  State::RewindBuffer::Snapshot snapshot;
+
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_EQ(std::nullopt, buffer.Rewind(100, snapshot));
+}
+
+TEST(RewindBuffer, ReconstructsEverySnapshot)
+{
+  for (u64 target = 1; target <= 20; ++target)
+  {
+    State::RewindBuffer buffer(1 << 20, 4);
+    for (u64 frame = 1; frame <= 20; ++frame)
+      buffer.Push(frame, View(MakeSnapshot(frame)));
+
+    State::RewindBuffer::Snapshot snapshot;
+    EXPECT_EQ(target, buffer.Rewind(target, snapshot));
+    EXPECT_EQ(MakeSnapshot(target), snapshot);
+    EXPECT_EQ(target, buffer.GetSnapshotCount());
+  }
+}
+
+TEST(RewindBuffer, StoresDeltas)
+{
+  State::RewindBuffer buffer(1 << 20, 8);
+  for (u64 frame = 1; frame <= 8; ++frame)
+    buffer.Push(frame, View(MakeSnapshot(frame)));
+
+  // One keyframe and seven deltas of a single page of each region.
+  EXPECT_EQ(SNAPSHOT_SIZE + 7 * (TAIL_SIZE + PAGE_SIZE + 2 * sizeof(u32)),
+            buffer.GetMemoryUsage());
+}
+
+TEST(RewindBuffer, RegionsAreDiffedIndependently)
+{
+  State::RewindBuffer buffer(1 << 20, 8);
+  for (u64 frame = 1; frame <= 8; ++frame)
+    buffer.Push(frame, View(MakeSnapshot(frame, TAIL_SIZE + frame)));
+
+  // The tail changes size every frame and is stored in full, but that doesn't stop the memory
+  // region from being stored as deltas.
+  size_t expected_usage = TAIL_SIZE + 1 + MEMORY_SIZE;
+  for (u64 frame = 2; frame <= 8; ++frame)
+    expected_usage += TAIL_SIZE + frame + PAGE_SIZE + sizeof(u32);
+  EXPECT_EQ(expected_usage, buffer.GetMemoryUsage());
+
+  State::RewindBuffer::Snapshot snapshot;
+  for (u64 frame = 8; frame >= 1; --frame)
+  {
+    EXPECT_EQ(frame, buffer.Rewind(frame, snapshot));
+    EXPECT_EQ(MakeSnapshot(frame, TAIL_SIZE + frame), snapshot);
+  }
+}
+
+TEST(RewindBuffer, ChangedPages)
+{
+  State::RewindBuffer buffer(1 << 20, 8);
+  buffer.Push(1, View(MakeSnapshot(1)));
+
+  // Pages that aren't marked as changed aren't compared, so the hint is trusted even when it's
+  // wrong. Here it only marks the page that frame 2 really changed.
+  const size_t changed_page = (2 * PAGE_SIZE + 2) % MEMORY_SIZE / (PAGE_SIZE * 2);
+  State::RewindBuffer::ChangedPages memory_changes{PAGE_SIZE * 2, {u64{1} << changed_page}};
+  buffer.Push(2, View(MakeSnapshot(2)), {{}, memory_changes});
+  EXPECT_EQ(SNAPSHOT_SIZE + TAIL_SIZE + PAGE_SIZE + 2 * sizeof(u32), buffer.GetMemoryUsage());
+
+  memory_changes.bitmap = {0};
+  buffer.Push(3, View(MakeSnapshot(3)), {{}, memory_changes});
+  EXPECT_EQ(SNAPSHOT_SIZE + 2 * (TAIL_SIZE + sizeof(u32)) + PAGE_SIZE + sizeof(u32),
+            buffer.GetMemoryUsage());
+
+  State::RewindBuffer::Snapshot snapshot;
+  EXPECT_EQ(2u, buffer.Rewind(2, snapshot));
+  EXPECT_EQ(MakeSnapshot(2), snapshot);
+}
+
+TEST(RewindBuffer, PushFromLiveMemory)
+{
+  // Like guest memory, the pushed region keeps changing after the push and only the pages that are
+  // marked as changed get copied.
+  State::RewindBuffer buffer(1 << 20, 8);
+  State::RewindBuffer::Snapshot memory = MakeSnapshot(1);
+  buffer.Push(1, View(memory));
+
+  const State::RewindBuffer::ChangedPages memory_changes{PAGE_SIZE, {u64{1} << 3}};
+  for (u64 frame = 2; frame <= 4; ++frame)
+  {
+    memory[0].assign(TAIL_SIZE, static_cast<u8>(frame));
+    memory[1][3 * PAGE_SIZE] = static_cast<u8>(frame);
+    buffer.Push(frame, View(memory), {{}, memory_changes});
+  }
+  memory[1][3 * PAGE_SIZE] = 0xFF;
+
+  State::RewindBuffer::Snapshot expected = MakeSnapshot(1);
+  State::RewindBuffer::Snapshot snapshot;
+  for (u64 frame = 4; frame >= 1; --frame)
+  {
+    expected[0].assign(TAIL_SIZE, static_cast<u8>(frame));
+    expected[1][3 * PAGE_SIZE] = frame == 1 ? 0 : static_cast<u8>(frame);
+    EXPECT_EQ(frame, buffer.Rewind(frame, snapshot));
+    EXPECT_EQ(expected, snapshot);
+  }
+}
+
+TEST(RewindBuffer, PushAfterRewind)
+{
+  State::RewindBuffer buffer(1 << 20, 4);
+  for (u64 frame = 1; frame <= 10; ++frame)
+    buffer.Push(frame * 10, View(MakeSnapshot(frame)));
+
+  State::RewindBuffer::Snapshot snapshot;
+  EXPECT_EQ(50u, buffer.Rewind(59, snapshot));
+  EXPECT_EQ(MakeSnapshot(5), snapshot);
+
+  for (u64 frame = 6; frame <= 8; ++frame)
+    buffer.Push(frame * 10, View(MakeSnapshot(frame + 100)));
+
+  EXPECT_EQ(70u, buffer.Rewind(70, snapshot));
+  EXPECT_EQ(MakeSnapshot(107), snapshot);
+  EXPECT_EQ(50u, buffer.Rewind(50, snapshot));
+  EXPECT_EQ(MakeSnapshot(5), snapshot);
+}
+
+TEST(RewindBuffer, MemoryBudget)
+{
+  const size_t budget = SNAPSHOT_SIZE * 2;
+  State::RewindBuffer buffer(budget, 4);
+  for (u64 frame = 1; frame <= 100; ++frame)
+  {
+    buffer.Push(frame, View(MakeSnapshot(frame)));
+    EXPECT_LE(buffer.GetMemoryUsage(), budget);
+  }
+
+  // The oldest snapshots were merged away, but the remaining ones are still intact.
+  State::RewindBuffer::Snapshot snapshot;
+  const std::optional<u64> oldest = buffer.Rewind(0, snapshot);
+  ASSERT_TRUE(oldest.has_value());
+  EXPECT_GT(*oldest, 1u);
+  EXPECT_EQ(MakeSnapshot(*oldest), snapshot);
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <lzo/lzo1x.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/State.h"
+#include "Core/StateCompression.h"
+
+namespace
+{
+// The block size that states were compressed with before StateCompression::Zstd
+constexpr size_t LZO_BLOCK_SIZE = 128 * 1024;
+
+// Half of the data compresses well, like most of a savestate, and the other half doesn't
+std::vector<u8> MakeStateData(size_t size)
+{
+  std::vector<u8> data(size);
+  u32 seed = 1;
+  for (size_t i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    data[i] = (i / 4096) % 2 == 0 ? static_cast<u8>(i / 64) : static_cast<u8>(seed >> 16);
+  }
+  return data;
+}
+
+// Writes the data the way states were written before StateCompression::Zstd. When the size is a
+// multiple of the block size, that included an empty block at the end.
+void WriteLZOChunks(File::IOFile& f, const std::vector<u8>& data)
+{
+  std::vector<u8> out(LZO_BLOCK_SIZE + LZO_BLOCK_SIZE / 16 + 64 + 3);
+  std::vector<u8> work_memory(LZO1X_1_MEM_COMPRESS);
+  size_t i = 0;
+  while (true)
+  {
+    const lzo_uint32 cur_len = static_cast<lzo_uint32>(std::min(LZO_BLOCK_SIZE, data.size() - i));
+    lzo_uint out_len = 0;
+    ASSERT_EQ(LZO_E_OK, lzo1x_1_compress(data.data() + i, cur_len, out.data(), &out_len,
+                                         work_memory.data()));
+
+    const lzo_uint32 out_len32 = static_cast<lzo_uint32>(out_len);
+    f.WriteArray(&out_len32, 1);
+    f.WriteBytes(out.data(), out_len);
+
+    if (cur_len != LZO_BLOCK_SIZE)
+      break;
+    i += cur_len;
+  }
+}
+
+class StateCompressionTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    ASSERT_EQ(LZO_E_OK, lzo_init());
+    m_directory = File::CreateTempDir();
+    ASSERT_FALSE(m_directory.empty());
+    m_path = m_directory + "/state.sav";
+  }
+
+  void TearDown() override { File::DeleteDirRecursively(m_directory); }
+
+  // Writes the whole file, then returns it for reading
+  template <typename WriteFunc>
+  File::IOFile WriteFile(WriteFunc write)
+  {
+    {
+      File::IOFile f(m_path, "wb");
+      write(f);
+    }
+    return File::IOFile(m_path, "rb");
+  }
+
+  void Truncate(size_t bytes_to_remove)
+  {
+    std::string contents;
+    ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+    contents.resize(contents.size() - bytes_to_remove);
+    ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+  }
+
+  void FlipByte(size_t offset)
+  {
+    std::string contents;
+    ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+    contents[offset] ^= 0x55;
+    ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_F(StateCompressionTest, ZstdRoundTrip)
+{
+  for (const size_t size : {size_t{1}, size_t{State::STATE_CHUNK_SIZE},
+                            size_t{State::STATE_CHUNK_SIZE} * 5 + 12345})
+  {
+    const std::vector<u8> data = MakeStateData(size);
+    File::IOFile f = WriteFile([&](File::IOFile& out) {
+      EXPECT_TRUE(State::WriteZstdChunks(out, data, 1));
+      // Whatever follows the chunks isn't read
+      out.WriteString("trailing data");
+    });
+
+    std::vector<u8> buffer(size);
+    EXPECT_TRUE(State::ReadZstdChunks(f, buffer)) << "size " << size;
+    EXPECT_EQ(data, buffer) << "size " << size;
+  }
+}
+
+TEST_F(StateCompressionTest, ZstdTruncated)
+{
+  const std::vector<u8> data = MakeStateData(State::STATE_CHUNK_SIZE * 3);
+  WriteFile([&](File::IOFile& out) { EXPECT_TRUE(State::WriteZstdChunks(out, data, 1)); });
+  Truncate(100);
+
+  File::IOFile f(m_path, "rb");
+  std::vector<u8> buffer(data.size());
+  EXPECT_FALSE(State::ReadZstdChunks(f, buffer));
+}
+
+TEST_F(StateCompressionTest, ZstdCorrupt)
+{
+  const std::vector<u8> data = MakeStateData(State::STATE_CHUNK_SIZE * 3);
+  WriteFile([&](File::IOFile& out) { EXPECT_TRUE(State::WriteZstdChunks(out, data, 1)); });
+  // Past the size of the first chunk, in the frame header
+  FlipByte(sizeof(u32) + 1);
+
+  File::IOFile f(m_path, "rb");
+  std::vector<u8> buffer(data.size());
+  EXPECT_FALSE(State::ReadZstdChunks(f, buffer));
+}
+
+TEST_F(StateCompressionTest, LoadsLZOStates)
+{
+  for (const size_t size : {size_t{1}, LZO_BLOCK_SIZE, LZO_BLOCK_SIZE * 20 + 999})
+  {
+    const std::vector<u8> data = MakeStateData(size);
+    File::IOFile f = WriteFile([&](File::IOFile& out) { WriteLZOChunks(out, data); });
+
+    std::vector<u8> buffer(size);
+    EXPECT_TRUE(State::ReadLZOChunks(f, buffer)) << "size " << size;
+    EXPECT_EQ(data, buffer) << "size " << size;
+  }
+}
+
+TEST_F(StateCompressionTest, LZOTruncated)
+{
+  const std::vector<u8> data = MakeStateData(LZO_BLOCK_SIZE * 3 + 999);
+  WriteFile([&](File::IOFile& out) { WriteLZOChunks(out, data); });
+  Truncate(100);
+
+  File::IOFile f(m_path, "rb");
+  std::vector<u8> buffer(data.size());
+  EXPECT_FALSE(State::ReadLZOChunks(f, buffer));
+}
+
+TEST_F(StateCompressionTest, LZOLargerThanHeaderSize)
+{
+  // The data doesn't fit in the size from the state header
+  const std::vector<u8> data = MakeStateData(LZO_BLOCK_SIZE * 2);
+  File::IOFile f = WriteFile([&](File::IOFile& out) { WriteLZOChunks(out, data); });
+
+  std::vector<u8> buffer(LZO_BLOCK_SIZE + 10);
+  EXPECT_FALSE(State::ReadLZOChunks(f, buffer));
+}
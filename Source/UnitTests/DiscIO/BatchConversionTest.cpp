@@ -0,0 +1,204 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/BatchConversion.h"
+#include "DiscIO/Blob.h"
+
+namespace
+{
+std::string MakeData(size_t size, u32 seed)
+{
+  std::string data(size, '\0');
+  for (char& c : data)
+  {
+    seed = seed * 1103515245 + 12345;
+    c = static_cast<char>(seed >> 16);
+  }
+  return data;
+}
+
+// Converts to ISO, like dolphin-tool convert --format=iso
+bool ConvertToPlain(const DiscIO::BatchConversionJob& job, const std::string& output_path)
+{
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(job.input_path);
+  return blob_reader &&
+         DiscIO::ConvertToPlain(blob_reader.get(), job.input_path, output_path,
+                                [](const std::string&, float) { return true; });
+}
+
+void IgnoreMessage(const DiscIO::BatchConversionJob&, std::string_view)
+{
+}
+
+class BatchConversionTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_directory = File::CreateTempDir();
+    ASSERT_FALSE(m_directory.empty());
+    m_input_directory = m_directory + "/in";
+    m_output_directory = m_directory + "/out";
+    ASSERT_TRUE(File::CreateDir(m_input_directory));
+    ASSERT_TRUE(File::CreateDir(m_output_directory));
+  }
+
+  void TearDown() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string WriteInput(const std::string& name, size_t size, u32 seed)
+  {
+    const std::string path = m_input_directory + "/" + name;
+    EXPECT_TRUE(File::WriteStringToFile(path, MakeData(size, seed)));
+    return path;
+  }
+
+  static std::string ReadFile(const std::string& path)
+  {
+    std::string contents;
+    EXPECT_TRUE(File::ReadFileToString(path, contents)) << path;
+    return contents;
+  }
+
+  std::string m_directory;
+  std::string m_input_directory;
+  std::string m_output_directory;
+};
+}  // namespace
+
+TEST_F(BatchConversionTest, ReadInputList)
+{
+  const std::string list_path = m_directory + "/list.txt";
+  ASSERT_TRUE(File::WriteStringToFile(list_path, "a.iso\r\n\n  dir/b.gcz \t\n \nc d.rvz"));
+
+  const std::optional<std::vector<std::string>> input_paths =
+      DiscIO::ReadBatchInputList(list_path);
+  ASSERT_TRUE(input_paths.has_value());
+  EXPECT_EQ((std::vector<std::string>{"a.iso", "dir/b.gcz", "c d.rvz"}), *input_paths);
+
+  EXPECT_FALSE(DiscIO::ReadBatchInputList(m_directory + "/missing.txt").has_value());
+}
+
+TEST_F(BatchConversionTest, PlanNamesOutputsAfterInputs)
+{
+  const DiscIO::BatchConversionPlan plan =
+      DiscIO::PlanBatchConversion({"x/first.iso", "y/second.gcz"}, "out", "rvz");
+
+  EXPECT_TRUE(plan.errors.empty());
+  ASSERT_EQ(2u, plan.jobs.size());
+  EXPECT_EQ("x/first.iso", plan.jobs[0].input_path);
+  EXPECT_EQ("out/first.rvz", plan.jobs[0].output_path);
+  EXPECT_EQ("y/second.gcz", plan.jobs[1].input_path);
+  EXPECT_EQ("out/second.rvz", plan.jobs[1].output_path);
+}
+
+TEST_F(BatchConversionTest, PlanRejectsDuplicateOutputs)
+{
+  // Only the folder and extension differ from the first disc image
+  const std::string first = m_input_directory + "/game.iso";
+  const std::string same_name = m_directory + "/game.gcz";
+  const std::string other = m_input_directory + "/other.iso";
+
+  const DiscIO::BatchConversionPlan plan =
+      DiscIO::PlanBatchConversion({first, same_name, other}, m_output_directory, "rvz");
+
+  ASSERT_EQ(2u, plan.jobs.size());
+  EXPECT_EQ(first, plan.jobs[0].input_path);
+  EXPECT_EQ(other, plan.jobs[1].input_path);
+  ASSERT_EQ(1u, plan.errors.size());
+  EXPECT_EQ(same_name, plan.errors[0].input_path);
+}
+
+TEST_F(BatchConversionTest, PlanRejectsOverwritingInput)
+{
+  const std::string input_path = WriteInput("game.iso", 16, 1);
+
+  // The same folder, spelled differently
+  const DiscIO::BatchConversionPlan plan =
+      DiscIO::PlanBatchConversion({input_path}, m_input_directory + "/../in", "iso");
+
+  EXPECT_TRUE(plan.jobs.empty());
+  ASSERT_EQ(1u, plan.errors.size());
+  EXPECT_EQ(input_path, plan.errors[0].input_path);
+}
+
+TEST_F(BatchConversionTest, ConvertsAndResumes)
+{
+  std::vector<std::string> input_paths;
+  u64 input_size = 0;
+  for (u32 i = 0; i < 5; ++i)
+  {
+    const size_t size = 0x80000 * i + 1234;
+    input_paths.push_back(WriteInput("game" + std::to_string(i) + ".gcm", size, i));
+    input_size += size;
+  }
+  // Shares its output path with game0.gcm, so it's never converted
+  input_paths.push_back(WriteInput("game0.wbfs", 16, 100));
+
+  const DiscIO::BatchConversionPlan plan =
+      DiscIO::PlanBatchConversion(input_paths, m_output_directory, "iso");
+  ASSERT_EQ(5u, plan.jobs.size());
+  ASSERT_EQ(1u, plan.errors.size());
+
+  // In the first run, game2.gcm and game4.gcm fail to convert
+  const auto convert_all_but_two = [&](const DiscIO::BatchConversionJob& job,
+                                       const std::string& output_path) {
+    if (&job == &plan.jobs[2])
+      return false;
+    if (&job == &plan.jobs[4])
+    {
+      EXPECT_TRUE(File::WriteStringToFile(output_path, "failed"));
+      return false;
+    }
+    return ConvertToPlain(job, output_path);
+  };
+
+  DiscIO::BatchConversionResult result =
+      DiscIO::RunBatchConversion(plan.jobs, 2, convert_all_but_two, IgnoreMessage);
+  EXPECT_EQ(3u, result.converted);
+  EXPECT_EQ(0u, result.skipped);
+  EXPECT_EQ(2u, result.failed);
+  EXPECT_FALSE(File::Exists(plan.jobs[2].output_path));
+  EXPECT_FALSE(File::Exists(plan.jobs[4].output_path));
+  EXPECT_FALSE(File::Exists(plan.jobs[4].output_path + ".part"));
+
+  // Resuming only converts what's missing. The file left behind by a conversion that was
+  // interrupted by closing the program is replaced.
+  ASSERT_TRUE(File::WriteStringToFile(plan.jobs[2].output_path + ".part", "partial"));
+  std::atomic<u32> conversions = 0;
+  const auto convert = [&](const DiscIO::BatchConversionJob& job, const std::string& output_path) {
+    ++conversions;
+    return ConvertToPlain(job, output_path);
+  };
+  result = DiscIO::RunBatchConversion(plan.jobs, 2, convert, IgnoreMessage);
+  EXPECT_EQ(2u, conversions.load());
+  EXPECT_EQ(2u, result.converted);
+  EXPECT_EQ(3u, result.skipped);
+  EXPECT_EQ(0u, result.failed);
+  EXPECT_EQ(result.bytes_read, result.bytes_written);
+
+  u64 output_size = 0;
+  for (const DiscIO::BatchConversionJob& job : plan.jobs)
+  {
+    EXPECT_EQ(ReadFile(job.input_path), ReadFile(job.output_path)) << job.output_path;
+    EXPECT_FALSE(File::Exists(job.output_path + ".part")) << job.output_path;
+    output_size += File::GetSize(job.output_path);
+  }
+  EXPECT_EQ(input_size, output_size);
+
+  // Once everything is converted, nothing is left to do
+  conversions = 0;
+  result = DiscIO::RunBatchConversion(plan.jobs, 2, convert, IgnoreMessage);
+  EXPECT_EQ(0u, conversions.load());
+  EXPECT_EQ(5u, result.skipped);
+}
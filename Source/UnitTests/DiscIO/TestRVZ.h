@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/WIABlob.h"
+
+namespace TestRVZ
+{
+class MemoryBlobReader final : public DiscIO::BlobReader
+{
+public:
+  explicit MemoryBlobReader(std::vector<u8> data) : m_data(std::move(data)) {}
+
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  u64 GetRawSize() const override { return m_data.size(); }
+  u64 GetDataSize() const override { return m_data.size(); }
+  DiscIO::DataSizeType GetDataSizeType() const override
+  {
+    return DiscIO::DataSizeType::Accurate;
+  }
+  u64 GetBlockSize() const override { return 0; }
+  bool HasFastRandomAccessInBlock() const override { return true; }
+  std::string GetCompressionMethod() const override { return {}; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    if (offset + size > m_data.size())
+      return false;
+    std::memcpy(out_ptr, m_data.data() + offset, size);
+    return true;
+  }
+
+private:
+  std::vector<u8> m_data;
+};
+
+// Mixes compressible and incompressible data, with a run of zeroes that ends up as empty groups
+inline std::vector<u8> GenerateData(u64 size, u64 chunk_size)
+{
+  std::vector<u8> data(size);
+  u32 state = 1;
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    state = state * 1103515245 + 12345;
+    data[i] = (i / 0x8000) % 3 == 0 ? static_cast<u8>(i / 0x100) : static_cast<u8>(state >> 16);
+  }
+  std::fill(data.begin() + 8 * chunk_size, data.begin() + 12 * chunk_size, u8(0));
+  return data;
+}
+
+inline std::unique_ptr<DiscIO::RVZFileReader> CreateRVZ(const std::vector<u8>& data,
+                                                        const std::string& path, int chunk_size)
+{
+  MemoryBlobReader infile(data);
+  File::IOFile outfile(path, "wb");
+  const DiscIO::ConversionResultCode result = DiscIO::RVZFileReader::Convert(
+      &infile, nullptr, &outfile, DiscIO::WIARVZCompressionType::Zstd, 5, chunk_size,
+      [](const std::string&, float) { return true; });
+  outfile.Close();
+  if (result != DiscIO::ConversionResultCode::Success)
+    return nullptr;
+
+  return DiscIO::RVZFileReader::Create(File::IOFile(path, "rb"), path);
+}
+}  // namespace TestRVZ
@@ -0,0 +1,173 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/Swap.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+#include "DiscIO/VolumeVerifier.h"
+#include "DiscIO/VolumeWii.h"
+
+using DiscIO::VolumeWii;
+
+namespace
+{
+constexpr u64 PARTITION_OFFSET = 0x50000;
+constexpr u64 H3_OFFSET = 0x8000;
+constexpr u64 DATA_OFFSET = 0x20000;
+// One full group and one partial group
+constexpr size_t BLOCKS = VolumeWii::BLOCKS_PER_GROUP + 10;
+
+class MemoryBlobReader final : public DiscIO::BlobReader
+{
+public:
+  explicit MemoryBlobReader(std::vector<u8> data) : m_data(std::move(data)) {}
+
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  u64 GetRawSize() const override { return m_data.size(); }
+  u64 GetDataSize() const override { return m_data.size(); }
+  DiscIO::DataSizeType GetDataSizeType() const override
+  {
+    return DiscIO::DataSizeType::Accurate;
+  }
+  u64 GetBlockSize() const override { return 0; }
+  bool HasFastRandomAccessInBlock() const override { return true; }
+  std::string GetCompressionMethod() const override { return {}; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    if (offset + size > m_data.size())
+      return false;
+    std::memcpy(out_ptr, m_data.data() + offset, size);
+    return true;
+  }
+
+private:
+  std::vector<u8> m_data;
+};
+
+void Write32(std::vector<u8>* disc, u64 offset, u32 value)
+{
+  const u32 swapped = Common::swap32(value);
+  std::memcpy(disc->data() + offset, &swapped, sizeof(swapped));
+}
+
+// Builds a Wii disc with hashes but without encryption. Its only partition is an update partition,
+// so there is no game partition and the verifier treats it like a Datel disc, which means that
+// it doesn't try to check signatures or a file system that the disc doesn't have.
+std::vector<u8> CreateUnencryptedWiiDisc()
+{
+  std::vector<u8> disc(PARTITION_OFFSET + DATA_OFFSET + BLOCKS * VolumeWii::BLOCK_TOTAL_SIZE);
+
+  std::memcpy(disc.data(), "RTST01", 6);
+  Write32(&disc, 0x18, DiscIO::WII_DISC_MAGIC);
+  disc[0x61] = 1;
+
+  Write32(&disc, 0x40000, 1);
+  Write32(&disc, 0x40004, 0x40020 >> 2);
+  Write32(&disc, 0x40020, PARTITION_OFFSET >> 2);
+  Write32(&disc, 0x40024, DiscIO::PARTITION_UPDATE);
+
+  Write32(&disc, PARTITION_OFFSET + DiscIO::WII_PARTITION_H3_OFFSET_ADDRESS, H3_OFFSET >> 2);
+  Write32(&disc, PARTITION_OFFSET + 0x2b8, DATA_OFFSET >> 2);
+  Write32(&disc, PARTITION_OFFSET + 0x2bc, (BLOCKS * VolumeWii::BLOCK_TOTAL_SIZE) >> 2);
+
+  auto data = std::make_unique<std::array<u8, VolumeWii::BLOCK_DATA_SIZE>[]>(
+      VolumeWii::BLOCKS_PER_GROUP);
+  auto hashes = std::make_unique<VolumeWii::HashBlock[]>(VolumeWii::BLOCKS_PER_GROUP);
+
+  for (size_t group = 0; group * VolumeWii::BLOCKS_PER_GROUP < BLOCKS; ++group)
+  {
+    const size_t first_block = group * VolumeWii::BLOCKS_PER_GROUP;
+    const size_t blocks = std::min<size_t>(VolumeWii::BLOCKS_PER_GROUP, BLOCKS - first_block);
+
+    for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+    {
+      for (size_t j = 0; j < VolumeWii::BLOCK_DATA_SIZE; ++j)
+        data[i][j] = i < blocks ? static_cast<u8>((first_block + i) * 131 + j * 7 + (j >> 9)) : 0;
+    }
+
+    // The partition's own disc header has to be valid for its blocks to get checked
+    if (group == 0)
+    {
+      const u32 magic = Common::swap32(DiscIO::WII_DISC_MAGIC);
+      std::memcpy(data[0].data() + 0x18, &magic, sizeof(magic));
+    }
+
+    VolumeWii::HashGroup(data.get(), hashes.get());
+
+    for (size_t i = 0; i < blocks; ++i)
+    {
+      u8* block = disc.data() + PARTITION_OFFSET + DATA_OFFSET +
+                  (first_block + i) * VolumeWii::BLOCK_TOTAL_SIZE;
+      std::memcpy(block, &hashes[i], VolumeWii::BLOCK_HEADER_SIZE);
+      std::memcpy(block + VolumeWii::BLOCK_HEADER_SIZE, data[i].data(),
+                  VolumeWii::BLOCK_DATA_SIZE);
+    }
+
+    const Common::SHA1::Digest h3 = Common::SHA1::CalculateDigest(hashes[0].h2);
+    std::memcpy(disc.data() + PARTITION_OFFSET + H3_OFFSET + group * h3.size(), h3.data(),
+                h3.size());
+  }
+
+  return disc;
+}
+
+std::vector<std::string> GetBlockErrors(std::vector<u8> disc)
+{
+  std::unique_ptr<DiscIO::VolumeDisc> volume =
+      DiscIO::CreateDisc(std::make_unique<MemoryBlobReader>(std::move(disc)));
+  if (!volume)
+    return {"Failed to create volume"};
+
+  DiscIO::VolumeVerifier verifier(*volume, false, {});
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+    verifier.Process();
+  verifier.Finish();
+
+  std::vector<std::string> errors;
+  for (const DiscIO::VolumeVerifier::Problem& problem : verifier.GetResult().problems)
+  {
+    if (problem.text.starts_with("Errors were found in"))
+      errors.push_back(problem.text);
+  }
+  return errors;
+}
+}  // namespace
+
+TEST(VolumeVerifier, IntactWiiPartition)
+{
+  EXPECT_EQ(std::vector<std::string>{}, GetBlockErrors(CreateUnencryptedWiiDisc()));
+}
+
+TEST(VolumeVerifier, CorruptWiiBlocks)
+{
+  // Blocks at the start, in the middle and at the end of the first group, and one in the partial
+  // second group, so that they are spread over the threads that check blocks
+  std::vector<u8> disc = CreateUnencryptedWiiDisc();
+  for (const size_t block : {1, 31, 63, 66})
+  {
+    disc[PARTITION_OFFSET + DATA_OFFSET + block * VolumeWii::BLOCK_TOTAL_SIZE +
+         VolumeWii::BLOCK_HEADER_SIZE + 0x1234] ^= 0x80;
+  }
+
+  const std::vector<std::string> errors = GetBlockErrors(std::move(disc));
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_TRUE(errors[0].starts_with("Errors were found in 4 ")) << errors[0];
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/WIABlob.h"
+
+#include "TestRVZ.h"
+
+// Replays a trace of reads the way the DVD thread issues them, with some time between the reads
+// in which the emulated drive is busy. The time is the total time that the reads block the DVD
+// thread, with readahead disabled (budget_mib 0) or enabled.
+
+namespace
+{
+constexpr int CHUNK_SIZE = 0x20000;
+constexpr u64 DATA_SIZE = 256 * CHUNK_SIZE;
+// The size of the blocks that the DVD thread reads
+constexpr u64 READ_SIZE = 0x8000;
+constexpr u32 RANDOM_READS = 1024;
+constexpr auto TIME_BETWEEN_READS = std::chrono::microseconds(100);
+
+enum class Trace
+{
+  Sequential,
+  Random,
+};
+
+class RVZImage
+{
+public:
+  RVZImage() : m_directory(File::CreateTempDir()), m_path(m_directory + "/benchmark.rvz")
+  {
+    const std::vector<u8> data = TestRVZ::GenerateData(DATA_SIZE, CHUNK_SIZE);
+    m_valid = TestRVZ::CreateRVZ(data, m_path, CHUNK_SIZE) != nullptr;
+  }
+  ~RVZImage() { File::DeleteDirRecursively(m_directory); }
+
+  std::unique_ptr<DiscIO::RVZFileReader> Open() const
+  {
+    if (!m_valid)
+      return nullptr;
+    return DiscIO::RVZFileReader::Create(File::IOFile(m_path, "rb"), m_path);
+  }
+
+private:
+  std::string m_directory;
+  std::string m_path;
+  bool m_valid = false;
+};
+
+std::vector<u64> MakeTrace(Trace trace)
+{
+  std::vector<u64> offsets;
+  if (trace == Trace::Sequential)
+  {
+    for (u64 offset = 0; offset < DATA_SIZE; offset += READ_SIZE)
+      offsets.push_back(offset);
+  }
+  else
+  {
+    u32 state = 7;
+    for (u32 i = 0; i < RANDOM_READS; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      offsets.push_back((state >> 8) % (DATA_SIZE / READ_SIZE) * READ_SIZE);
+    }
+  }
+  return offsets;
+}
+
+void BM_ReadTrace(benchmark::State& state, Trace trace)
+{
+  static const RVZImage image;
+  const u64 memory_budget = static_cast<u64>(state.range(0)) * 1024 * 1024;
+  const std::vector<u64> offsets = MakeTrace(trace);
+  std::vector<u8> buffer(READ_SIZE);
+
+  u64 hits = 0;
+  u64 misses = 0;
+  for (auto _ : state)
+  {
+    std::unique_ptr<DiscIO::RVZFileReader> reader = image.Open();
+    if (!reader)
+    {
+      state.SkipWithError("Failed to create the RVZ image");
+      return;
+    }
+    reader->SetReadaheadMemoryBudget(memory_budget);
+
+    std::chrono::steady_clock::duration stall_time{};
+    for (const u64 offset : offsets)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      if (!reader->Read(offset, READ_SIZE, buffer.data()))
+      {
+        state.SkipWithError("Read failed");
+        return;
+      }
+      stall_time += std::chrono::steady_clock::now() - start;
+
+      std::this_thread::sleep_for(TIME_BETWEEN_READS);
+    }
+    state.SetIterationTime(std::chrono::duration<double>(stall_time).count());
+
+    const DiscIO::RVZFileReader::ChunkCacheStats stats = reader->GetChunkCacheStats();
+    hits += stats.hits;
+    misses += stats.misses;
+  }
+
+  state.SetBytesProcessed(state.iterations() * offsets.size() * READ_SIZE);
+  state.counters["hit_rate"] = hits + misses == 0 ? 0.0 : double(hits) / (hits + misses);
+  state.counters["stall_per_read"] = benchmark::Counter(
+      double(state.iterations() * offsets.size()),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ReadTrace, Sequential, Trace::Sequential)
+    ->ArgName("budget_mib")
+    ->Arg(0)
+    ->Arg(64)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadTrace, Random, Trace::Random)
+    ->ArgName("budget_mib")
+    ->Arg(0)
+    ->Arg(64)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
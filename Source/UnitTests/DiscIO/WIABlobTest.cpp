@@ -0,0 +1,65 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/WIABlob.h"
+
+#include "TestRVZ.h"
+
+namespace
+{
+constexpr int CHUNK_SIZE = 0x20000;
+constexpr u64 DATA_SIZE = 48 * CHUNK_SIZE + 0x1234;
+}  // namespace
+
+TEST(WIABlob, ReadaheadMatchesDirectReads)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+
+  const std::vector<u8> data = TestRVZ::GenerateData(DATA_SIZE, CHUNK_SIZE);
+  std::unique_ptr<DiscIO::RVZFileReader> reader =
+      TestRVZ::CreateRVZ(data, directory + "/test.rvz", CHUNK_SIZE);
+  ASSERT_TRUE(reader != nullptr);
+
+  reader->SetReadaheadMemoryBudget(16 * CHUNK_SIZE * 2);
+
+  // Sequential reads that don't line up with group boundaries
+  std::vector<u8> buffer(0x7000);
+  for (u64 offset = 0; offset < DATA_SIZE; offset += buffer.size())
+  {
+    const u64 size = std::min<u64>(buffer.size(), DATA_SIZE - offset);
+    ASSERT_TRUE(reader->Read(offset, size, buffer.data()));
+    ASSERT_EQ(0, std::memcmp(buffer.data(), data.data() + offset, size)) << offset;
+  }
+
+  const DiscIO::RVZFileReader::ChunkCacheStats sequential_stats = reader->GetChunkCacheStats();
+  EXPECT_GT(sequential_stats.hits, 0u);
+
+  // Jump back and forth, which both re-reads cached groups and breaks the sequential pattern
+  u32 state = 7;
+  for (int i = 0; i < 200; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    const u64 offset = (state >> 8) % (DATA_SIZE - buffer.size());
+    ASSERT_TRUE(reader->Read(offset, buffer.size(), buffer.data()));
+    ASSERT_EQ(0, std::memcmp(buffer.data(), data.data() + offset, buffer.size())) << offset;
+  }
+
+  // Turning readahead off must leave the reader usable
+  reader->SetReadaheadMemoryBudget(0);
+  ASSERT_TRUE(reader->Read(DATA_SIZE - buffer.size(), buffer.size(), buffer.data()));
+  EXPECT_EQ(0, std::memcmp(buffer.data(), data.data() + DATA_SIZE - buffer.size(), buffer.size()));
+
+  reader.reset();
+  File::DeleteDirRecursively(directory);
+}
@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+using Vertices = std::vector<CPUCull::TransformedVertex>;
+using Triangles = std::vector<u16>;
+
+Triangles Cull(Primitive primitive, CullMode cullmode, const Vertices& vertices)
+{
+  CPUCull cull;
+  cull.Init();
+  const u32 count = cull.CullTransformedTriangles(primitive, cullmode, vertices.data(),
+                                                  static_cast<u32>(vertices.size()));
+  return Triangles(cull.GetVisibleTriangles(), cull.GetVisibleTriangles() + count * 3);
+}
+
+CPUCull::TransformedVertex Vertex(float x, float y)
+{
+  return {x * 0.25f, y * 0.25f, 0.5f, 1.0f};
+}
+
+// A strip with the same facing for every triangle, as long as the odd ones are flipped
+const Vertices s_strip = {Vertex(0, 0), Vertex(0, 1), Vertex(1, 0),
+                          Vertex(1, 1), Vertex(2, 0), Vertex(2, 1)};
+}  // namespace
+
+TEST(CPUCull, StripWinding)
+{
+  const Triangles all = {0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4};
+  EXPECT_EQ(all, Cull(Primitive::GX_DRAW_TRIANGLE_STRIP, CullMode::None, s_strip));
+  EXPECT_EQ(all, Cull(Primitive::GX_DRAW_TRIANGLE_STRIP, CullMode::Back, s_strip));
+  EXPECT_EQ(Triangles{}, Cull(Primitive::GX_DRAW_TRIANGLE_STRIP, CullMode::Front, s_strip));
+  EXPECT_EQ(Triangles{}, Cull(Primitive::GX_DRAW_TRIANGLE_STRIP, CullMode::All, s_strip));
+}
+
+TEST(CPUCull, StripDegenerate)
+{
+  // The two triangles that use vertex 3 twice collapse to a line
+  Vertices strip = s_strip;
+  strip[3] = strip[2];
+  const Triangles expected = {0, 1, 2, 3, 5, 4};
+  EXPECT_EQ(expected, Cull(Primitive::GX_DRAW_TRIANGLE_STRIP, CullMode::None, strip));
+}
+
+TEST(CPUCull, FanWinding)
+{
+  const Vertices fan = {Vertex(0, 0), Vertex(0, 2), Vertex(1, 2), Vertex(2, 1), Vertex(1, -1)};
+  const Triangles all = {0, 1, 2, 0, 2, 3, 0, 3, 4};
+  EXPECT_EQ(all, Cull(Primitive::GX_DRAW_TRIANGLE_FAN, CullMode::Back, fan));
+  EXPECT_EQ(Triangles{}, Cull(Primitive::GX_DRAW_TRIANGLE_FAN, CullMode::Front, fan));
+
+  // Moving vertex 3 to the other side of the edge from vertex 0 to 2 only flips the middle triangle
+  Vertices flipped = fan;
+  flipped[3] = Vertex(-1, 3);
+  const Triangles back = {0, 1, 2, 0, 3, 4};
+  const Triangles front = {0, 2, 3};
+  EXPECT_EQ(back, Cull(Primitive::GX_DRAW_TRIANGLE_FAN, CullMode::Back, flipped));
+  EXPECT_EQ(front, Cull(Primitive::GX_DRAW_TRIANGLE_FAN, CullMode::Front, flipped));
+}
+
+TEST(CPUCull, OutsideOfClipSpace)
+{
+  // The second triangle lies entirely to the right of the viewport
+  const Vertices list = {Vertex(0, 0), Vertex(0, 1), Vertex(1, 0),
+                         Vertex(5, 0), Vertex(5, 1), Vertex(6, 0),
+                         Vertex(-1, 0), Vertex(-1, 1), Vertex(5, 0)};
+  const Triangles expected = {0, 1, 2, 6, 7, 8};
+  EXPECT_EQ(expected, Cull(Primitive::GX_DRAW_TRIANGLES, CullMode::None, list));
+}
+
+TEST(CPUCull, Quads)
+{
+  // Two quads and a leftover triangle. Only the second half of the first quad is degenerate.
+  const Vertices quads = {Vertex(0, 0), Vertex(0, 1), Vertex(1, 1), Vertex(1, 1),
+                          Vertex(2, 0), Vertex(2, 1), Vertex(3, 1), Vertex(3, 0),
+                          Vertex(0, 0), Vertex(0, 1), Vertex(1, 1)};
+  const Triangles expected = {0, 1, 2, 4, 5, 6, 4, 6, 7, 8, 9, 10};
+  EXPECT_EQ(expected, Cull(Primitive::GX_DRAW_QUADS, CullMode::None, quads));
+  EXPECT_EQ(expected, Cull(Primitive::GX_DRAW_QUADS_2, CullMode::None, quads));
+}
+
+TEST(CPUCull, FallbacksMatch)
+{
+  // Coordinates from a small grid, so that there are degenerate triangles, triangles outside of
+  // clip space and vertices exactly on its edge. The count leaves a partial group of triangles for
+  // the AVX-512 version with every primitive.
+  Vertices vertices;
+  u32 state = 1;
+  for (int i = 0; i < 151; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    const int x = static_cast<int>((state >> 16) % 7) - 3;
+    const int y = static_cast<int>((state >> 8) % 7) - 3;
+    vertices.push_back(Vertex(x * 2.0f, y * 2.0f));
+  }
+
+  const auto cull_all = [&] {
+    std::vector<Triangles> result;
+    for (Primitive primitive : {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_TRIANGLES,
+                                Primitive::GX_DRAW_TRIANGLE_STRIP, Primitive::GX_DRAW_TRIANGLE_FAN})
+    {
+      for (CullMode mode : {CullMode::None, CullMode::Back, CullMode::Front, CullMode::All})
+        result.push_back(Cull(primitive, mode, vertices));
+    }
+    return result;
+  };
+
+  // Turn off the SIMD paths which are selected at runtime one by one
+  const CPUInfo saved_cpu_info = cpu_info;
+  const std::vector<Triangles> expected = cull_all();
+  cpu_info.bAVX512 = false;
+  EXPECT_EQ(expected, cull_all());
+  cpu_info.bAVX = false;
+  EXPECT_EQ(expected, cull_all());
+  cpu_info = saved_cpu_info;
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
+
+namespace
+{
+// Logs every call, so that replayed display lists can be compared with parsed ones
+class LoggingCallback final : public OpcodeDecoder::Callback
+{
+public:
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+  {
+    log.push_back(fmt::format("XF {} {} {}", address, count, data[0]));
+  }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    log.push_back(fmt::format("CP {} {}", command, value));
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+  {
+    log.push_back(fmt::format("BP {} {}", command, value));
+  }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    log.push_back(fmt::format("Indexed {} {} {} {}", static_cast<u8>(array), index, address, size));
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices, const u8* vertex_data))
+  {
+    log.push_back(fmt::format("Primitive {} {} {} {} {}", static_cast<u8>(primitive), vat,
+                              vertex_size, num_vertices, vertex_data[0]));
+  }
+  OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+  {
+    log.push_back(fmt::format("DisplayList {} {}", address, size));
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) { log.push_back(fmt::format("Nop {}", count)); }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+  {
+    log.push_back(fmt::format("Unknown {}", opcode));
+  }
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size))
+  {
+    log.push_back(fmt::format("Command {} {}", data[0], size));
+  }
+  OPCODE_CALLBACK(CPState& GetCPState()) { return cp_state; }
+  OPCODE_CALLBACK(u32 GetVertexSize(u8 vat)) { return vertex_size; }
+
+  std::vector<std::string> log;
+  CPState cp_state;
+  u32 vertex_size = 4;
+};
+
+std::vector<u8> CreateDisplayList()
+{
+  std::vector<u8> data;
+  // BP write
+  data.insert(data.end(), {0x61, 0x49, 0x12, 0x34, 0x56});
+  // CP write
+  data.insert(data.end(), {0x08, 0x50, 0x00, 0x00, 0x00, 0x01});
+  // XF write of one value
+  data.insert(data.end(), {0x10, 0x00, 0x00, 0x10, 0x00, 0xAA, 0xBB, 0xCC, 0xDD});
+  // Indexed XF load
+  data.insert(data.end(), {0x20, 0x00, 0x05, 0xB0, 0x00});
+  // Triangles with 32 vertices of 4 bytes each
+  data.insert(data.end(), {0x90, 0x00, 0x20});
+  for (u32 i = 0; i < 32 * 4; i++)
+    data.push_back(static_cast<u8>(i));
+  // Padding
+  data.insert(data.end(), 32, 0x00);
+  return data;
+}
+
+std::vector<std::string> RunWithoutCache(const std::vector<u8>& data, u32 vertex_size)
+{
+  LoggingCallback callback;
+  callback.vertex_size = vertex_size;
+  OpcodeDecoder::Run(data.data(), static_cast<u32>(data.size()), callback);
+  return callback.log;
+}
+
+std::vector<std::string> RunWithCache(OpcodeDecoder::DisplayListCache& cache,
+                                      const std::vector<u8>& data, u32 vertex_size)
+{
+  LoggingCallback callback;
+  callback.vertex_size = vertex_size;
+  cache.Run(0x1000, data.data(), static_cast<u32>(data.size()), callback);
+  return callback.log;
+}
+}  // namespace
+
+TEST(DisplayListCache, ReplayMatchesParsing)
+{
+  std::vector<u8> data = CreateDisplayList();
+  ASSERT_GE(data.size(), OpcodeDecoder::DisplayListCache::MIN_CACHED_SIZE);
+
+  OpcodeDecoder::DisplayListCache cache;
+  const int replayed = g_stats.this_frame.num_dlists_replayed;
+
+  const std::vector<std::string> expected = RunWithoutCache(data, 4);
+  EXPECT_EQ(expected, RunWithCache(cache, data, 4));
+  EXPECT_EQ(expected, RunWithCache(cache, data, 4));
+  EXPECT_EQ(replayed + 1, g_stats.this_frame.num_dlists_replayed);
+
+  // A different vertex format changes where the commands after the primitive start
+  EXPECT_EQ(RunWithoutCache(data, 5), RunWithCache(cache, data, 5));
+  EXPECT_EQ(replayed + 2, g_stats.this_frame.num_dlists_replayed);
+
+  // Changed contents must not replay the old commands
+  data[2] = 0x55;
+  EXPECT_EQ(RunWithoutCache(data, 4), RunWithCache(cache, data, 4));
+  EXPECT_EQ(replayed + 2, g_stats.this_frame.num_dlists_replayed);
+}
+
+TEST(DisplayListCache, ReplayWithChangedPayload)
+{
+  std::vector<u8> data = CreateDisplayList();
+  OpcodeDecoder::DisplayListCache cache;
+  RunWithCache(cache, data, 4);
+  const int replayed = g_stats.this_frame.num_dlists_replayed;
+
+  // Vertex and XF data are read from the current list, so the commands can still be replayed
+  data[36] = 0x77;
+  data[16] = 0x88;
+  EXPECT_EQ(RunWithoutCache(data, 4), RunWithCache(cache, data, 4));
+  EXPECT_EQ(replayed + 1, g_stats.this_frame.num_dlists_replayed);
+
+  // A different number of vertices moves the commands after the primitive
+  data[27] = 0x10;
+  EXPECT_EQ(RunWithoutCache(data, 4), RunWithCache(cache, data, 4));
+  EXPECT_EQ(replayed + 1, g_stats.this_frame.num_dlists_replayed);
+
+  // So does replacing the padding with a command
+  data[27] = 0x20;
+  RunWithCache(cache, data, 4);
+  data.back() = 0x61;
+  EXPECT_EQ(RunWithoutCache(data, 4), RunWithCache(cache, data, 4));
+  EXPECT_EQ(replayed + 1, g_stats.this_frame.num_dlists_replayed);
+}
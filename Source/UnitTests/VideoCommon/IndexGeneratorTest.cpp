@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+using Indices = std::vector<u16>;
+
+constexpr u16 RESTART = UINT16_MAX;
+
+// Adds a triangle, then calls add for a second primitive, and returns all indices.
+template <typename Function>
+Indices Generate(bool primitive_restart, Function add)
+{
+  g_Config.backend_info.bSupportsPrimitiveRestart = primitive_restart;
+
+  Indices buffer(256);
+  IndexGenerator generator;
+  generator.Init();
+  generator.Start(buffer.data());
+  generator.AddIndices(Primitive::GX_DRAW_TRIANGLES, 3);
+  add(generator);
+  buffer.resize(generator.GetIndexLen());
+  return buffer;
+}
+
+Indices AddIndices(bool primitive_restart, Primitive primitive, u32 num_vertices)
+{
+  return Generate(primitive_restart, [&](IndexGenerator& generator) {
+    generator.AddIndices(primitive, num_vertices);
+  });
+}
+
+Indices AddTriangles(bool primitive_restart, Primitive primitive, const Indices& triangles,
+                     u32 num_vertices)
+{
+  return Generate(primitive_restart, [&](IndexGenerator& generator) {
+    generator.AddTriangles(primitive, triangles.data(), static_cast<u32>(triangles.size() / 3),
+                           num_vertices);
+  });
+}
+}  // namespace
+
+TEST(IndexGenerator, AllTrianglesMatchAddIndices)
+{
+  // The triangles that CPUCull returns when nothing is culled
+  const Indices strip = {0, 1, 2, 1, 3, 2, 2, 3, 4};
+  const Indices fan = {0, 1, 2, 0, 2, 3, 0, 3, 4};
+  const Indices list = {0, 1, 2, 3, 4, 5};
+  const Indices quads = {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7};
+
+  EXPECT_EQ(AddIndices(false, Primitive::GX_DRAW_TRIANGLE_STRIP, 5),
+            AddTriangles(false, Primitive::GX_DRAW_TRIANGLE_STRIP, strip, 5));
+  EXPECT_EQ(AddIndices(false, Primitive::GX_DRAW_TRIANGLE_FAN, 5),
+            AddTriangles(false, Primitive::GX_DRAW_TRIANGLE_FAN, fan, 5));
+  EXPECT_EQ(AddIndices(false, Primitive::GX_DRAW_TRIANGLES, 6),
+            AddTriangles(false, Primitive::GX_DRAW_TRIANGLES, list, 6));
+  EXPECT_EQ(AddIndices(false, Primitive::GX_DRAW_QUADS, 8),
+            AddTriangles(false, Primitive::GX_DRAW_QUADS, quads, 8));
+  EXPECT_EQ(AddIndices(true, Primitive::GX_DRAW_TRIANGLES, 6),
+            AddTriangles(true, Primitive::GX_DRAW_TRIANGLES, list, 6));
+}
+
+TEST(IndexGenerator, SomeTriangles)
+{
+  // The indices are offset by the 3 vertices of the first primitive, and the odd strip triangle
+  // keeps its flipped winding
+  const Indices strip = {1, 3, 2};
+  const Indices expected = {0, 1, 2, 4, 6, 5};
+  EXPECT_EQ(expected, AddTriangles(false, Primitive::GX_DRAW_TRIANGLE_STRIP, strip, 5));
+
+  const Indices expected_restart = {0, 1, 2, RESTART, 4, 6, 5, RESTART};
+  EXPECT_EQ(expected_restart, AddTriangles(true, Primitive::GX_DRAW_TRIANGLE_STRIP, strip, 5));
+}
+
+TEST(IndexGenerator, NoTriangles)
+{
+  // The vertices are still counted, so the next primitive starts after them
+  const Indices expected = {0, 1, 2, 8, 9, 10};
+  EXPECT_EQ(expected, Generate(false, [](IndexGenerator& generator) {
+              generator.AddTriangles(Primitive::GX_DRAW_TRIANGLE_FAN, nullptr, 0, 5);
+              generator.AddIndices(Primitive::GX_DRAW_TRIANGLES, 3);
+            }));
+}
+
+TEST(IndexGenerator, PrimitiveRestartFallback)
+{
+  // With primitive restart, two triangles of a 5 vertex strip would take 8 indices, more than
+  // AddIndices reserves for the strip, so the whole strip is added instead
+  const Indices strip = {0, 1, 2, 2, 3, 4};
+  EXPECT_EQ(AddIndices(true, Primitive::GX_DRAW_TRIANGLE_STRIP, 5),
+            AddTriangles(true, Primitive::GX_DRAW_TRIANGLE_STRIP, strip, 5));
+  EXPECT_EQ(AddIndices(true, Primitive::GX_DRAW_TRIANGLE_FAN, 5),
+            AddTriangles(true, Primitive::GX_DRAW_TRIANGLE_FAN, strip, 5));
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "VideoBackends/Software/Rasterizer.h"
+
+namespace
+{
+void ExpectEachJobRunsOnce()
+{
+  constexpr u32 JOB_COUNT = 64;
+  std::vector<std::atomic<u32>> runs(JOB_COUNT);
+  Rasterizer::RunParallel(JOB_COUNT, [&](u32 job) { runs[job]++; });
+
+  for (u32 i = 0; i < JOB_COUNT; i++)
+    EXPECT_EQ(1u, runs[i].load()) << "job " << i;
+}
+}  // namespace
+
+TEST(SoftwareRasterizer, RunParallelAfterRestart)
+{
+  Config::Init();
+  Config::SetCurrent(Config::GFX_SW_RASTERIZER_THREADS, 4);
+
+  Rasterizer::Init();
+  ASSERT_EQ(4u, Rasterizer::GetThreadCount());
+  ExpectEachJobRunsOnce();
+  ExpectEachJobRunsOnce();
+  Rasterizer::Shutdown();
+
+  // Like stopping emulation and starting another game with the software renderer. The threads
+  // get some time to start before there is any work, so they see the state from the last run.
+  Rasterizer::Init();
+  ASSERT_EQ(4u, Rasterizer::GetThreadCount());
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ExpectEachJobRunsOnce();
+  Rasterizer::Shutdown();
+
+  // Init restarts the threads by itself
+  Rasterizer::Init();
+  Rasterizer::Init();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ExpectEachJobRunsOnce();
+  Rasterizer::Shutdown();
+
+  Config::Shutdown();
+}
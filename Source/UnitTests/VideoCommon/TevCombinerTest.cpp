@@ -0,0 +1,176 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/TevCombiner.h"
+#include "VideoCommon/BPMemory.h"
+
+namespace
+{
+enum
+{
+  ALP_C,
+  BLU_C,
+  GRN_C,
+  RED_C
+};
+
+s16 Clamp(s16 value, bool clamp)
+{
+  return clamp ? std::clamp<s16>(value, 0, 255) : std::clamp<s16>(value, -1024, 1023);
+}
+}  // namespace
+
+// CombineRegular has to match the scalar reference implementation exactly, for every combination
+// of the bias, op, clamp and scale bits of both combiners.
+TEST(TevCombiner, MatchesScalarReference)
+{
+  std::mt19937 rng(0x7E7);
+  std::uniform_int_distribution<int> u8_dist(0, 255);
+  std::uniform_int_distribution<int> d_dist(-1024, 1023);
+
+  for (u32 color_mode = 0; color_mode < 64; color_mode++)
+  {
+    for (u32 alpha_mode = 0; alpha_mode < 64; alpha_mode++)
+    {
+      TevStageCombiner::ColorCombiner cc{};
+      TevStageCombiner::AlphaCombiner ac{};
+      cc.hex = color_mode << 16;
+      ac.hex = alpha_mode << 16;
+      if (cc.bias == TevBias::Compare || ac.bias == TevBias::Compare)
+        continue;
+
+      for (int iteration = 0; iteration < 64; iteration++)
+      {
+        TevCombiner::InputRegType inputs[4];
+        for (TevCombiner::InputRegType& input : inputs)
+        {
+          // Include the extremes, which are the most likely to expose rounding differences
+          input.a = iteration == 0 ? 255 : u8_dist(rng);
+          input.b = iteration == 0 ? 255 : u8_dist(rng);
+          input.c = iteration == 0 ? 255 : u8_dist(rng);
+          input.d = iteration == 0 ? -1024 : iteration == 1 ? 1023 : d_dist(rng);
+        }
+
+        s16 expected[4];
+        for (int i = BLU_C; i <= RED_C; i++)
+          expected[i] = Clamp(TevCombiner::ColorRegular(cc, inputs[i]), cc.clamp);
+        expected[ALP_C] = Clamp(TevCombiner::AlphaRegular(ac, inputs[ALP_C]), ac.clamp);
+
+        s16 result[4];
+        TevCombiner::CombineRegular(cc, ac, inputs, result);
+
+        for (int i = 0; i < 4; i++)
+        {
+          EXPECT_EQ(expected[i], result[i])
+              << "channel " << i << ", color mode " << color_mode << ", alpha mode " << alpha_mode;
+        }
+      }
+    }
+  }
+}
+
+// CombineQuad has to match CombineRegular for each pixel, on every code path, including for
+// inputs that still have to be truncated to the sizes of the hardware registers.
+TEST(TevCombiner, QuadMatchesRegular)
+{
+  std::mt19937 rng(0x4AD);
+  std::uniform_int_distribution<int> s16_dist(-32768, 32767);
+
+  const bool has_avx2 = cpu_info.bAVX2;
+  for (const bool use_avx2 : {false, true})
+  {
+    if (use_avx2 && !has_avx2)
+      continue;
+    cpu_info.bAVX2 = use_avx2;
+
+    for (u32 color_mode = 0; color_mode < 64; color_mode++)
+    {
+      for (u32 alpha_mode = 0; alpha_mode < 64; alpha_mode++)
+      {
+        TevStageCombiner::ColorCombiner cc{};
+        TevStageCombiner::AlphaCombiner ac{};
+        cc.hex = color_mode << 16;
+        ac.hex = alpha_mode << 16;
+        if (cc.bias == TevBias::Compare || ac.bias == TevBias::Compare)
+          continue;
+
+        for (int iteration = 0; iteration < 16; iteration++)
+        {
+          TevCombiner::QuadInputs inputs;
+          for (int i = 0; i < 4; i++)
+          {
+            for (int pixel = 0; pixel < 4; pixel++)
+            {
+              inputs.a[i][pixel] = static_cast<s16>(s16_dist(rng));
+              inputs.b[i][pixel] = static_cast<s16>(s16_dist(rng));
+              inputs.c[i][pixel] = iteration == 0 ? 255 : static_cast<s16>(s16_dist(rng));
+              inputs.d[i][pixel] = static_cast<s16>(s16_dist(rng));
+            }
+          }
+
+          s16 result[4][4];
+          TevCombiner::CombineQuad(cc, ac, inputs, result);
+
+          for (int pixel = 0; pixel < 4; pixel++)
+          {
+            TevCombiner::InputRegType pixel_inputs[4];
+            for (int i = 0; i < 4; i++)
+            {
+              pixel_inputs[i].a = inputs.a[i][pixel];
+              pixel_inputs[i].b = inputs.b[i][pixel];
+              pixel_inputs[i].c = inputs.c[i][pixel];
+              pixel_inputs[i].d = inputs.d[i][pixel];
+            }
+
+            s16 expected[4];
+            TevCombiner::CombineRegular(cc, ac, pixel_inputs, expected);
+            for (int i = 0; i < 4; i++)
+            {
+              EXPECT_EQ(expected[i], result[i][pixel])
+                  << "channel " << i << ", pixel " << pixel << ", color mode " << color_mode
+                  << ", alpha mode " << alpha_mode << ", AVX2 " << use_avx2;
+            }
+          }
+        }
+      }
+    }
+  }
+  cpu_info.bAVX2 = has_avx2;
+}
+
+TEST(TevCombiner, AlphaTestQuadMatchesScalar)
+{
+  for (u32 mode = 0; mode < (1 << 8); mode++)
+  {
+    AlphaTest alpha_test{};
+    alpha_test.hex = mode << 16;
+
+    for (const auto& [ref0, ref1] : {std::pair{0, 255}, std::pair{128, 64}, std::pair{7, 7}})
+    {
+      alpha_test.ref0 = ref0;
+      alpha_test.ref1 = ref1;
+
+      for (u32 first = 0; first < 256; first += 4)
+      {
+        const u8 alpha[4] = {static_cast<u8>(first), static_cast<u8>(first + 1),
+                             static_cast<u8>(first + 2), static_cast<u8>(255 - first)};
+        u32 expected = 0;
+        for (u32 i = 0; i < 4; i++)
+        {
+          if (TevCombiner::PassesAlphaTest(alpha_test, alpha[i]))
+            expected |= 1u << i;
+        }
+        EXPECT_EQ(expected, TevCombiner::AlphaTestQuad(alpha_test, alpha))
+            << "mode " << mode << ", first alpha " << first;
+      }
+    }
+  }
+}
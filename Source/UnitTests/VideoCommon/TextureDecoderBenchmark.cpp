@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// BM_Decode decodes a 1024x1024 texture with a full mipmap chain, the way the texture cache does
+// when a texture can't be decoded on the GPU, on a given number of threads. BM_DecodeSIMD decodes
+// a single 1024x1024 level on one thread with each of the SIMD paths that are selected at runtime.
+
+namespace
+{
+constexpr u32 TEXTURE_SIZE = 1024;
+
+std::vector<u8> MakeData(size_t size)
+{
+  std::vector<u8> data(size);
+  u32 seed = 1;
+  for (u8& byte : data)
+  {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<u8>(seed >> 16);
+  }
+  return data;
+}
+
+const std::vector<u8>& GetTLUT()
+{
+  // Large enough for the 14-bit indices of C14X2
+  static const std::vector<u8> tlut = MakeData(0x4000 * sizeof(u16));
+  return tlut;
+}
+
+void BM_Decode(benchmark::State& state, TextureFormat format)
+{
+  const std::vector<u8>& tlut = GetTLUT();
+
+  struct Level
+  {
+    u32 size;
+    std::vector<u8> src;
+    std::vector<u8> dst;
+  };
+  std::vector<Level> levels;
+  u64 texels = 0;
+  for (u32 size = TEXTURE_SIZE; size >= 8; size /= 2)
+  {
+    levels.push_back({size, MakeData(TexDecoder_GetTextureSizeInBytes(size, size, format)),
+                      std::vector<u8>(size * size * sizeof(u32))});
+    texels += size * size;
+  }
+
+  ParallelTextureDecoder decoder(static_cast<u32>(state.range(0)));
+  for (auto _ : state)
+  {
+    for (Level& level : levels)
+    {
+      decoder.AddLevel(level.dst.data(), level.src.data(), level.size, level.size, format,
+                       tlut.data(), TLUTFormat::RGB5A3);
+    }
+    decoder.Decode();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * texels);
+  state.SetBytesProcessed(state.iterations() * texels * sizeof(u32));
+}
+
+#ifdef _M_X86_64
+enum class SIMD
+{
+  SSE2,
+  SSSE3,
+  AVX2,
+};
+#endif
+
+void BM_DecodeSIMD(benchmark::State& state, TextureFormat format)
+{
+#ifdef _M_X86_64
+  const SIMD simd = static_cast<SIMD>(state.range(0));
+  if ((simd >= SIMD::SSSE3 && !cpu_info.bSSSE3) || (simd >= SIMD::AVX2 && !cpu_info.bAVX2))
+  {
+    state.SkipWithError("Not supported by this CPU");
+    return;
+  }
+  const CPUInfo saved_cpu_info = cpu_info;
+  cpu_info.bSSSE3 = simd >= SIMD::SSSE3;
+  cpu_info.bAVX2 = simd >= SIMD::AVX2;
+#endif
+
+  const std::vector<u8> src =
+      MakeData(TexDecoder_GetTextureSizeInBytes(TEXTURE_SIZE, TEXTURE_SIZE, format));
+  std::vector<u8> dst(TEXTURE_SIZE * TEXTURE_SIZE * sizeof(u32));
+  for (auto _ : state)
+  {
+    TexDecoder_Decode(dst.data(), src.data(), TEXTURE_SIZE, TEXTURE_SIZE, format, GetTLUT().data(),
+                      TLUTFormat::RGB5A3);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * TEXTURE_SIZE * TEXTURE_SIZE);
+  state.SetBytesProcessed(state.iterations() * TEXTURE_SIZE * TEXTURE_SIZE * sizeof(u32));
+
+#ifdef _M_X86_64
+  cpu_info = saved_cpu_info;
+#endif
+}
+
+void SIMDPaths(benchmark::internal::Benchmark* benchmark)
+{
+#ifdef _M_X86_64
+  benchmark->ArgName("simd")
+      ->Arg(static_cast<int>(SIMD::SSE2))
+      ->Arg(static_cast<int>(SIMD::SSSE3))
+      ->Arg(static_cast<int>(SIMD::AVX2));
+#endif
+}
+
+void ThreadCounts(benchmark::internal::Benchmark* benchmark)
+{
+  benchmark->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Decode, I4, TextureFormat::I4)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, I8, TextureFormat::I8)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, IA4, TextureFormat::IA4)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, IA8, TextureFormat::IA8)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, RGB565, TextureFormat::RGB565)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, RGB5A3, TextureFormat::RGB5A3)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, RGBA8, TextureFormat::RGBA8)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, C4, TextureFormat::C4)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, C8, TextureFormat::C8)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, C14X2, TextureFormat::C14X2)->Apply(ThreadCounts);
+BENCHMARK_CAPTURE(BM_Decode, CMPR, TextureFormat::CMPR)->Apply(ThreadCounts);
+
+BENCHMARK_CAPTURE(BM_DecodeSIMD, I4, TextureFormat::I4)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, I8, TextureFormat::I8)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, IA4, TextureFormat::IA4)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, IA8, TextureFormat::IA8)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, RGB565, TextureFormat::RGB565)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, RGB5A3, TextureFormat::RGB5A3)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, RGBA8, TextureFormat::RGBA8)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, C4, TextureFormat::C4)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, C8, TextureFormat::C8)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, C14X2, TextureFormat::C14X2)->Apply(SIMDPaths);
+BENCHMARK_CAPTURE(BM_DecodeSIMD, CMPR, TextureFormat::CMPR)->Apply(SIMDPaths);
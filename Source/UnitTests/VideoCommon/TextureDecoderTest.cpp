@@ -0,0 +1,96 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr std::array<TextureFormat, 11> FORMATS = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+constexpr std::array<TLUTFormat, 3> TLUT_FORMATS = {TLUTFormat::IA8, TLUTFormat::RGB565,
+                                                    TLUTFormat::RGB5A3};
+
+std::vector<u8> RandomBytes(size_t size, std::mt19937& rng)
+{
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(rng());
+  return data;
+}
+
+// Compares the decoding of whole textures, which may use SIMD, with the per-texel decoder.
+void CheckAllFormats()
+{
+  std::mt19937 rng(5678);
+  // Large enough for the 14-bit indices of C14X2
+  const std::vector<u8> tlut = RandomBytes(0x4000 * sizeof(u16), rng);
+
+  for (const TextureFormat format : FORMATS)
+  {
+    // An odd number of blocks per row, to catch decoders which work on pairs of blocks
+    const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+    const int width = (84 + block_width - 1) / block_width * block_width;
+    const int height = 24;
+
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(width, height, format), rng);
+
+    for (const TLUTFormat tlut_format : TLUT_FORMATS)
+    {
+      if (!IsColorIndexed(format) && tlut_format != TLUTFormat::IA8)
+        continue;
+
+      std::vector<u8> decoded(width * height * sizeof(u32));
+      TexDecoder_Decode(decoded.data(), src.data(), width, height, format, tlut.data(),
+                        tlut_format);
+
+      int mismatches = 0;
+      for (int t = 0; t < height; t++)
+      {
+        for (int s = 0; s < width; s++)
+        {
+          std::array<u8, 4> texel;
+          TexDecoder_DecodeTexel(texel.data(), src.data(), s, t, width - 1, format, tlut.data(),
+                                 tlut_format);
+          const u8* decoded_texel = &decoded[(t * width + s) * sizeof(u32)];
+          if (!std::equal(texel.begin(), texel.end(), decoded_texel))
+            mismatches++;
+        }
+      }
+      EXPECT_EQ(0, mismatches) << "format " << static_cast<int>(format) << " tlut format "
+                               << static_cast<int>(tlut_format);
+    }
+  }
+}
+}  // namespace
+
+TEST(TextureDecoder, MatchesTexelDecoding)
+{
+  CheckAllFormats();
+}
+
+TEST(TextureDecoder, FallbacksMatchTexelDecoding)
+{
+  // Run the checks again with the SIMD paths which are selected at runtime turned off one by one
+  const CPUInfo saved_cpu_info = cpu_info;
+
+  cpu_info.bAVX2 = false;
+  CheckAllFormats();
+  cpu_info.bSSSE3 = false;
+  CheckAllFormats();
+
+  cpu_info = saved_cpu_info;
+}
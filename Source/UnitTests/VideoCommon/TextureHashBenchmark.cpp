@@ -0,0 +1,112 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Image.h"
+
+// Compares the texture hashes that the TextureHashVersion setting selects between. Set
+// DOLPHIN_TEXTURE_DUMP_DIR to a directory of dumped textures (Dump/Textures/<game ID>) to hash the
+// pixels of those. Otherwise, a synthetic set of textures of typical sizes is used.
+
+namespace
+{
+std::vector<std::vector<u8>> LoadTextureDumps(const std::string& directory)
+{
+  std::vector<std::vector<u8>> textures;
+  for (const std::string& path : Common::DoFileSearch({directory}, {".png"}, true))
+  {
+    File::IOFile file(path, "rb");
+    std::vector<u8> png(file.GetSize());
+    if (!file.ReadBytes(png.data(), png.size()))
+      continue;
+
+    std::vector<u8> pixels;
+    u32 width, height;
+    if (Common::LoadPNG(png, &pixels, &width, &height))
+      textures.push_back(std::move(pixels));
+  }
+  return textures;
+}
+
+std::vector<std::vector<u8>> MakeSyntheticTextures()
+{
+  // From font glyphs and small palettized textures up to a 512x512 RGBA8 texture
+  static constexpr u32 SIZES[] = {512, 2048, 8192, 32768, 131072, 524288, 1048576};
+
+  std::vector<std::vector<u8>> textures;
+  u32 seed = 1;
+  for (u32 size : SIZES)
+  {
+    std::vector<u8>& texture = textures.emplace_back(size);
+    for (u8& byte : texture)
+    {
+      seed = seed * 1103515245 + 12345;
+      byte = static_cast<u8>(seed >> 16);
+    }
+  }
+  return textures;
+}
+
+const std::vector<std::vector<u8>>& GetTextures()
+{
+  static const std::vector<std::vector<u8>> textures = [] {
+    const char* directory = std::getenv("DOLPHIN_TEXTURE_DUMP_DIR");
+    if (directory)
+    {
+      std::vector<std::vector<u8>> dumps = LoadTextureDumps(directory);
+      if (!dumps.empty())
+        return dumps;
+    }
+    return MakeSyntheticTextures();
+  }();
+  return textures;
+}
+
+template <typename HashFunction>
+void HashTextures(benchmark::State& state, HashFunction hash)
+{
+  const std::vector<std::vector<u8>>& textures = GetTextures();
+  size_t bytes = 0;
+  for (const std::vector<u8>& texture : textures)
+    bytes += texture.size();
+
+  for (auto _ : state)
+  {
+    for (const std::vector<u8>& texture : textures)
+      benchmark::DoNotOptimize(hash(texture.data(), static_cast<u32>(texture.size())));
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.SetItemsProcessed(state.iterations() * textures.size());
+}
+
+// TextureHashVersion 1 with the default SafeTextureCacheColorSamples
+void BM_SampledHash(benchmark::State& state)
+{
+  HashTextures(state, [](const u8* data, u32 size) { return Common::GetHash64(data, size, 128); });
+}
+
+// TextureHashVersion 1 with SafeTextureCacheColorSamples set to safe
+void BM_UnsampledHash(benchmark::State& state)
+{
+  HashTextures(state, [](const u8* data, u32 size) { return Common::GetHash64(data, size, 0); });
+}
+
+// TextureHashVersion 2
+void BM_XXH3(benchmark::State& state)
+{
+  HashTextures(state, [](const u8* data, u32 size) { return Common::GetXXH3Hash64(data, size); });
+}
+}  // namespace
+
+BENCHMARK(BM_SampledHash);
+BENCHMARK(BM_UnsampledHash);
+BENCHMARK(BM_XXH3);
@@ -15,7 +15,9 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderCache.h"
 #include "VideoCommon/VertexLoaderManager.h"
 
 TEST(VertexLoaderUID, UniqueEnough)
@@ -776,3 +778,48 @@ static void PrintTo(const NormalComponentCount& t, std::ostream* os)
 {
   *os << fmt::to_string(t);
 }
+
+TEST_F(VertexLoaderTest, CacheReusesConvertedVertices)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  CreateAndCheckSizes(3 * sizeof(float), 3 * sizeof(float));
+
+  constexpr int count = 64;
+  for (int i = 0; i < count; i++)
+  {
+    Input(static_cast<float>(i));
+    Input(static_cast<float>(i * 2));
+    Input(static_cast<float>(i * 3));
+  }
+
+  VertexLoaderCache cache;
+  const int hits = g_stats.this_frame.num_vertex_loader_cache_hits;
+
+  // The first pass converts the vertices, the second one adds them to the cache, and the third one
+  // reads them back from it
+  for (int pass = 0; pass < 3; pass++)
+  {
+    ResetPointers();
+    memset(output_memory, 0xFF, count * 3 * sizeof(float));
+    EXPECT_EQ(count, cache.RunVertices(m_loader.get(), m_vtx_desc, m_vtx_attr, m_src.GetPointer(),
+                                       m_dst.GetPointer(), count));
+    for (int i = 0; i < count; i++)
+    {
+      ExpectOut(static_cast<float>(i));
+      ExpectOut(static_cast<float>(i * 2));
+      ExpectOut(static_cast<float>(i * 3));
+    }
+  }
+  EXPECT_EQ(hits + 1, g_stats.this_frame.num_vertex_loader_cache_hits);
+
+  // Changed vertex data must not hit the old entry
+  ResetPointers();
+  Input(100.0f);
+  ResetPointers();
+  EXPECT_EQ(count, cache.RunVertices(m_loader.get(), m_vtx_desc, m_vtx_attr, m_src.GetPointer(),
+                                     m_dst.GetPointer(), count));
+  ExpectOut(100.0f);
+  EXPECT_EQ(hits + 1, g_stats.this_frame.num_vertex_loader_cache_hits);
+}